@@ -0,0 +1,69 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Compares converting reaction coefficients with yaml-cpp's stream-based as<double>() against DecodeNumber, which the
+// parsers use.
+
+#include <yaml-cpp/yaml.h>
+
+#include <chrono>
+#include <cstdio>
+#include <open_atmos/mechanism_configuration/numbers.hpp>
+#include <random>
+#include <vector>
+
+using namespace open_atmos::mechanism_configuration;
+
+int main()
+{
+  const std::size_t number_of_coefficients = 1000000;
+
+  // a mix of the short literals that are common in configurations and full precision values
+  std::mt19937_64 generator(42);
+  std::uniform_real_distribution<double> distribution(-10.0, 10.0);
+  std::vector<YAML::Node> coefficients;
+  coefficients.reserve(number_of_coefficients);
+  char text[32];
+  for (std::size_t i = 0; i < number_of_coefficients; ++i)
+  {
+    double value = distribution(generator);
+    std::snprintf(text, sizeof(text), i % 2 == 0 ? "%.2f" : "%.17g", value);
+    coefficients.emplace_back(text);
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  double yaml_sum = 0;
+  for (const auto& coefficient : coefficients)
+  {
+    yaml_sum += coefficient.as<double>();
+  }
+  auto yaml_end = std::chrono::steady_clock::now();
+
+  double decoded_sum = 0;
+  for (const auto& coefficient : coefficients)
+  {
+    double value = 0;
+    if (DecodeNumber(coefficient, value) != ConfigParseStatus::Success)
+    {
+      std::fprintf(stderr, "Failed to convert %s\n", coefficient.Scalar().c_str());
+      return 1;
+    }
+    decoded_sum += value;
+  }
+  auto decoded_end = std::chrono::steady_clock::now();
+
+  if (yaml_sum != decoded_sum)
+  {
+    std::fprintf(stderr, "The conversions disagree: %.17g and %.17g\n", yaml_sum, decoded_sum);
+    return 1;
+  }
+
+  double yaml_seconds = std::chrono::duration<double>(yaml_end - start).count();
+  double decoded_seconds = std::chrono::duration<double>(decoded_end - yaml_end).count();
+  std::printf("%14s %12s %16s\n", "conversion", "total [s]", "per value [ns]");
+  std::printf("%14s %12.3f %16.1f\n", "as<double>", yaml_seconds, yaml_seconds * 1.0e9 / number_of_coefficients);
+  std::printf("%14s %12.3f %16.1f\n", "DecodeNumber", decoded_seconds, decoded_seconds * 1.0e9 / number_of_coefficients);
+
+  return 0;
+}
@@ -0,0 +1,142 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Measures how the time to parse a mechanism grows with its size. Species and reactions are scaled together, as they
+// are in real mechanisms, so any per-reaction work that depends on the number of species shows up as a rising cost
+// per reaction. The time to parse with one thread per hardware thread and the time to reload the parsed mechanism from
+// its binary form are shown alongside for comparison.
+
+#include <yaml-cpp/yaml.h>
+
+#include <chrono>
+#include <cstdio>
+#include <open_atmos/mechanism_configuration/compiled_mechanism.hpp>
+#include <open_atmos/mechanism_configuration/parser.hpp>
+#include <open_atmos/mechanism_configuration/serialization.hpp>
+#include <string>
+#include <vector>
+
+using namespace open_atmos::mechanism_configuration;
+
+YAML::Node BuildMechanism(std::size_t number_of_reactions)
+{
+  const std::size_t number_of_species = number_of_reactions / 4 + 4;
+
+  YAML::Node mechanism;
+  mechanism["version"] = "1.0.0";
+  mechanism["name"] = "scaling";
+
+  YAML::Node gas;
+  gas["name"] = "gas";
+  for (std::size_t i = 0; i < number_of_species; ++i)
+  {
+    YAML::Node species;
+    species["name"] = "S" + std::to_string(i);
+    mechanism["species"].push_back(species);
+    gas["species"].push_back("S" + std::to_string(i));
+  }
+  mechanism["phases"].push_back(gas);
+
+  auto component = [&](std::size_t i)
+  {
+    YAML::Node node;
+    node["species name"] = "S" + std::to_string(i % number_of_species);
+    return node;
+  };
+
+  for (std::size_t i = 0; i < number_of_reactions; ++i)
+  {
+    YAML::Node reaction;
+    reaction["type"] = (i % 2 == 0) ? "ARRHENIUS" : "TROE";
+    reaction["gas phase"] = "gas";
+    reaction["reactants"].push_back(component(i * 7));
+    reaction["reactants"].push_back(component(i * 7 + 1));
+    reaction["products"].push_back(component(i * 13 + 2));
+    reaction["products"].push_back(component(i * 13 + 3));
+    mechanism["reactions"].push_back(reaction);
+  }
+
+  return mechanism;
+}
+
+int main()
+{
+  const std::vector<std::size_t> sizes = { 1000, 2000, 5000, 10000, 20000, 50000 };
+  Parser parser;
+  Parser parallel_parser;
+  parallel_parser.SetNumberOfThreads(0);
+
+  std::printf(
+      "%12s %12s %14s %18s %14s %16s %14s %12s\n",
+      "reactions",
+      "species",
+      "parse [s]",
+      "per reaction [us]",
+      "parallel [s]",
+      "deserialize [s]",
+      "compile [s]",
+      "binary [MB]");
+  for (auto size : sizes)
+  {
+    YAML::Node mechanism = BuildMechanism(size);
+
+    auto start = std::chrono::steady_clock::now();
+    auto parsed = parser.Parse(mechanism);
+    auto end = std::chrono::steady_clock::now();
+
+    if (parsed.first != ConfigParseStatus::Success)
+    {
+      std::fprintf(stderr, "Failed to parse the generated mechanism: %s\n", configParseStatusToString(parsed.first).c_str());
+      return 1;
+    }
+
+    auto parallel_start = std::chrono::steady_clock::now();
+    auto parallel = parallel_parser.Parse(mechanism);
+    auto parallel_end = std::chrono::steady_clock::now();
+
+    if (parallel.first != ConfigParseStatus::Success)
+    {
+      std::fprintf(stderr, "Failed to parse the generated mechanism in parallel: %s\n", configParseStatusToString(parallel.first).c_str());
+      return 1;
+    }
+
+    std::vector<std::byte> binary = Serialize(parsed.second);
+    auto reload_start = std::chrono::steady_clock::now();
+    auto reloaded = Deserialize(binary);
+    auto reload_end = std::chrono::steady_clock::now();
+
+    if (reloaded.first != ConfigParseStatus::Success)
+    {
+      std::fprintf(stderr, "Failed to reload the generated mechanism: %s\n", configParseStatusToString(reloaded.first).c_str());
+      return 1;
+    }
+
+    auto compile_start = std::chrono::steady_clock::now();
+    CompiledMechanism compiled = Compile(parsed.second);
+    auto compile_end = std::chrono::steady_clock::now();
+
+    if (compiled.number_of_reactions != size)
+    {
+      std::fprintf(stderr, "The compiled mechanism has %zu reactions instead of %zu\n", compiled.number_of_reactions, size);
+      return 1;
+    }
+
+    double seconds = std::chrono::duration<double>(end - start).count();
+    double parallel_seconds = std::chrono::duration<double>(parallel_end - parallel_start).count();
+    double reload_seconds = std::chrono::duration<double>(reload_end - reload_start).count();
+    double compile_seconds = std::chrono::duration<double>(compile_end - compile_start).count();
+    std::printf(
+        "%12zu %12zu %14.3f %18.2f %14.3f %16.4f %14.4f %12.2f\n",
+        size,
+        parsed.second.species.size(),
+        seconds,
+        seconds * 1.0e6 / size,
+        parallel_seconds,
+        reload_seconds,
+        compile_seconds,
+        binary.size() / 1.0e6);
+  }
+
+  return 0;
+}
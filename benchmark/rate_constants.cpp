@@ -0,0 +1,381 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Compares evaluating rate constants cell by cell, straight from the formulas, against the batch kernels in
+// rate_constants.hpp.
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <open_atmos/constants.hpp>
+#include <open_atmos/mechanism_configuration/compiled_mechanism.hpp>
+#include <open_atmos/mechanism_configuration/conversions.hpp>
+#include <open_atmos/mechanism_configuration/rate_constants.hpp>
+#include <open_atmos/mechanism_configuration/validation.hpp>
+#include <random>
+#include <vector>
+
+using namespace open_atmos::mechanism_configuration;
+using namespace open_atmos;
+
+namespace
+{
+  const std::size_t number_of_reactions = 1000;
+  const std::size_t number_of_cells = 4096;
+
+  template<typename F>
+  double Seconds(F&& function)
+  {
+    auto start = std::chrono::steady_clock::now();
+    function();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  }
+
+  void Report(const char* kind, double scalar_seconds, double batch_seconds, double difference)
+  {
+    const double evaluations = static_cast<double>(number_of_reactions * number_of_cells);
+    std::printf(
+        "%12s %16.2f %16.2f %12.1e\n", kind, scalar_seconds * 1.0e9 / evaluations, batch_seconds * 1.0e9 / evaluations, difference);
+  }
+
+  double LargestRelativeDifference(const std::vector<double>& scalar, const std::vector<double>& batch)
+  {
+    double largest = 0;
+    for (std::size_t i = 0; i < scalar.size(); ++i)
+    {
+      largest = std::max(largest, std::abs(scalar[i] - batch[i]) / std::abs(scalar[i]));
+    }
+    return largest;
+  }
+}  // namespace
+
+int main()
+{
+  std::mt19937_64 generator(42);
+  auto uniform = [&](double low, double high) { return std::uniform_real_distribution<double>(low, high)(generator); };
+
+  std::vector<double> temperature(number_of_cells);
+  std::vector<double> pressure(number_of_cells);
+  std::vector<double> air_density(number_of_cells);
+  std::vector<double> number_density(number_of_cells);
+  for (std::size_t c = 0; c < number_of_cells; ++c)
+  {
+    temperature[c] = uniform(200.0, 320.0);
+    pressure[c] = uniform(1.0e4, 1.1e5);
+    air_density[c] = pressure[c] / (8.314462618 * temperature[c]);
+    number_density[c] = air_density[c] * MolesM3ToMoleculesCm3;
+  }
+  Span<double> T{ temperature.data(), number_of_cells };
+  Span<double> P{ pressure.data(), number_of_cells };
+  Span<double> M{ air_density.data(), number_of_cells };
+
+  // one mode of particles for Surface reactions and number_of_bins size bins for SIMPOL partitioning
+  const std::size_t number_of_bins = 4;
+  std::vector<double> radius(number_of_bins * number_of_cells);
+  std::vector<double> number_concentration(number_of_bins * number_of_cells);
+  for (std::size_t i = 0; i < number_of_bins * number_of_cells; ++i)
+  {
+    radius[i] = uniform(1.0e-8, 1.0e-6);
+    number_concentration[i] = uniform(1.0e8, 1.0e10);
+  }
+
+  types::Mechanism mechanism;
+  const std::size_t number_of_species = 100;
+  for (std::size_t i = 0; i < number_of_species; ++i)
+  {
+    types::Species species;
+    species.name = "S" + std::to_string(i);
+    species.optional_numerical_properties[validation::keys.diffusion_coefficient] = uniform(5.0e-6, 3.0e-5);
+    species.optional_numerical_properties[validation::keys.molecular_weight] = uniform(0.017, 0.3);
+    species.optional_numerical_properties[validation::keys.henrys_law_constant_298] = uniform(1.0e-5, 1.0e3);
+    species.optional_numerical_properties[validation::keys.henrys_law_constant_exponential_factor] = uniform(1000.0, 8000.0);
+    mechanism.species.push_back(species);
+  }
+  const types::SymbolId water = static_cast<types::SymbolId>(number_of_species);
+  mechanism.species.push_back({ "H2O", { { validation::keys.molecular_weight, 0.018 }, { validation::keys.density, 1000.0 } }, {} });
+  std::vector<double> concentrations(mechanism.species.size() * number_of_cells);
+  for (double& concentration : concentrations)
+  {
+    concentration = uniform(1.0e-6, 1.0e-2);
+  }
+  for (std::size_t i = 0; i < number_of_reactions; ++i)
+  {
+    types::Arrhenius arrhenius;
+    arrhenius.A = uniform(1.0e-14, 1.0e-10);
+    arrhenius.B = uniform(-3.0, 3.0);
+    arrhenius.C = uniform(-2000.0, 500.0);
+    arrhenius.E = uniform(0.0, 1.0e-6);
+    mechanism.reactions.arrhenius.push_back(arrhenius);
+
+    types::Troe troe;
+    troe.k0_A = uniform(1.0e-32, 1.0e-29);
+    troe.k0_B = uniform(-4.0, 0.0);
+    troe.k0_C = uniform(-100.0, 100.0);
+    troe.kinf_A = uniform(1.0e-12, 1.0e-10);
+    troe.kinf_B = uniform(-1.0, 1.0);
+    troe.Fc = uniform(0.3, 0.6);
+    troe.N = uniform(0.75, 1.25);
+    mechanism.reactions.troe.push_back(troe);
+
+    types::Branched branched{};
+    branched.X = uniform(1.0e-12, 1.0e-11);
+    branched.Y = uniform(-400.0, 0.0);
+    branched.a0 = uniform(0.01, 0.3);
+    branched.n = static_cast<int>(uniform(1.0, 12.0));
+    mechanism.reactions.branched.push_back(branched);
+
+    types::Tunneling tunneling;
+    tunneling.A = uniform(1.0e-12, 1.0e8);
+    tunneling.B = uniform(0.0, 9000.0);
+    tunneling.C = uniform(0.0, 1.0e8);
+    mechanism.reactions.tunneling.push_back(tunneling);
+
+    types::Surface surface;
+    surface.gas_phase_species.species_id = static_cast<types::SymbolId>(i % number_of_species);
+    surface.reaction_probability = uniform(1.0e-4, 0.5);
+    mechanism.reactions.surface.push_back(surface);
+
+    types::SimpolPhaseTransfer simpol;
+    simpol.gas_phase_species.species_id = static_cast<types::SymbolId>(i % number_of_species);
+    simpol.B = { uniform(-4000.0, -1000.0), uniform(2.0, 5.0), uniform(1.0e-3, 3.0e-3), uniform(-1.2, -0.4) };
+    mechanism.reactions.simpol_phase_transfer.push_back(simpol);
+
+    types::HenrysLaw henrys_law;
+    henrys_law.gas_phase_species = static_cast<types::SymbolId>(i % number_of_species);
+    henrys_law.aerosol_phase_water = water;
+    mechanism.reactions.henrys_law.push_back(henrys_law);
+  }
+  CompiledMechanism compiled = Compile(mechanism);
+
+  std::printf("%12s %16s %16s %12s\n", "reaction", "scalar [ns]", "batch [ns]", "difference");
+
+  {
+    const compiled::ArrheniusParameters& parameters = compiled.arrhenius;
+    std::vector<double> scalar(number_of_reactions * number_of_cells);
+    double scalar_seconds = Seconds(
+        [&]
+        {
+          for (std::size_t c = 0; c < number_of_cells; ++c)
+          {
+            for (std::size_t i = 0; i < number_of_reactions; ++i)
+            {
+              scalar[i * number_of_cells + c] = parameters.A[i] * std::exp(parameters.C[i] / temperature[c]) *
+                                                std::pow(temperature[c] / parameters.D[i], parameters.B[i]) *
+                                                (1.0 + parameters.E[i] * pressure[c]);
+            }
+          }
+        });
+    rate_constants::Arrhenius reactions = rate_constants::PrepareArrhenius(parameters);
+    std::vector<double> batch;
+    double batch_seconds = Seconds([&] { rate_constants::Evaluate(reactions, T, P, batch); });
+    Report("Arrhenius", scalar_seconds, batch_seconds, LargestRelativeDifference(scalar, batch));
+  }
+
+  {
+    const compiled::TroeParameters& parameters = compiled.troe;
+    std::vector<double> scalar(number_of_reactions * number_of_cells);
+    double scalar_seconds = Seconds(
+        [&]
+        {
+          for (std::size_t c = 0; c < number_of_cells; ++c)
+          {
+            const double T = temperature[c];
+            for (std::size_t i = 0; i < number_of_reactions; ++i)
+            {
+              double k0 = parameters.k0_A[i] * std::exp(parameters.k0_C[i] / T) * std::pow(T / 300.0, parameters.k0_B[i]);
+              double kinf = parameters.kinf_A[i] * std::exp(parameters.kinf_C[i] / T) * std::pow(T / 300.0, parameters.kinf_B[i]);
+              double ratio = k0 * number_density[c] / kinf;
+              scalar[i * number_of_cells + c] = k0 * number_density[c] / (1.0 + ratio) *
+                                                std::pow(parameters.Fc[i], 1.0 / (1.0 + std::pow(std::log10(ratio), 2) / parameters.N[i]));
+            }
+          }
+        });
+    rate_constants::Troe reactions = rate_constants::PrepareTroe(parameters);
+    std::vector<double> batch;
+    double batch_seconds = Seconds([&] { rate_constants::Evaluate(reactions, T, M, batch); });
+    Report("Troe", scalar_seconds, batch_seconds, LargestRelativeDifference(scalar, batch));
+  }
+
+  {
+    const compiled::BranchedParameters& parameters = compiled.branched;
+    // the structure term, as consumers write it; the nitrate and alkoxy branches are separate passes
+    auto structure = [](double T, double M, int n)
+    {
+      double k0_M = 2.0e-22 * std::exp(n) * M;
+      double kinf = 0.43 * std::pow(T / 298.0, -8.0);
+      return k0_M / (1.0 + k0_M / kinf) * std::pow(0.41, 1.0 / (1.0 + std::pow(std::log10(k0_M / kinf), 2)));
+    };
+    std::vector<double> scalar_nitrate(number_of_reactions * number_of_cells);
+    std::vector<double> scalar_alkoxy(number_of_reactions * number_of_cells);
+    double scalar_seconds = Seconds(
+        [&]
+        {
+          for (std::vector<double>* branch : { &scalar_nitrate, &scalar_alkoxy })
+          {
+            for (std::size_t c = 0; c < number_of_cells; ++c)
+            {
+              const double T = temperature[c];
+              const double air = air_density[c] * MolesM3ToMoleculesCm3;
+              for (std::size_t i = 0; i < number_of_reactions; ++i)
+              {
+                double A = structure(T, air, parameters.n[i]);
+                double Z = structure(293.0, 2.45e19, parameters.n[i]) * (1.0 - parameters.a0[i]) / parameters.a0[i];
+                double k = parameters.X[i] * std::exp(-parameters.Y[i] / T);
+                (*branch)[i * number_of_cells + c] = branch == &scalar_nitrate ? k * A / (A + Z) : k * Z / (Z + A);
+              }
+            }
+          }
+        });
+    rate_constants::Branched reactions = rate_constants::PrepareBranched(parameters);
+    std::vector<double> nitrate;
+    std::vector<double> alkoxy;
+    double batch_seconds = Seconds([&] { rate_constants::Evaluate(reactions, T, M, nitrate, alkoxy); });
+    double difference = std::max(LargestRelativeDifference(scalar_nitrate, nitrate), LargestRelativeDifference(scalar_alkoxy, alkoxy));
+    Report("Branched", scalar_seconds, batch_seconds, difference);
+  }
+
+  {
+    const compiled::TunnelingParameters& parameters = compiled.tunneling;
+    std::vector<double> scalar(number_of_reactions * number_of_cells);
+    double scalar_seconds = Seconds(
+        [&]
+        {
+          for (std::size_t c = 0; c < number_of_cells; ++c)
+          {
+            const double T = temperature[c];
+            for (std::size_t i = 0; i < number_of_reactions; ++i)
+            {
+              scalar[i * number_of_cells + c] =
+                  parameters.A[i] * std::exp(-parameters.B[i] / T) * std::exp(parameters.C[i] / std::pow(T, 3));
+            }
+          }
+        });
+    rate_constants::Tunneling reactions = rate_constants::PrepareTunneling(parameters);
+    std::vector<double> batch;
+    double batch_seconds = Seconds([&] { rate_constants::Evaluate(reactions, T, batch); });
+    Report("Tunneling", scalar_seconds, batch_seconds, LargestRelativeDifference(scalar, batch));
+  }
+
+  {
+    // the species properties are looked up by name for every rate constant
+    const double pi = std::acos(-1.0);
+    std::vector<double> scalar(number_of_reactions * number_of_cells);
+    double scalar_seconds = Seconds(
+        [&]
+        {
+          for (std::size_t c = 0; c < number_of_cells; ++c)
+          {
+            const double r = radius[c];
+            for (std::size_t i = 0; i < number_of_reactions; ++i)
+            {
+              const types::Surface& surface = mechanism.reactions.surface[i];
+              const auto& properties = mechanism.species[surface.gas_phase_species.species_id].optional_numerical_properties;
+              double D = properties.at(validation::keys.diffusion_coefficient);
+              double MW = properties.at(validation::keys.molecular_weight);
+              double v = std::sqrt(8.0 * constants::R * temperature[c] / (pi * MW));
+              scalar[i * number_of_cells + c] =
+                  4.0 * number_concentration[c] * pi * r * r / (r / D + 4.0 / (v * surface.reaction_probability));
+            }
+          }
+        });
+    rate_constants::Surface reactions = rate_constants::PrepareSurface(mechanism, compiled).second;
+    std::vector<double> batch;
+    double batch_seconds = Seconds(
+        [&]
+        {
+          rate_constants::Evaluate(
+              reactions, T, { radius.data(), number_of_cells }, { number_concentration.data(), number_of_cells }, batch);
+        });
+    Report("Surface", scalar_seconds, batch_seconds, LargestRelativeDifference(scalar, batch));
+  }
+
+  {
+    // the saturation concentration and the condensation rate constants of every bin, per reaction and cell
+    const double pi = std::acos(-1.0);
+    std::vector<double> scalar_saturation(number_of_reactions * number_of_cells);
+    std::vector<double> scalar(number_of_reactions * number_of_bins * number_of_cells);
+    double scalar_seconds = Seconds(
+        [&]
+        {
+          for (std::size_t c = 0; c < number_of_cells; ++c)
+          {
+            const double T = temperature[c];
+            for (std::size_t i = 0; i < number_of_reactions; ++i)
+            {
+              const types::SimpolPhaseTransfer& simpol = mechanism.reactions.simpol_phase_transfer[i];
+              const auto& properties = mechanism.species[simpol.gas_phase_species.species_id].optional_numerical_properties;
+              double p = std::pow(10.0, simpol.B[0] / T + simpol.B[1] + simpol.B[2] * T + simpol.B[3] * std::log(T)) * 101325.0;
+              scalar_saturation[i * number_of_cells + c] = p / (constants::R * T);
+              for (std::size_t b = 0; b < number_of_bins; ++b)
+              {
+                double D = properties.at(validation::keys.diffusion_coefficient);
+                double v = std::sqrt(8.0 * constants::R * T / (pi * properties.at(validation::keys.molecular_weight)));
+                double r = radius[b * number_of_cells + c];
+                scalar[(i * number_of_bins + b) * number_of_cells + c] =
+                    4.0 * pi * number_concentration[b * number_of_cells + c] * r * r / (r / D + 4.0 / v);
+              }
+            }
+          }
+        });
+    rate_constants::Simpol reactions = rate_constants::PrepareSimpol(mechanism, compiled).second;
+    std::vector<double> saturation;
+    std::vector<double> batch;
+    double batch_seconds = Seconds(
+        [&]
+        {
+          rate_constants::Evaluate(
+              reactions, T, { radius.data(), radius.size() }, { number_concentration.data(), radius.size() }, saturation, batch);
+        });
+    double difference = std::max(LargestRelativeDifference(scalar_saturation, saturation), LargestRelativeDifference(scalar, batch));
+    Report("SIMPOL", scalar_seconds, batch_seconds, difference);
+  }
+
+  {
+    const double pi = std::acos(-1.0);
+    std::vector<double> scalar_forward(number_of_reactions * number_of_cells);
+    std::vector<double> scalar_reverse(number_of_reactions * number_of_cells);
+    double scalar_seconds = Seconds(
+        [&]
+        {
+          for (std::size_t c = 0; c < number_of_cells; ++c)
+          {
+            const double T = temperature[c];
+            const double r = radius[c];
+            for (std::size_t i = 0; i < number_of_reactions; ++i)
+            {
+              const types::HenrysLaw& henrys_law = mechanism.reactions.henrys_law[i];
+              const auto& gas = mechanism.species[henrys_law.gas_phase_species].optional_numerical_properties;
+              const auto& water_properties = mechanism.species[henrys_law.aerosol_phase_water].optional_numerical_properties;
+              double HLC = gas.at(validation::keys.henrys_law_constant_298) *
+                           std::exp(gas.at(validation::keys.henrys_law_constant_exponential_factor) * (1.0 / T - 1.0 / 298.0));
+              double water_volume = concentrations[henrys_law.aerosol_phase_water * number_of_cells + c] *
+                                    water_properties.at(validation::keys.molecular_weight) / water_properties.at(validation::keys.density);
+              double v = std::sqrt(8.0 * constants::R * T / (pi * gas.at(validation::keys.molecular_weight)));
+              double forward = 4.0 * pi * number_concentration[c] * r * r / (r / gas.at(validation::keys.diffusion_coefficient) + 4.0 / v);
+              scalar_forward[i * number_of_cells + c] = forward;
+              scalar_reverse[i * number_of_cells + c] = forward / (HLC * constants::R * T * water_volume);
+            }
+          }
+        });
+    rate_constants::HenrysLaw reactions = rate_constants::PrepareHenrysLaw(mechanism, compiled).second;
+    std::vector<double> forward;
+    std::vector<double> reverse;
+    double batch_seconds = Seconds(
+        [&]
+        {
+          rate_constants::Evaluate(
+              reactions,
+              T,
+              { radius.data(), number_of_cells },
+              { number_concentration.data(), number_of_cells },
+              { concentrations.data(), concentrations.size() },
+              forward,
+              reverse);
+        });
+    double difference = std::max(LargestRelativeDifference(scalar_forward, forward), LargestRelativeDifference(scalar_reverse, reverse));
+    Report("HenrysLaw", scalar_seconds, batch_seconds, difference);
+  }
+
+  return 0;
+}
@@ -22,4 +22,21 @@ FetchContent_Declare(yaml
     GIT_REPOSITORY https://github.com/jbeder/yaml-cpp.git
     GIT_TAG 0.8.0
 )
-FetchContent_MakeAvailable(yaml)
\ No newline at end of file
+FetchContent_MakeAvailable(yaml)
+
+################################################################################
+# threads, for parsing reactions in parallel
+
+find_package(Threads REQUIRED)
+
+################################################################################
+# compression libraries, for reading compressed configurations. Each format is
+# only supported when its library is found.
+
+if(OPEN_ATMOS_ENABLE_COMPRESSION)
+  find_package(ZLIB)
+
+  include(${PROJECT_SOURCE_DIR}/cmake/find_zstd.cmake)
+
+  message(STATUS "Compressed input: gzip ${ZLIB_FOUND}, zstd ${ZSTD_FOUND}")
+endif()
@@ -0,0 +1,35 @@
+# Provides zstd as the zstd::libzstd target and sets ZSTD_FOUND. This is used both
+# when building and by the installed package, so the exported library refers to the
+# target rather than to where zstd was on the build machine.
+
+if(NOT TARGET zstd::libzstd)
+  find_package(zstd CONFIG QUIET)
+endif()
+
+# zstd does not always install a CMake package, and older ones only export the
+# shared and static libraries separately, so look for it directly as a fallback
+if(NOT TARGET zstd::libzstd)
+  if(TARGET zstd::libzstd_shared)
+    add_library(zstd::libzstd INTERFACE IMPORTED)
+    target_link_libraries(zstd::libzstd INTERFACE zstd::libzstd_shared)
+  elseif(TARGET zstd::libzstd_static)
+    add_library(zstd::libzstd INTERFACE IMPORTED)
+    target_link_libraries(zstd::libzstd INTERFACE zstd::libzstd_static)
+  else()
+    find_path(ZSTD_INCLUDE_DIR zstd.h)
+    find_library(ZSTD_LIBRARY NAMES zstd)
+    if(ZSTD_INCLUDE_DIR AND ZSTD_LIBRARY)
+      add_library(zstd::libzstd UNKNOWN IMPORTED)
+      set_target_properties(zstd::libzstd PROPERTIES
+        IMPORTED_LOCATION "${ZSTD_LIBRARY}"
+        INTERFACE_INCLUDE_DIRECTORIES "${ZSTD_INCLUDE_DIR}"
+      )
+    endif()
+  endif()
+endif()
+
+if(TARGET zstd::libzstd)
+  set(ZSTD_FOUND TRUE)
+else()
+  set(ZSTD_FOUND FALSE)
+endif()
@@ -0,0 +1,166 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <open_atmos/mechanism_configuration/mechanism_view.hpp>
+#include <open_atmos/types.hpp>
+#include <vector>
+
+namespace open_atmos
+{
+  namespace mechanism_configuration
+  {
+    /// @brief The number of enumerators in types::ReactionType
+    static constexpr std::size_t number_of_reaction_types = 14;
+    static_assert(static_cast<std::size_t>(types::ReactionType::Tunneling) + 1 == number_of_reaction_types);
+
+    namespace compiled
+    {
+      /// @brief The reactions of one type, as positions in the canonical reaction order
+      struct ReactionRange
+      {
+        std::size_t begin;
+        std::size_t end;
+
+        std::size_t size() const
+        {
+          return end - begin;
+        }
+      };
+
+      /// @brief One list of reaction components per reaction, in compressed sparse row form. The components of reaction
+      ///        r are at positions offsets[r] to offsets[r + 1] of species and coefficients.
+      struct ComponentLists
+      {
+        std::vector<std::uint32_t> offsets;
+        std::vector<types::SymbolId> species;
+        std::vector<double> coefficients;
+
+        Span<types::SymbolId> Species(std::size_t reaction) const
+        {
+          return { species.data() + offsets[reaction], static_cast<std::size_t>(offsets[reaction + 1] - offsets[reaction]) };
+        }
+
+        Span<double> Coefficients(std::size_t reaction) const
+        {
+          return { coefficients.data() + offsets[reaction], static_cast<std::size_t>(offsets[reaction + 1] - offsets[reaction]) };
+        }
+      };
+
+      /// @brief Arrhenius and CondensedPhaseArrhenius parameters
+      struct ArrheniusParameters
+      {
+        std::vector<double> A;
+        std::vector<double> B;
+        std::vector<double> C;
+        std::vector<double> D;
+        std::vector<double> E;
+      };
+
+      struct TroeParameters
+      {
+        std::vector<double> k0_A;
+        std::vector<double> k0_B;
+        std::vector<double> k0_C;
+        std::vector<double> kinf_A;
+        std::vector<double> kinf_B;
+        std::vector<double> kinf_C;
+        std::vector<double> Fc;
+        std::vector<double> N;
+      };
+
+      struct BranchedParameters
+      {
+        std::vector<double> X;
+        std::vector<double> Y;
+        std::vector<double> a0;
+        std::vector<int> n;
+      };
+
+      struct TunnelingParameters
+      {
+        std::vector<double> A;
+        std::vector<double> B;
+        std::vector<double> C;
+      };
+
+      /// @brief The SIMPOL.1 parameters B0 to B3
+      struct SimpolParameters
+      {
+        std::vector<double> B0;
+        std::vector<double> B1;
+        std::vector<double> B2;
+        std::vector<double> B3;
+      };
+
+      struct AqueousEquilibriumParameters
+      {
+        std::vector<double> A;
+        std::vector<double> C;
+        std::vector<double> k_reverse;
+      };
+    }  // namespace compiled
+
+    /// @brief A mechanism laid out for solvers. Reactions are numbered in the canonical order, which is every reaction of
+    ///        each type in the order of the lists in types::Reactions (the order of types::ReactionType). The reactions of
+    ///        each type are contiguous, so the parameters of the i-th reaction of a type are at position i of that type's
+    ///        arrays and its reaction number is Range(type).begin + i.
+    ///
+    ///        Reactant and product lists follow the conventions of flat::Reaction: the gas and aerosol species of a
+    ///        SimpolPhaseTransfer or HenrysLaw reaction are its reactant and product, the gas species of a Surface
+    ///        reaction is its reactant, and a Branched reaction has its nitrate products as products and its alkoxy
+    ///        products as alternative products.
+    struct CompiledMechanism
+    {
+      std::size_t number_of_species{ 0 };
+      std::size_t number_of_reactions{ 0 };
+
+      /// @brief Where the reactions of each type start, indexed by types::ReactionType, followed by number_of_reactions
+      std::array<std::size_t, number_of_reaction_types + 1> type_offsets{};
+
+      /// @brief The type of each reaction
+      std::vector<types::ReactionType> types;
+      /// @brief The phases of each reaction, or types::unknown_symbol where a type has no such phase
+      std::vector<types::SymbolId> gas_phase;
+      std::vector<types::SymbolId> aerosol_phase;
+      std::vector<types::SymbolId> aerosol_phase_water;
+
+      compiled::ComponentLists reactants;
+      compiled::ComponentLists products;
+      /// @brief The alkoxy products of Branched reactions; empty for every other reaction
+      compiled::ComponentLists alternative_products;
+
+      compiled::ArrheniusParameters arrhenius;
+      compiled::BranchedParameters branched;
+      compiled::ArrheniusParameters condensed_phase_arrhenius;
+      /// @brief The scaling factors of the reactions whose rates are supplied by the user
+      std::vector<double> condensed_phase_photolysis;
+      std::vector<double> emission;
+      std::vector<double> first_order_loss;
+      compiled::SimpolParameters simpol_phase_transfer;
+      compiled::AqueousEquilibriumParameters aqueous_equilibrium;
+      std::vector<double> wet_deposition;
+      std::vector<double> photolysis;
+      /// @brief The reaction probability of each Surface reaction
+      std::vector<double> surface;
+      compiled::TroeParameters troe;
+      compiled::TunnelingParameters tunneling;
+
+      /// @brief The reactions of one type
+      compiled::ReactionRange Range(types::ReactionType type) const
+      {
+        std::size_t position = static_cast<std::size_t>(type);
+        return { type_offsets[position], type_offsets[position + 1] };
+      }
+    };
+
+    /// @brief Lays out a mechanism for solvers. Species identifiers are used as they are, so for a mechanism that parsed
+    ///        successfully species are numbered by their position in Mechanism::species.
+    CompiledMechanism Compile(const types::Mechanism& mechanism);
+  }  // namespace mechanism_configuration
+}  // namespace open_atmos
@@ -0,0 +1,100 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <streambuf>
+#include <string_view>
+#include <vector>
+
+namespace open_atmos
+{
+  namespace mechanism_configuration
+  {
+    /// @brief The text formats a configuration can be written in
+    enum class InputFormat
+    {
+      Json,
+      Yaml
+    };
+
+    /// @brief The compressed encodings a configuration file can be stored in
+    enum class Compression
+    {
+      None,
+      Gzip,
+      Zstd
+    };
+
+    /// @brief The format implied by a .json, .yaml or .yml extension, if the extension is one of those
+    std::optional<InputFormat> FormatFromExtension(const std::filesystem::path& extension);
+
+    /// @brief Decides how to read a configuration. A .json, .yaml or .yml extension decides on its own; otherwise text
+    ///        whose first character after any whitespace and byte order mark is '{' or '[' is read as JSON and anything
+    ///        else as YAML. JSON that turns out not to be strict JSON is still handed to the YAML reader.
+    /// @param contents The start of the configuration text, which only needs to reach its first significant character
+    /// @param extension The extension of the file the text came from, if any
+    InputFormat DetectFormat(std::string_view contents, const std::filesystem::path& extension = {});
+
+    /// @brief True for the characters DetectFormat skips before the first significant character
+    bool IsLeadingFiller(char c);
+
+    /// @brief A read-only stream buffer over text owned by someone else, so that a buffer can be handed to
+    ///        stream-based readers without copying it. The text must outlive the buffer.
+    class MemoryStreamBuffer : public std::streambuf
+    {
+     public:
+      explicit MemoryStreamBuffer(std::string_view contents);
+
+     protected:
+      pos_type seekoff(off_type offset, std::ios_base::seekdir direction, std::ios_base::openmode which) override;
+      pos_type seekpos(pos_type position, std::ios_base::openmode which) override;
+    };
+
+    /// @brief Recognizes gzip and zstd data from their leading magic numbers
+    Compression DetectCompression(std::string_view contents);
+
+    /// @brief True if the library was built with the decompressor for an encoding. gzip needs zlib and zstd needs
+    ///        libzstd when the library is configured.
+    bool IsCompressionSupported(Compression compression);
+
+    /// @brief A read-only stream buffer that decompresses gzip or zstd data held in memory as it is read, so that only
+    ///        one block of the decompressed text exists at a time. The compressed data must outlive the buffer.
+    ///
+    ///        Seeking is limited to asking for the current position and rewinding to the start, which restarts the
+    ///        decompression. Damaged or truncated data ends the stream early and sets Failed.
+    class DecompressingStreamBuffer : public std::streambuf
+    {
+     public:
+      /// @brief Decompresses data in an encoding for which IsCompressionSupported is true
+      DecompressingStreamBuffer(std::string_view compressed, Compression compression);
+      ~DecompressingStreamBuffer() override;
+
+      DecompressingStreamBuffer(const DecompressingStreamBuffer&) = delete;
+      DecompressingStreamBuffer& operator=(const DecompressingStreamBuffer&) = delete;
+
+      /// @brief True once damaged or truncated compressed data has been found
+      bool Failed() const;
+
+      /// @brief Decodes one encoding; defined next to the library that implements it
+      class Decoder;
+
+     protected:
+      int_type underflow() override;
+      pos_type seekoff(off_type offset, std::ios_base::seekdir direction, std::ios_base::openmode which) override;
+      pos_type seekpos(pos_type position, std::ios_base::openmode which) override;
+
+     private:
+      std::unique_ptr<Decoder> decoder_;
+      std::vector<char> block_;
+      /// @brief The number of decompressed bytes before the current block
+      std::uint64_t block_start_{ 0 };
+      bool failed_{ false };
+    };
+  }  // namespace mechanism_configuration
+}  // namespace open_atmos
@@ -0,0 +1,52 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+#include <open_atmos/mechanism_configuration/compiled_mechanism.hpp>
+#include <open_atmos/mechanism_configuration/sparse_matrix.hpp>
+#include <open_atmos/mechanism_configuration/stoichiometry.hpp>
+#include <open_atmos/types.hpp>
+#include <vector>
+
+namespace open_atmos
+{
+  namespace mechanism_configuration
+  {
+    /// @brief Appends the species the rate of a reaction depends on. These are its reactants, its products too for the
+    ///        reversible phase transfer and equilibrium reactions, and the aerosol water that condensed-phase rates are
+    ///        normalized by. Species that are not in the mechanism are left out; a species may be appended more than once.
+    void AppendRateDependencies(const CompiledMechanism& compiled, std::size_t reaction, std::vector<std::uint32_t>& species);
+
+    /// @brief The non-zero pattern of d(f_i)/d(y_j), where f is the net production of each species, in compressed sparse
+    ///        row form with species identifiers as rows and columns. Entry (i, j) is present when a reaction whose rate
+    ///        depends on j changes the amount of i, and every diagonal entry is present.
+    SparsityPattern BuildJacobianPattern(const CompiledMechanism& compiled, const StoichiometryMatrix& stoichiometry);
+
+    struct JacobianOptions
+    {
+      /// @brief Number the species phase by phase, so that the Jacobian is a grid of blocks with the coupling within a
+      ///        phase on the diagonal blocks and phase transfer in the off-diagonal blocks
+      bool block_by_phase{ false };
+    };
+
+    /// @brief A Jacobian pattern whose rows and columns may be in an order other than that of the species identifiers
+    struct JacobianPattern
+    {
+      /// @brief The pattern, with rows and columns numbered by position in species_order
+      SparsityPattern pattern;
+      /// @brief The species identifier at each position
+      std::vector<std::uint32_t> species_order;
+      /// @brief The first position of each block, followed by the number of species
+      std::vector<std::uint32_t> block_offsets;
+      /// @brief The phase of each block. With block_by_phase, each species is placed in the first phase that lists it,
+      ///        and species in no phase form a last block whose phase is types::unknown_symbol. Without it there is one
+      ///        block, whose phase is types::unknown_symbol.
+      std::vector<types::SymbolId> block_phases;
+    };
+
+    JacobianPattern BuildJacobianPattern(const types::Mechanism& mechanism, const JacobianOptions& options = {});
+  }  // namespace mechanism_configuration
+}  // namespace open_atmos
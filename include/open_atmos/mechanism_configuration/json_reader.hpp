@@ -0,0 +1,94 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <yaml-cpp/yaml.h>
+
+#include <istream>
+#include <string>
+#include <vector>
+
+namespace open_atmos
+{
+  namespace mechanism_configuration
+  {
+    /// @brief Receives the events produced by a JsonReader, in document order
+    class IJsonHandler
+    {
+     public:
+      virtual void StartObject() = 0;
+      virtual void EndObject() = 0;
+      virtual void StartArray() = 0;
+      virtual void EndArray() = 0;
+      virtual void Key(const std::string& key) = 0;
+      virtual void String(const std::string& value) = 0;
+      /// @brief A number, passed on as it was written so that no precision is lost before conversion
+      virtual void Number(const std::string& value) = 0;
+      virtual void Boolean(bool value) = 0;
+      virtual void Null() = 0;
+      virtual ~IJsonHandler() = default;
+    };
+
+    /// @brief An event-driven JSON reader that never holds more than the current token in memory
+    class JsonReader
+    {
+     public:
+      explicit JsonReader(std::istream& input);
+
+      /// @brief Reads one JSON document, reporting each value to the handler as it is read
+      /// @throws YAML::ParserException if the input is not valid JSON
+      void Read(IJsonHandler& handler);
+
+     private:
+      void ReadValue(IJsonHandler& handler);
+      void ReadObject(IJsonHandler& handler);
+      void ReadArray(IJsonHandler& handler);
+      std::string ReadString();
+      std::string ReadNumber();
+      void ReadLiteral(const char* literal);
+      void SkipWhitespace();
+      void Expect(char expected);
+      int Peek();
+      int Get();
+      [[noreturn]] void Fail(const std::string& message) const;
+
+      std::streambuf* buffer_;
+      YAML::Mark mark_;
+    };
+
+    /// @brief Builds a YAML node from a stream of JSON events, equivalent to the node YAML::Load would produce
+    class JsonNodeBuilder : public IJsonHandler
+    {
+     public:
+      void StartObject() override;
+      void EndObject() override;
+      void StartArray() override;
+      void EndArray() override;
+      void Key(const std::string& key) override;
+      void String(const std::string& value) override;
+      void Number(const std::string& value) override;
+      void Boolean(bool value) override;
+      void Null() override;
+
+      /// @brief Whether a complete value has been built
+      bool Complete() const;
+      /// @brief Returns the completed value and prepares the builder for the next one
+      YAML::Node Take();
+
+     private:
+      struct Frame
+      {
+        YAML::Node node;
+        std::string key;
+      };
+
+      void Add(const YAML::Node& value);
+
+      std::vector<Frame> stack_;
+      YAML::Node root_;
+      bool complete_{ false };
+    };
+  }  // namespace mechanism_configuration
+}  // namespace open_atmos
@@ -0,0 +1,50 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <open_atmos/mechanism_configuration/parse_status.hpp>
+#include <string_view>
+#include <utility>
+
+namespace open_atmos
+{
+  namespace mechanism_configuration
+  {
+    /// @brief A file mapped read-only into memory for as long as the object lives
+    class MappedFile
+    {
+     public:
+      MappedFile() = default;
+      MappedFile(const MappedFile&) = delete;
+      MappedFile& operator=(const MappedFile&) = delete;
+      MappedFile(MappedFile&& other) noexcept;
+      MappedFile& operator=(MappedFile&& other) noexcept;
+      ~MappedFile();
+
+      /// @brief Maps a file. An empty file is mapped to an empty range.
+      /// @return A pair containing the status and the mapping. The status is InvalidFilePath if the file cannot be
+      ///         opened or mapped, which includes pipes and other files that are not regular files.
+      static std::pair<ConfigParseStatus, MappedFile> Open(const std::filesystem::path& file_path);
+
+      const std::byte* Data() const;
+
+      std::size_t Size() const;
+
+      /// @brief The mapped bytes as text
+      std::string_view Contents() const;
+
+     private:
+      void Unmap();
+
+      void* address_{ nullptr };
+      std::size_t size_{ 0 };
+#ifdef _WIN32
+      void* handle_{ nullptr };
+#endif
+    };
+  }  // namespace mechanism_configuration
+}  // namespace open_atmos
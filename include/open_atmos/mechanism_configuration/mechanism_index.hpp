@@ -0,0 +1,59 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <open_atmos/symbol_table.hpp>
+#include <open_atmos/types.hpp>
+#include <string_view>
+#include <vector>
+
+namespace open_atmos
+{
+  namespace mechanism_configuration
+  {
+    /// @brief Resolves species and phase names to their identifiers in constant time. It is built once the species are
+    ///        parsed, extended once the phases are parsed, and then shared by every reaction parser.
+    ///
+    ///        The index interns the names into the symbol tables that the parsed mechanism keeps. It refers to, but does
+    ///        not own, the species and phases it was built from, so those must outlive it. When a name appears more than
+    ///        once, every definition shares the identifier of the first.
+    class MechanismIndex
+    {
+     public:
+      explicit MechanismIndex(const std::vector<types::Species>& species);
+
+      /// @brief Adds the phases, and the species each of them contains, to the index
+      void IndexPhases(const std::vector<types::Phase>& phases);
+
+      /// @brief Returns the identifier of the named species, or types::unknown_symbol if it is not defined
+      types::SymbolId FindSpecies(std::string_view name) const;
+
+      /// @brief Returns the identifier of the named phase, or types::unknown_symbol if it is not defined
+      types::SymbolId FindPhase(std::string_view name) const;
+
+      /// @brief Whether the phase contains the species
+      bool PhaseContains(types::SymbolId phase, types::SymbolId species) const;
+
+      /// @brief Whether any of the requested species are not defined in the mechanism
+      bool RequiresUnknownSpecies(const std::vector<types::SymbolId>& requested_species) const;
+
+      /// @brief Whether any of the requested species are not part of the phase
+      bool RequiresSpeciesOutsidePhase(const std::vector<types::SymbolId>& requested_species, types::SymbolId phase) const;
+
+      const std::vector<types::Species>& Species() const;
+      const std::vector<types::Phase>& Phases() const;
+      const types::SymbolTable& SpeciesSymbols() const;
+      const types::SymbolTable& PhaseSymbols() const;
+
+     private:
+      const std::vector<types::Species>* species_;
+      const std::vector<types::Phase>* phases_;
+      types::SymbolTable species_symbols_;
+      types::SymbolTable phase_symbols_;
+      /// @brief For each phase identifier, whether each species identifier is part of the phase
+      std::vector<std::vector<bool>> phase_species_;
+    };
+  }  // namespace mechanism_configuration
+}  // namespace open_atmos
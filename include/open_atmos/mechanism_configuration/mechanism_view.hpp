@@ -0,0 +1,240 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <open_atmos/mechanism_configuration/mapped_file.hpp>
+#include <open_atmos/mechanism_configuration/parse_status.hpp>
+#include <open_atmos/types.hpp>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace open_atmos
+{
+  namespace mechanism_configuration
+  {
+    /// @brief The version of the flat layout written by Flatten
+    static constexpr std::uint32_t flat_format_version = 1;
+
+    /// @brief A read-only view of a contiguous sequence of T
+    template<typename T>
+    class Span
+    {
+     public:
+      Span() = default;
+
+      Span(const T* data, std::size_t size)
+          : data_(data),
+            size_(size)
+      {
+      }
+
+      const T* begin() const
+      {
+        return data_;
+      }
+
+      const T* end() const
+      {
+        return data_ + size_;
+      }
+
+      const T* data() const
+      {
+        return data_;
+      }
+
+      std::size_t size() const
+      {
+        return size_;
+      }
+
+      bool empty() const
+      {
+        return size_ == 0;
+      }
+
+      const T& operator[](std::size_t i) const
+      {
+        return data_[i];
+      }
+
+     private:
+      const T* data_{ nullptr };
+      std::size_t size_{ 0 };
+    };
+
+    /// @brief The fixed-size records of the flat layout. They are stored in native byte order and are used in place, so
+    ///        every field is a fixed-width type at its natural alignment.
+    namespace flat
+    {
+      /// @brief A sequence of elements in one of the sections of the file
+      struct Range
+      {
+        std::uint32_t offset;
+        std::uint32_t size;
+      };
+
+      /// @brief A string in the string pool
+      using StringRef = Range;
+
+      struct Property
+      {
+        StringRef key;
+        double value;
+      };
+
+      struct Species
+      {
+        StringRef name;
+        /// @brief The optional numerical properties, in key order
+        Range properties;
+      };
+
+      struct Phase
+      {
+        StringRef name;
+        /// @brief The identifiers of the species in the phase
+        Range species;
+      };
+
+      struct Component
+      {
+        types::SymbolId species_id;
+        std::uint32_t reserved;
+        double coefficient;
+      };
+
+      /// @brief The most parameters any kind of reaction has (Troe)
+      static constexpr std::size_t max_parameters = 8;
+
+      /// @brief A reaction of any kind.
+      ///
+      ///        The parameters are stored in the order they are declared in the corresponding types:: struct (Branched::n
+      ///        as a double). Species that are single components in types:: are stored as one-element lists: the gas and
+      ///        aerosol species of SimpolPhaseTransfer and HenrysLaw are the reactant and product, and the gas species of
+      ///        Surface is the reactant. Branched stores its nitrate products as products and its alkoxy products as
+      ///        alternative_products.
+      struct Reaction
+      {
+        types::ReactionType type;
+        types::SymbolId gas_phase;
+        types::SymbolId aerosol_phase;
+        types::SymbolId aerosol_phase_water;
+        StringRef name;
+        Range reactants;
+        Range products;
+        Range alternative_products;
+        std::uint32_t number_of_parameters;
+        std::uint32_t reserved;
+        double parameters[max_parameters];
+      };
+
+      static_assert(std::is_trivially_copyable_v<Reaction> && sizeof(Reaction) == 120);
+      static_assert(std::is_trivially_copyable_v<Component> && sizeof(Component) == 16);
+    }  // namespace flat
+
+    /// @brief Lays a mechanism out as a file that MechanismView can use in place.
+    ///
+    ///        The file is a header followed by sections for strings, species, properties, phases, phase species,
+    ///        reaction components and reactions, each aligned to 8 bytes. Reactions are in the order of the lists in
+    ///        types::Reactions. Unknown properties are not included; use Serialize when they are needed.
+    std::vector<std::byte> Flatten(const types::Mechanism& mechanism);
+
+    /// @brief A read-only mechanism that is used directly from a file written by Flatten, without decoding it.
+    ///
+    ///        Opening a file maps it into memory and only checks the header, so it takes the same time for any size of
+    ///        mechanism, and processes that open the same file share its pages. Ranges stored in records are checked as
+    ///        they are followed, and a range that does not fit in its section is returned as empty.
+    class MechanismView
+    {
+     public:
+      MechanismView() = default;
+      MechanismView(const MechanismView&) = delete;
+      MechanismView& operator=(const MechanismView&) = delete;
+      MechanismView(MechanismView&& other) noexcept;
+      MechanismView& operator=(MechanismView&& other) noexcept;
+
+      /// @brief Maps a file written by Flatten
+      /// @return A pair containing the status and view. The status is InvalidFilePath if the file cannot be opened,
+      ///         InvalidBinaryFormat if it is not a flat mechanism, and UnsupportedBinaryVersion if it was written in
+      ///         another format version.
+      static std::pair<ConfigParseStatus, MechanismView> Open(const std::filesystem::path& file_path);
+
+      /// @brief Views a buffer written by Flatten. The buffer must be aligned to 8 bytes and outlive the view.
+      static std::pair<ConfigParseStatus, MechanismView> FromBuffer(const std::byte* data, std::size_t size);
+
+      std::string_view Name() const;
+
+      /// @brief The species, indexed by their identifiers
+      Span<flat::Species> Species() const;
+
+      /// @brief The phases, indexed by their identifiers
+      Span<flat::Phase> Phases() const;
+
+      Span<flat::Reaction> Reactions() const;
+
+      std::string_view String(flat::StringRef string) const;
+
+      Span<flat::Property> Properties(const flat::Species& species) const;
+
+      Span<types::SymbolId> PhaseSpecies(const flat::Phase& phase) const;
+
+      Span<flat::Component> Components(flat::Range components) const;
+
+      Span<double> Parameters(const flat::Reaction& reaction) const;
+
+     private:
+      /// @brief The offset and number of records of each section
+      struct Section
+      {
+        std::uint64_t offset;
+        std::uint64_t size;
+      };
+
+      enum SectionId
+      {
+        StringSection,
+        SpeciesSection,
+        PropertySection,
+        PhaseSection,
+        PhaseSpeciesSection,
+        ComponentSection,
+        ReactionSection,
+        NumberOfSections
+      };
+
+      friend std::vector<std::byte> Flatten(const types::Mechanism& mechanism);
+
+      struct Header
+      {
+        std::uint32_t magic;
+        std::uint32_t version;
+        std::uint64_t file_size;
+        flat::StringRef name;
+        Section sections[NumberOfSections];
+      };
+
+      ConfigParseStatus Attach(const std::byte* data, std::size_t size);
+
+      /// @brief The records in part of a section, or none if the range does not fit in the section
+      template<typename T>
+      Span<T> Records(SectionId section, flat::Range range) const;
+
+      template<typename T>
+      Span<T> Records(SectionId section) const;
+
+      const std::byte* data_{ nullptr };
+      std::size_t size_{ 0 };
+      const Header* header_{ nullptr };
+      /// @brief The mapping owned by the view, which is empty when it views a caller's buffer
+      MappedFile mapping_;
+    };
+  }  // namespace mechanism_configuration
+}  // namespace open_atmos
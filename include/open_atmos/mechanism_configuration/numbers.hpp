@@ -0,0 +1,28 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <yaml-cpp/yaml.h>
+
+#include <open_atmos/mechanism_configuration/parse_status.hpp>
+#include <string_view>
+
+namespace open_atmos
+{
+  namespace mechanism_configuration
+  {
+    /// @brief Converts the text of a number without going through a stream, so that the result does not depend on the
+    ///        global locale.
+    ///
+    ///        Accepts decimal and scientific notation with an optional sign, as well as the YAML spellings of infinity
+    ///        (.inf, .Inf, .INF, optionally signed) and not-a-number (.nan, .NaN, .NAN).
+    /// @return Whether the whole text is a number that fits in a double
+    bool ParseNumber(std::string_view text, double& value);
+
+    /// @brief Converts a scalar node to a number, and reports the node if it is not one
+    /// @return InvalidNumericValue if the node is not a number, otherwise Success
+    ConfigParseStatus DecodeNumber(const YAML::Node& node, double& value);
+  }  // namespace mechanism_configuration
+}  // namespace open_atmos
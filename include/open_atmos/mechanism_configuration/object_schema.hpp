@@ -0,0 +1,192 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <yaml-cpp/yaml.h>
+
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <open_atmos/mechanism_configuration/numbers.hpp>
+#include <open_atmos/mechanism_configuration/parse_status.hpp>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace open_atmos
+{
+  namespace mechanism_configuration
+  {
+    enum class FieldPresence
+    {
+      Required,
+      Optional
+    };
+
+    /// @brief A key that an object of type T may have
+    template<typename T>
+    struct FieldDescriptor
+    {
+      std::string_view key;
+      FieldPresence presence;
+      /// @brief Stores the value of the key in the decoded object, or nullptr when the parser reads the value itself
+      ConfigParseStatus (*decode)(const YAML::Node& value, T& decoded) = nullptr;
+    };
+
+    template<typename>
+    struct MemberTraits;
+
+    template<typename T, typename V>
+    struct MemberTraits<V T::*>
+    {
+      using Object = T;
+      using Value = V;
+    };
+
+    /// @brief A FieldDescriptor::decode that converts the value to the type of the member and assigns it. Numbers are
+    ///        converted with DecodeNumber.
+    template<auto Member>
+    ConfigParseStatus DecodeMember(const YAML::Node& value, typename MemberTraits<decltype(Member)>::Object& decoded)
+    {
+      using Value = typename MemberTraits<decltype(Member)>::Value;
+      if constexpr (std::is_arithmetic_v<Value> && !std::is_same_v<Value, bool>)
+      {
+        double number = 0;
+        ConfigParseStatus status = DecodeNumber(value, number);
+        decoded.*Member = static_cast<Value>(number);
+        return status;
+      }
+      else
+      {
+        decoded.*Member = value.as<Value>();
+        return ConfigParseStatus::Success;
+      }
+    }
+
+    /// @brief Every key an object of type T may have. A key is identified by its position in the table.
+    template<typename T, std::size_t N>
+    struct ObjectSchema
+    {
+      std::array<FieldDescriptor<T>, N> fields;
+
+      /// @brief Returns the position of the key, or N if it is not part of the schema
+      std::size_t Find(std::string_view key) const
+      {
+        // schemas have at most a few dozen keys, so a scan is cheaper than hashing the key
+        for (std::size_t i = 0; i < N; ++i)
+        {
+          if (fields[i].key == key)
+          {
+            return i;
+          }
+        }
+        return N;
+      }
+    };
+
+    /// @brief The values of the keys of an object, by their position in its schema
+    template<std::size_t N>
+    class ObjectFields
+    {
+     public:
+      bool Has(std::size_t field) const
+      {
+        return present_[field];
+      }
+
+      const YAML::Node& operator[](std::size_t field) const
+      {
+        return values_[field];
+      }
+
+      void Set(std::size_t field, const YAML::Node& value)
+      {
+        values_[field] = value;
+        present_[field] = true;
+      }
+
+     private:
+      std::array<YAML::Node, N> values_;
+      std::bitset<N> present_;
+    };
+
+    /// @brief Formats the value of an unknown property the way it is stored in unknown_properties
+    std::string FormatUnknownProperty(const YAML::Node& value);
+
+    void ReportMissingKey(std::string_view key, const YAML::Node& object);
+
+    void ReportInvalidKey(std::string_view key, const YAML::Node& object);
+
+    /// @brief Validates, extracts and collects the comments of an object in a single pass over its keys.
+    ///
+    ///        Keys that are missing from the schema are an error unless they contain two underscores (__), and those
+    ///        starting with two underscores are collected into decoded.unknown_properties. Values are only converted once
+    ///        the whole object has been validated, and a null object is accepted as empty.
+    /// @return RequiredKeyNotFound if any required key is missing, InvalidKey for an unexpected key, the status of the
+    ///         first value that could not be converted, otherwise Success
+    template<typename T, std::size_t N>
+    ConfigParseStatus DecodeObject(const YAML::Node& object, const ObjectSchema<T, N>& schema, T& decoded, ObjectFields<N>& fields)
+    {
+      if (!object || object.IsNull())
+      {
+        return ConfigParseStatus::Success;
+      }
+
+      std::optional<std::string> invalid_key;
+      for (const auto& entry : object)
+      {
+        const std::string& key = entry.first.Scalar();
+        std::size_t field = schema.Find(key);
+        if (field < N)
+        {
+          fields.Set(field, entry.second);
+        }
+        else if (key.compare(0, 2, "__") == 0)
+        {
+          decoded.unknown_properties[key] = FormatUnknownProperty(entry.second);
+        }
+        else if (!invalid_key && key.find("__") == std::string::npos)
+        {
+          invalid_key = key;
+        }
+      }
+
+      bool missing = false;
+      for (std::size_t i = 0; i < N; ++i)
+      {
+        if (schema.fields[i].presence == FieldPresence::Required && !fields.Has(i))
+        {
+          ReportMissingKey(schema.fields[i].key, object);
+          missing = true;
+        }
+      }
+      if (missing)
+      {
+        return ConfigParseStatus::RequiredKeyNotFound;
+      }
+      if (invalid_key)
+      {
+        ReportInvalidKey(*invalid_key, object);
+        return ConfigParseStatus::InvalidKey;
+      }
+
+      ConfigParseStatus status = ConfigParseStatus::Success;
+      for (std::size_t i = 0; i < N; ++i)
+      {
+        if (schema.fields[i].decode != nullptr && fields.Has(i))
+        {
+          ConfigParseStatus field_status = schema.fields[i].decode(fields[i], decoded);
+          if (status == ConfigParseStatus::Success)
+          {
+            status = field_status;
+          }
+        }
+      }
+
+      return status;
+    }
+  }  // namespace mechanism_configuration
+}  // namespace open_atmos
@@ -0,0 +1,56 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <open_atmos/types.hpp>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace open_atmos
+{
+  namespace mechanism_configuration
+  {
+    /// @brief A directory of parsed mechanisms, stored in the Serialize format and named by a hash of the text they were
+    ///        parsed from.
+    ///
+    ///        Entries are written to a temporary file and renamed into place, so concurrent writers never expose a
+    ///        partial entry and readers see either no entry or a whole one. Once the entries take more than the size
+    ///        limit, the least recently used ones are removed. Temporary files count toward the limit, and those left
+    ///        behind long ago by a write that never finished are removed. Problems with the directory never fail a
+    ///        parse; they only make the cache miss.
+    class ParseCache
+    {
+     public:
+      /// @brief The default limit on the total size of the entries, in bytes
+      static constexpr std::uintmax_t default_max_size = 256 * 1024 * 1024;
+
+      ParseCache(std::filesystem::path directory, std::uintmax_t max_size = default_max_size);
+
+      /// @brief Builds the key of a configuration from its text and anything else that changes how it is parsed
+      /// @param contents The text of the configuration
+      /// @param salt The parser version and the file extension
+      static std::string Key(std::string_view contents, std::string_view salt);
+
+      /// @brief Returns the mechanism stored under the key, if there is a valid entry for it
+      std::optional<types::Mechanism> Load(const std::string& key) const;
+
+      /// @brief Stores a mechanism under the key and evicts old entries if the cache has grown past its limit
+      void Store(const std::string& key, const types::Mechanism& mechanism) const;
+
+      const std::filesystem::path& Directory() const;
+
+     private:
+      std::filesystem::path EntryPath(const std::string& key) const;
+
+      void Evict() const;
+
+      std::filesystem::path directory_;
+      std::uintmax_t max_size_;
+    };
+  }  // namespace mechanism_configuration
+}  // namespace open_atmos
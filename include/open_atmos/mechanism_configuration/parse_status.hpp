@@ -28,7 +28,15 @@ namespace open_atmos
       UnknownPhase,
       RequestedAerosolSpeciesNotIncludedInAerosolPhase,
       TooManyReactionComponents,
-      InvalidIonPair
+      InvalidIonPair,
+      InvalidBinaryFormat,
+      UnsupportedBinaryVersion,
+      BinaryChecksumMismatch,
+      InvalidNumericValue,
+      CompressionNotSupported,
+      DecompressionFailed,
+      MissingSpeciesProperty,
+      InvalidSpeciesOrder
     };
     std::string configParseStatusToString(const ConfigParseStatus &status);
 
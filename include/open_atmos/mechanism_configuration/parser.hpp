@@ -6,13 +6,18 @@
 
 #include <yaml-cpp/yaml.h>
 
+#include <cstdint>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <open_atmos/mechanism_configuration/input_source.hpp>
+#include <open_atmos/mechanism_configuration/parse_cache.hpp>
 #include <open_atmos/mechanism_configuration/parse_status.hpp>
 #include <open_atmos/mechanism_configuration/utils.hpp>
 #include <open_atmos/types.hpp>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -29,8 +34,11 @@ namespace open_atmos
       /// @return A pair containing the parsing status and mechanism
       std::pair<ConfigParseStatus, types::Mechanism> Parse(const YAML::Node& node);
 
-      /// @brief Reads a configuration from a file path
-      /// @param file_path A path to single YAML configuration
+      /// @brief Reads a configuration from a file path. The file is mapped into memory rather than copied, and is read
+      ///        as JSON or YAML depending on its extension or, without a known extension, its first character. gzip and
+      ///        zstd files are decompressed as they are read, when the library was built with zlib or libzstd; the
+      ///        format then comes from the extension before .gz or .zst (mechanism.json.gz is JSON).
+      /// @param file_path A path to single JSON or YAML configuration
       /// @return A pair containing the parsing status and mechanism
       std::pair<ConfigParseStatus, types::Mechanism> Parse(const std::filesystem::path& file_path);
 
@@ -38,6 +46,60 @@ namespace open_atmos
       /// @param file_path A path to single YAML configuration
       /// @return A pair containing the parsing status and mechanism
       std::pair<ConfigParseStatus, types::Mechanism> Parse(const std::string& file_path);
+
+      /// @brief Reads a configuration from a stream, as JSON if its first character is '{' or '[' and as YAML otherwise.
+      ///        JSON is read as it arrives; the cache is not used for streams.
+      /// @param stream A stream containing a single JSON or YAML configuration
+      /// @return A pair containing the parsing status and mechanism
+      std::pair<ConfigParseStatus, types::Mechanism> Parse(std::istream& stream);
+
+      /// @brief Reads a configuration held in memory, as JSON if its first character is '{' or '[' and as YAML
+      ///        otherwise. The text is not copied, and gzip or zstd data is decompressed as it is read. This is not an
+      ///        overload of Parse because a string passed to Parse is a file path.
+      /// @param contents The text of a single JSON or YAML configuration
+      /// @return A pair containing the parsing status and mechanism
+      std::pair<ConfigParseStatus, types::Mechanism> ParseBuffer(std::string_view contents);
+
+      /// @brief Keeps the mechanisms parsed from files and buffers in a directory, so that parsing the same text again with the same
+      ///        version of the parser only reads the stored mechanism. Only successful parses are stored.
+      /// @param directory The cache directory, which is created when the first mechanism is stored
+      /// @param max_size The size in bytes above which the least recently used mechanisms are removed
+      void EnableCache(const std::filesystem::path& directory, std::uintmax_t max_size = ParseCache::default_max_size);
+
+      void DisableCache();
+
+      /// @brief Sets the number of threads used to parse reactions. The mechanism is the same for any number of threads.
+      /// @param number_of_threads The number of threads, or 0 for one per hardware thread
+      void SetNumberOfThreads(std::size_t number_of_threads);
+
+     private:
+      /// @brief Parses the possibly compressed text of a configuration, going through the cache when it is enabled
+      /// @param contents The text, or gzip or zstd data holding it
+      /// @param file_path The file the text came from, whose extension can decide the format, or an empty path
+      std::pair<ConfigParseStatus, types::Mechanism>
+      ParseContents(std::string_view contents, const std::filesystem::path& file_path);
+
+      /// @brief Parses the text of a configuration, decompressing it as it is read
+      /// @param format The format, or nullopt to decide from the text
+      std::pair<ConfigParseStatus, types::Mechanism>
+      ParseText(std::string_view contents, Compression compression, std::optional<InputFormat> format);
+
+      /// @brief Parses a configuration from a stream
+      /// @param format The format, or nullopt to decide from the first character of the stream
+      std::pair<ConfigParseStatus, types::Mechanism> ParseStream(std::istream& stream, std::optional<InputFormat> format);
+
+      /// @brief Reads a JSON configuration as a stream of events, handing each species, phase and reaction
+      ///        object to its parser as soon as it has been read instead of building the whole document
+      /// @param stream A stream containing a single JSON configuration
+      /// @return A pair containing the parsing status and mechanism
+      /// @throws YAML::ParserException if the stream does not hold strict JSON
+      std::pair<ConfigParseStatus, types::Mechanism> ParseJson(std::istream& stream);
+
+      /// @brief Checks that the requested configuration version is the one this parser supports
+      ConfigParseStatus ValidateVersion(const YAML::Node& object);
+
+      std::optional<ParseCache> cache_;
+      std::size_t number_of_threads_{ 1 };
     };
   }  // namespace mechanism_configuration
 }  // namespace open_atmos
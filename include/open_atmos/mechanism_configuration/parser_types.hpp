@@ -8,7 +8,10 @@
 
 #include <open_atmos/mechanism_configuration/parse_status.hpp>
 #include <open_atmos/mechanism_configuration/utils.hpp>
+#include <map>
+#include <memory>
 #include <open_atmos/types.hpp>
+#include <string>
 #include <vector>
 
 namespace open_atmos
@@ -20,8 +23,7 @@ namespace open_atmos
      public:
       ConfigParseStatus parse(
           const YAML::Node& object,
-          const std::vector<types::Species>& existing_species,
-          const std::vector<types::Phase>& existing_phases,
+          const MechanismIndex& index,
           open_atmos::types::Reactions& reactions) override;
     };
 
@@ -30,8 +32,7 @@ namespace open_atmos
      public:
       ConfigParseStatus parse(
           const YAML::Node& object,
-          const std::vector<types::Species>& existing_species,
-          const std::vector<types::Phase>& existing_phases,
+          const MechanismIndex& index,
           open_atmos::types::Reactions& reactions) override;
     };
 
@@ -40,8 +41,7 @@ namespace open_atmos
      public:
       ConfigParseStatus parse(
           const YAML::Node& object,
-          const std::vector<types::Species>& existing_species,
-          const std::vector<types::Phase>& existing_phases,
+          const MechanismIndex& index,
           open_atmos::types::Reactions& reactions) override;
     };
 
@@ -50,8 +50,7 @@ namespace open_atmos
      public:
       ConfigParseStatus parse(
           const YAML::Node& object,
-          const std::vector<types::Species>& existing_species,
-          const std::vector<types::Phase>& existing_phases,
+          const MechanismIndex& index,
           open_atmos::types::Reactions& reactions) override;
     };
 
@@ -60,8 +59,7 @@ namespace open_atmos
      public:
       ConfigParseStatus parse(
           const YAML::Node& object,
-          const std::vector<types::Species>& existing_species,
-          const std::vector<types::Phase>& existing_phases,
+          const MechanismIndex& index,
           open_atmos::types::Reactions& reactions) override;
     };
 
@@ -70,8 +68,7 @@ namespace open_atmos
      public:
       ConfigParseStatus parse(
           const YAML::Node& object,
-          const std::vector<types::Species>& existing_species,
-          const std::vector<types::Phase>& existing_phases,
+          const MechanismIndex& index,
           open_atmos::types::Reactions& reactions) override;
     };
 
@@ -80,8 +77,7 @@ namespace open_atmos
      public:
       ConfigParseStatus parse(
           const YAML::Node& object,
-          const std::vector<types::Species>& existing_species,
-          const std::vector<types::Phase>& existing_phases,
+          const MechanismIndex& index,
           open_atmos::types::Reactions& reactions) override;
     };
 
@@ -90,8 +86,7 @@ namespace open_atmos
      public:
       ConfigParseStatus parse(
           const YAML::Node& object,
-          const std::vector<types::Species>& existing_species,
-          const std::vector<types::Phase>& existing_phases,
+          const MechanismIndex& index,
           open_atmos::types::Reactions& reactions) override;
     };
 
@@ -100,8 +95,7 @@ namespace open_atmos
      public:
       ConfigParseStatus parse(
           const YAML::Node& object,
-          const std::vector<types::Species>& existing_species,
-          const std::vector<types::Phase>& existing_phases,
+          const MechanismIndex& index,
           open_atmos::types::Reactions& reactions) override;
     };
 
@@ -110,8 +104,7 @@ namespace open_atmos
      public:
       ConfigParseStatus parse(
           const YAML::Node& object,
-          const std::vector<types::Species>& existing_species,
-          const std::vector<types::Phase>& existing_phases,
+          const MechanismIndex& index,
           open_atmos::types::Reactions& reactions) override;
     };
 
@@ -120,8 +113,7 @@ namespace open_atmos
      public:
       ConfigParseStatus parse(
           const YAML::Node& object,
-          const std::vector<types::Species>& existing_species,
-          const std::vector<types::Phase>& existing_phases,
+          const MechanismIndex& index,
           open_atmos::types::Reactions& reactions) override;
     };
 
@@ -130,8 +122,7 @@ namespace open_atmos
      public:
       ConfigParseStatus parse(
           const YAML::Node& object,
-          const std::vector<types::Species>& existing_species,
-          const std::vector<types::Phase>& existing_phases,
+          const MechanismIndex& index,
           open_atmos::types::Reactions& reactions) override;
     };
 
@@ -140,8 +131,7 @@ namespace open_atmos
      public:
       ConfigParseStatus parse(
           const YAML::Node& object,
-          const std::vector<types::Species>& existing_species,
-          const std::vector<types::Phase>& existing_phases,
+          const MechanismIndex& index,
           open_atmos::types::Reactions& reactions) override;
     };
 
@@ -150,9 +140,22 @@ namespace open_atmos
      public:
       ConfigParseStatus parse(
           const YAML::Node& object,
-          const std::vector<types::Species>& existing_species,
-          const std::vector<types::Phase>& existing_phases,
+          const MechanismIndex& index,
           open_atmos::types::Reactions& reactions) override;
     };
+
+    /// @brief Parses a single reaction object with the parser registered for its type
+    /// @return ObjectTypeNotFound if no parser is registered for the type, otherwise the status of the parser
+    ConfigParseStatus ParseReaction(const YAML::Node& object, const MechanismIndex& index, types::Reactions& reactions);
+
+    /// @brief Parses a sequence of reaction objects, stopping at the first one that fails
+    /// @param number_of_threads The number of threads to parse with. Each thread parses a contiguous part of the
+    ///        sequence and the results are joined in document order, so the reactions, the status and any exception
+    ///        are the same as when parsing on one thread.
+    std::pair<ConfigParseStatus, types::Reactions>
+    ParseReactions(const YAML::Node& objects, const MechanismIndex& index, std::size_t number_of_threads = 1);
+
+    std::pair<ConfigParseStatus, types::Reactions>
+    ParseReactions(const std::vector<YAML::Node>& objects, const MechanismIndex& index, std::size_t number_of_threads = 1);
   }  // namespace mechanism_configuration
 }  // namespace open_atmos
@@ -0,0 +1,312 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <open_atmos/mechanism_configuration/compiled_mechanism.hpp>
+#include <open_atmos/mechanism_configuration/mechanism_view.hpp>
+#include <open_atmos/mechanism_configuration/parse_status.hpp>
+#include <open_atmos/types.hpp>
+#include <utility>
+#include <vector>
+
+namespace open_atmos
+{
+  namespace mechanism_configuration
+  {
+    /// @brief Batch evaluation of rate constants for many grid cells at once.
+    ///
+    ///        Each kind of reaction is prepared once from a compiled mechanism, which folds constant parameters together,
+    ///        and is then evaluated for a batch of cells. Results are laid out reaction by reaction: the rate constant
+    ///        of the i-th reaction of a kind in cell c is at i * number_of_cells + c. Cells are evaluated in blocks of
+    ///        cell_block_size; the temperature terms every reaction needs are computed once per block and the inner
+    ///        loops run over the cells of a block, so compilers can vectorize them. Every kind takes the density of
+    ///        air in mol m-3 and converts it to the units its parameters are given for.
+    namespace rate_constants
+    {
+      static constexpr std::size_t cell_block_size = 64;
+
+      /// @brief Arrhenius and CondensedPhaseArrhenius rate constants, k = A·exp(C/T)·(T/D)^B·(1 + E·P), evaluated as
+      ///        A·D^-B·exp(C/T + B·ln T)·(1 + E·P)
+      struct Arrhenius
+      {
+        /// @brief A·D^-B
+        std::vector<double> A;
+        std::vector<double> B;
+        std::vector<double> C;
+        std::vector<double> E;
+
+        std::size_t Size() const
+        {
+          return A.size();
+        }
+      };
+
+      Arrhenius PrepareArrhenius(const compiled::ArrheniusParameters& parameters);
+
+      /// @param temperature The temperature of each cell [K]
+      /// @param pressure The pressure of each cell [Pa]
+      /// @param rate_constants Resized to hold the rate constant of each reaction in each cell
+      void Evaluate(const Arrhenius& reactions, Span<double> temperature, Span<double> pressure, std::vector<double>& rate_constants);
+
+      /// @brief Troe fall-off rate constants,
+      ///        k = k0·[M] / (1 + k0·[M] / kinf) · Fc^(1 / (1 + log10(k0·[M] / kinf)² / N)),
+      ///        where k0 and kinf are Arrhenius rate constants with D = 300 K and [M] is in molecules cm-3. The limits are combined in log space, so
+      ///        the only transcendental functions per rate constant are three exp; the pre-exponential factors are
+      ///        expected to be positive.
+      struct Troe
+      {
+        /// @brief ln(k0_A·300^-k0_B)
+        std::vector<double> log_k0_A;
+        std::vector<double> k0_B;
+        std::vector<double> k0_C;
+        /// @brief ln(kinf_A·300^-kinf_B)
+        std::vector<double> log_kinf_A;
+        std::vector<double> kinf_B;
+        std::vector<double> kinf_C;
+        /// @brief ln(Fc)
+        std::vector<double> log_Fc;
+        /// @brief 1 / N
+        std::vector<double> inverse_N;
+
+        std::size_t Size() const
+        {
+          return log_k0_A.size();
+        }
+      };
+
+      Troe PrepareTroe(const compiled::TroeParameters& parameters);
+
+      /// @param temperature The temperature of each cell [K]
+      /// @param air_density The number density of air [M] of each cell [mol m-3]
+      /// @param rate_constants Resized to hold the rate constant of each reaction in each cell
+      void Evaluate(const Troe& reactions, Span<double> temperature, Span<double> air_density, std::vector<double>& rate_constants);
+
+      /// @brief Branched (Wennberg NO + RO2) rate constants. Both branches share X·exp(-Y/T) and the structure term
+      ///        A(T, [M], n), a Troe-like expression in 2e-22·e^n·[M] and 0.43·(T/298)^-8:
+      ///        k_nitrate = X·exp(-Y/T)·A / (A + Z) and k_alkoxy = X·exp(-Y/T)·Z / (A + Z), where
+      ///        Z = A(293 K, 2.45e19 molecules cm-3, n)·(1 - a0) / a0 depends only on the reaction.
+      struct Branched
+      {
+        std::vector<double> X;
+        std::vector<double> Y;
+        /// @brief ln(2e-22·e^n), for [M] in molecules cm-3
+        std::vector<double> log_k0;
+        std::vector<double> Z;
+
+        std::size_t Size() const
+        {
+          return X.size();
+        }
+      };
+
+      Branched PrepareBranched(const compiled::BranchedParameters& parameters);
+
+      /// @param temperature The temperature of each cell [K]
+      /// @param air_density The number density of air [M] of each cell [mol m-3]
+      /// @param nitrate_rate_constants Resized to hold the rate constant of the nitrate branch of each reaction in each cell
+      /// @param alkoxy_rate_constants Resized to hold the rate constant of the alkoxy branch of each reaction in each cell
+      void Evaluate(
+          const Branched& reactions,
+          Span<double> temperature,
+          Span<double> air_density,
+          std::vector<double>& nitrate_rate_constants,
+          std::vector<double>& alkoxy_rate_constants);
+
+      /// @brief Tunneling rate constants, k = A·exp(-B/T)·exp(C/T³), evaluated as A·exp(-B/T + C/T³) with 1/T and 1/T³
+      ///        shared by every reaction
+      struct Tunneling
+      {
+        std::vector<double> A;
+        std::vector<double> B;
+        std::vector<double> C;
+
+        std::size_t Size() const
+        {
+          return A.size();
+        }
+      };
+
+      Tunneling PrepareTunneling(const compiled::TunnelingParameters& parameters);
+
+      /// @param temperature The temperature of each cell [K]
+      /// @param rate_constants Resized to hold the rate constant of each reaction in each cell
+      void Evaluate(const Tunneling& reactions, Span<double> temperature, std::vector<double>& rate_constants);
+
+      /// @brief Surface rate constants, k = 4·π·N·r² / (r / D + 4 / (v·γ)), for particles of radius r and number
+      ///        concentration N, where γ is the reaction probability, D the diffusion coefficient of the gas species
+      ///        and v = sqrt(8·R·T / (π·MW)) its mean speed
+      struct Surface
+      {
+        /// @brief 1 / D [s m-2]
+        std::vector<double> inverse_diffusion_coefficient;
+        /// @brief 8·R / (π·MW), so that v = sqrt(speed_factor·T) [m2 s-2 K-1]
+        std::vector<double> speed_factor;
+        /// @brief 4 / γ
+        std::vector<double> four_over_probability;
+
+        std::size_t Size() const
+        {
+          return speed_factor.size();
+        }
+      };
+
+      /// @brief Resolves the diffusion coefficient and molecular weight of the gas species of each Surface reaction
+      /// @param mechanism The mechanism that was compiled, whose species hold the properties
+      /// @return MissingSpeciesProperty if a gas species does not have one of the properties
+      std::pair<ConfigParseStatus, Surface> PrepareSurface(const types::Mechanism& mechanism, const CompiledMechanism& compiled);
+
+      /// @param temperature The temperature of each cell [K]
+      /// @param radius The effective particle radius of each cell [m]
+      /// @param number_concentration The particle number concentration of each cell [m-3]
+      /// @param rate_constants Resized to hold the rate constant of each reaction in each cell [s-1]
+      void Evaluate(
+          const Surface& reactions,
+          Span<double> temperature,
+          Span<double> radius,
+          Span<double> number_concentration,
+          std::vector<double>& rate_constants);
+
+      /// @brief SimpolPhaseTransfer partitioning. The SIMPOL.1 saturation vapor pressure of each reaction's species,
+      ///        log10(p [atm]) = B0 / T + B1 + B2·T + B3·ln T, is evaluated as the saturation concentration
+      ///        C* = p / (R·T), and the condensation rate constant onto particles of radius r and number concentration N
+      ///        follows the Surface uptake expression with unit accommodation, k = 4·π·N·r² / (r / D + 4 / v). The
+      ///        gas species then changes at the rate -k·([gas] - x·C*), where x is the mole fraction of the aerosol
+      ///        species in the particles, so k·x·C* is the evaporation rate.
+      struct Simpol
+      {
+        /// @brief The SIMPOL.1 parameters, scaled so that ln(C*·R·T [Pa]) = B0 / T + B1 + B2·T + B3·ln T
+        std::vector<double> B0;
+        std::vector<double> B1;
+        std::vector<double> B2;
+        std::vector<double> B3;
+        /// @brief 1 / D of the gas species [s m-2]
+        std::vector<double> inverse_diffusion_coefficient;
+        /// @brief 8·R / (π·MW) of the gas species [m2 s-2 K-1]
+        std::vector<double> speed_factor;
+
+        std::size_t Size() const
+        {
+          return B0.size();
+        }
+      };
+
+      /// @brief Resolves the diffusion coefficient and molecular weight of the gas species of each SimpolPhaseTransfer
+      ///        reaction
+      /// @param mechanism The mechanism that was compiled, whose species hold the properties
+      /// @return MissingSpeciesProperty if a gas species does not have one of the properties
+      std::pair<ConfigParseStatus, Simpol> PrepareSimpol(const types::Mechanism& mechanism, const CompiledMechanism& compiled);
+
+      /// @param temperature The temperature of each cell [K]
+      /// @param radius The particle radius of each size bin in each cell, bin by bin: bin b of cell c is at
+      ///        b * number_of_cells + c [m]
+      /// @param number_concentration The particle number concentration of each size bin in each cell, laid out as
+      ///        radius [m-3]
+      /// @param saturation_concentration Resized to hold C* of each reaction in each cell [mol m-3]
+      /// @param condensation_rate_constants Resized to hold k of each reaction, bin and cell, at
+      ///        (i * number_of_bins + b) * number_of_cells + c [s-1]
+      void Evaluate(
+          const Simpol& reactions,
+          Span<double> temperature,
+          Span<double> radius,
+          Span<double> number_concentration,
+          std::vector<double>& saturation_concentration,
+          std::vector<double>& condensation_rate_constants);
+
+      /// @brief HenrysLaw phase transfer between a gas species and its dissolved form in aerosol water. The forward rate
+      ///        constant is the uptake of the gas species by the particles, k_f = 4·π·N·r² / (r / D + 4 / v), as for
+      ///        SIMPOL partitioning. The reverse rate constant returns the dissolved species to the gas phase at the rate
+      ///        that balances it at equilibrium, k_r = k_f / (HLC(T)·R·T·V_w), with
+      ///        HLC(T) = HLC(298 K)·exp(C·(1/T - 1/298)) and V_w = [W]·MW_w / ρ_w the volume of aerosol water per
+      ///        volume of air. In a cell without aerosol water or without particles both rate constants are zero.
+      struct HenrysLaw
+      {
+        /// @brief HLC(298 K) of the gas species [mol m-3 Pa-1]
+        std::vector<double> HLC_298;
+        /// @brief The HLC exponential factor of the gas species [K]
+        std::vector<double> C;
+        /// @brief 1 / D of the gas species [s m-2]
+        std::vector<double> inverse_diffusion_coefficient;
+        /// @brief 8·R / (π·MW) of the gas species [m2 s-2 K-1]
+        std::vector<double> speed_factor;
+        /// @brief The aerosol water species
+        std::vector<types::SymbolId> water;
+        /// @brief MW_w / ρ_w of the aerosol water species [m3 mol-1]
+        std::vector<double> water_molar_volume;
+
+        std::size_t Size() const
+        {
+          return HLC_298.size();
+        }
+      };
+
+      /// @brief Resolves the Henry's law constants, diffusion coefficient and molecular weight of the gas species of
+      ///        each HenrysLaw reaction, and the molecular weight and density of its aerosol water
+      /// @param mechanism The mechanism that was compiled, whose species hold the properties
+      /// @return MissingSpeciesProperty if a species does not have one of the properties
+      std::pair<ConfigParseStatus, HenrysLaw> PrepareHenrysLaw(const types::Mechanism& mechanism, const CompiledMechanism& compiled);
+
+      /// @param temperature The temperature of each cell [K]
+      /// @param radius The effective radius of the particles of each cell [m]
+      /// @param number_concentration The particle number concentration of each cell [m-3]
+      /// @param concentrations The concentration of each species in each cell, species by species: species s of cell c
+      ///        is at s * number_of_cells + c [mol m-3]
+      /// @param forward_rate_constants Resized to hold k_f of each reaction in each cell [s-1]
+      /// @param reverse_rate_constants Resized to hold k_r of each reaction in each cell [s-1]
+      void Evaluate(
+          const HenrysLaw& reactions,
+          Span<double> temperature,
+          Span<double> radius,
+          Span<double> number_concentration,
+          Span<double> concentrations,
+          std::vector<double>& forward_rate_constants,
+          std::vector<double>& reverse_rate_constants);
+
+      /// @brief AqueousEquilibrium rate constants. The equilibrium constant is K_eq = A·exp(C·(1/T - 1/298)) and the
+      ///        forward rate constant is K_eq·k_reverse, both for concentrations per volume of aerosol water. Scaled
+      ///        for concentrations per volume of air, with V_w = [W]·MW_w / ρ_w the volume of aerosol water per volume
+      ///        of air, they are k_f = K_eq·k_reverse·V_w^(1 - n_reactants) and k_r = k_reverse·V_w^(1 - n_products),
+      ///        where n is the sum of the reactant or product coefficients. In a cell without aerosol water both
+      ///        rate constants are zero.
+      struct AqueousEquilibrium
+      {
+        /// @brief A·k_reverse
+        std::vector<double> forward_A;
+        std::vector<double> C;
+        std::vector<double> k_reverse;
+        /// @brief 1 - n of the reactants and of the products
+        std::vector<double> forward_water_exponent;
+        std::vector<double> reverse_water_exponent;
+        /// @brief The aerosol water species
+        std::vector<types::SymbolId> water;
+        /// @brief MW_w / ρ_w of the aerosol water species [m3 mol-1]
+        std::vector<double> water_molar_volume;
+
+        std::size_t Size() const
+        {
+          return forward_A.size();
+        }
+      };
+
+      /// @brief Resolves the molecular weight and density of the aerosol water of each AqueousEquilibrium reaction
+      /// @param mechanism The mechanism that was compiled, whose species hold the properties
+      /// @return MissingSpeciesProperty if a water species does not have one of the properties
+      std::pair<ConfigParseStatus, AqueousEquilibrium> PrepareAqueousEquilibrium(
+          const types::Mechanism& mechanism,
+          const CompiledMechanism& compiled);
+
+      /// @param temperature The temperature of each cell [K]
+      /// @param concentrations The concentration of each species in each cell, laid out as for HenrysLaw [mol m-3]
+      /// @param forward_rate_constants Resized to hold k_f of each reaction in each cell
+      /// @param reverse_rate_constants Resized to hold k_r of each reaction in each cell
+      void Evaluate(
+          const AqueousEquilibrium& reactions,
+          Span<double> temperature,
+          Span<double> concentrations,
+          std::vector<double>& forward_rate_constants,
+          std::vector<double>& reverse_rate_constants);
+    }  // namespace rate_constants
+  }  // namespace mechanism_configuration
+}  // namespace open_atmos
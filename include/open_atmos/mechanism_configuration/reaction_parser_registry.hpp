@@ -0,0 +1,61 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <open_atmos/mechanism_configuration/utils.hpp>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace open_atmos
+{
+  namespace mechanism_configuration
+  {
+    /// @brief The parsers for each reaction type, looked up by the value of the reaction's type key.
+    ///
+    ///        Lookups go through a perfect hash that is rebuilt whenever a type is registered, so finding a parser
+    ///        costs one hash of the type and one string comparison. Parsers may be called from several threads at once
+    ///        when the parser is set to use more than one thread, so they should not keep state between calls.
+    class ReactionParserRegistry
+    {
+     public:
+      /// @brief The registry used by Parser. It starts out with every built-in reaction type.
+      static ReactionParserRegistry& Instance();
+
+      /// @brief A registry with every built-in reaction type
+      ReactionParserRegistry();
+
+      ReactionParserRegistry(const ReactionParserRegistry&) = delete;
+      ReactionParserRegistry& operator=(const ReactionParserRegistry&) = delete;
+
+      /// @brief Adds a parser for a reaction type, replacing any parser already registered for it. Types should be
+      ///        registered before parsing starts, as lookups are not synchronized with registration.
+      void Register(const std::string& type, std::unique_ptr<IReactionParser> parser);
+
+      /// @brief Returns the parser for a reaction type, or nullptr if the type has not been registered
+      IReactionParser* Find(std::string_view type) const;
+
+      std::size_t Size() const;
+
+     private:
+      static constexpr std::uint32_t empty_slot = ~std::uint32_t{ 0 };
+
+      std::size_t Slot(std::string_view type) const;
+
+      /// @brief Finds a seed for which every registered type hashes to its own slot
+      void Rebuild();
+
+      std::vector<std::pair<std::string, std::unique_ptr<IReactionParser>>> parsers_;
+      /// @brief The position in parsers_ of the type that hashes to each slot
+      std::vector<std::uint32_t> slots_;
+      std::uint64_t seed_{ 0 };
+      std::mutex registration_;
+    };
+  }  // namespace mechanism_configuration
+}  // namespace open_atmos
@@ -0,0 +1,48 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+#include <open_atmos/mechanism_configuration/compiled_mechanism.hpp>
+#include <open_atmos/mechanism_configuration/parse_status.hpp>
+#include <open_atmos/mechanism_configuration/sparse_matrix.hpp>
+#include <open_atmos/types.hpp>
+#include <utility>
+#include <vector>
+
+namespace open_atmos
+{
+  namespace mechanism_configuration
+  {
+    enum class SpeciesOrdering
+    {
+      /// @brief Reverse Cuthill-McKee, which keeps the non-zeros close to the diagonal
+      ReverseCuthillMcKee,
+      /// @brief Minimum degree, which eliminates the species with the fewest remaining couplings first to limit fill-in
+      MinimumDegree
+    };
+
+    /// @brief Computes a fill-reducing order for the rows and columns of a square pattern, such as a Jacobian pattern.
+    ///        The pattern is treated as symmetric (A + Aᵀ) and the diagonal is ignored. Ties are broken by the current
+    ///        index, so the order is deterministic.
+    /// @return The current index at each new position, as taken by PermuteSymmetric and RenumberSpecies
+    std::vector<std::uint32_t> ComputeOrdering(const SparsityPattern& pattern, SpeciesOrdering method);
+
+    /// @brief Computes a fill-reducing order of the species of a mechanism from its Jacobian pattern
+    /// @return The species identifier at each new position
+    std::vector<std::uint32_t> ComputeSpeciesOrdering(const types::Mechanism& mechanism, SpeciesOrdering method);
+
+    /// @brief Returns the mechanism with its species in a new order, with every species identifier in its reactions and
+    ///        its species symbol table renumbered to match. Structures built from the result (CompiledMechanism,
+    ///        StoichiometryMatrix, Jacobian patterns) are in the new order.
+    /// @param order The current species identifier at each new position
+    /// @return InvalidSpeciesOrder if the order is not a permutation of the species of the mechanism
+    std::pair<ConfigParseStatus, types::Mechanism> RenumberSpecies(const types::Mechanism& mechanism, const std::vector<std::uint32_t>& order);
+
+    /// @brief Renumbers the species of a compiled mechanism in place, as RenumberSpecies does for a mechanism
+    /// @return InvalidSpeciesOrder, leaving the compiled mechanism unchanged, if the order is not a permutation of its species
+    ConfigParseStatus RenumberSpecies(CompiledMechanism& compiled, const std::vector<std::uint32_t>& order);
+  }  // namespace mechanism_configuration
+}  // namespace open_atmos
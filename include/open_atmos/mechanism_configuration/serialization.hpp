@@ -0,0 +1,42 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <open_atmos/mechanism_configuration/parse_status.hpp>
+#include <open_atmos/types.hpp>
+#include <utility>
+#include <vector>
+
+namespace open_atmos
+{
+  namespace mechanism_configuration
+  {
+    /// @brief The version of the binary format written by Serialize
+    static constexpr std::uint32_t binary_format_version = 1;
+
+    /// @brief Encodes a mechanism in a compact binary format, so that it can be parsed once and then shared or stored.
+    ///
+    ///        The buffer starts with a magic number, the format version, the size of the payload and a 64-bit FNV-1a
+    ///        checksum of the payload. Every value in the payload is little-endian, and unknown properties are written in
+    ///        key order, so equal mechanisms always produce identical bytes.
+    std::vector<std::byte> Serialize(const types::Mechanism& mechanism);
+
+    /// @brief Decodes a mechanism written by Serialize
+    /// @param data The start of the buffer
+    /// @param size The size of the buffer in bytes
+    /// @return A pair containing the decoding status and mechanism. The status is InvalidBinaryFormat if the buffer is not
+    ///         a complete mechanism, UnsupportedBinaryVersion if it was written in another format version, and
+    ///         BinaryChecksumMismatch if it has been corrupted.
+    std::pair<ConfigParseStatus, types::Mechanism> Deserialize(const std::byte* data, std::size_t size);
+
+    std::pair<ConfigParseStatus, types::Mechanism> Deserialize(const std::vector<std::byte>& buffer);
+
+    /// @brief The 64-bit FNV-1a hash of a buffer
+    /// @param hash The hash to continue from, so that several buffers can be hashed as if they were one
+    std::uint64_t Fnv1a(const std::byte* data, std::size_t size, std::uint64_t hash = 0xcbf29ce484222325ull);
+  }  // namespace mechanism_configuration
+}  // namespace open_atmos
@@ -0,0 +1,71 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <open_atmos/mechanism_configuration/mechanism_view.hpp>
+#include <vector>
+
+namespace open_atmos
+{
+  namespace mechanism_configuration
+  {
+    /// @brief The positions of the non-zero entries of a matrix, in compressed sparse row form. The entries of row i are
+    ///        at positions offsets[i] to offsets[i + 1] of indices, which holds their columns in increasing order.
+    struct SparsityPattern
+    {
+      std::size_t number_of_rows{ 0 };
+      std::size_t number_of_columns{ 0 };
+      std::vector<std::uint32_t> offsets{ 0 };
+      std::vector<std::uint32_t> indices;
+
+      /// @brief The number of non-zero entries
+      std::size_t Size() const
+      {
+        return indices.size();
+      }
+
+      /// @brief The columns of the non-zero entries in a row
+      Span<std::uint32_t> Columns(std::size_t row) const
+      {
+        return { indices.data() + offsets[row], static_cast<std::size_t>(offsets[row + 1] - offsets[row]) };
+      }
+
+      /// @brief The position of an entry in indices, or npos if the entry is not part of the pattern
+      std::size_t Find(std::size_t row, std::size_t column) const;
+
+      /// @brief The pattern of the transposed matrix, which is this pattern in compressed sparse column form
+      SparsityPattern Transpose() const;
+
+      static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+    };
+
+    /// @brief Renumbers the rows and columns of a square pattern, as for P·A·Pᵀ
+    /// @param order The old index at each new position, so that new entry (i, j) is old entry (order[i], order[j])
+    SparsityPattern PermuteSymmetric(const SparsityPattern& pattern, const std::vector<std::uint32_t>& order);
+
+    bool operator==(const SparsityPattern& left, const SparsityPattern& right);
+    bool operator!=(const SparsityPattern& left, const SparsityPattern& right);
+
+    /// @brief A sparse matrix in compressed sparse row form. values holds the entry at each position of the pattern.
+    struct SparseMatrix
+    {
+      SparsityPattern pattern;
+      std::vector<double> values;
+
+      Span<double> Values(std::size_t row) const
+      {
+        return { values.data() + pattern.offsets[row], static_cast<std::size_t>(pattern.offsets[row + 1] - pattern.offsets[row]) };
+      }
+
+      /// @brief The entry at a row and column, which is 0 outside the pattern
+      double At(std::size_t row, std::size_t column) const;
+
+      /// @brief The transposed matrix, which is this matrix in compressed sparse column form
+      SparseMatrix Transpose() const;
+    };
+  }  // namespace mechanism_configuration
+}  // namespace open_atmos
@@ -0,0 +1,46 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+#include <open_atmos/mechanism_configuration/compiled_mechanism.hpp>
+#include <open_atmos/mechanism_configuration/sparse_matrix.hpp>
+#include <open_atmos/types.hpp>
+#include <vector>
+
+namespace open_atmos
+{
+  namespace mechanism_configuration
+  {
+    /// @brief The net stoichiometry of a mechanism, as a species × column matrix whose entries are the amount of each
+    ///        species produced (positive) or consumed (negative) when a column's process happens once.
+    ///
+    ///        Each reaction has one column, except a Branched reaction, which has a column for its nitrate branch
+    ///        followed by one for its alkoxy branch, because the two branches have separate rate constants. Columns are
+    ///        in the canonical reaction order of CompiledMechanism and rows are species identifiers. The phase transfer
+    ///        and equilibrium reactions (SimpolPhaseTransfer, HenrysLaw, AqueousEquilibrium) are written in their
+    ///        forward direction; the reverse process is the negated column.
+    ///
+    ///        A species that appears more than once in a reaction has a single entry, and entries whose contributions
+    ///        cancel (a species that is both consumed and produced in equal amounts) are left out.
+    struct StoichiometryMatrix
+    {
+      /// @brief The matrix in compressed sparse row form: one row per species
+      SparseMatrix by_species;
+      /// @brief The matrix in compressed sparse column form: one row of this matrix per column of by_species
+      SparseMatrix by_column;
+      /// @brief The reaction each column belongs to
+      std::vector<std::uint32_t> column_reactions;
+      /// @brief The first column of each reaction, followed by the number of columns
+      std::vector<std::uint32_t> reaction_columns;
+    };
+
+    /// @brief Builds the net stoichiometry of a compiled mechanism. Components whose species is not in the mechanism
+    ///        are left out.
+    StoichiometryMatrix BuildStoichiometry(const CompiledMechanism& compiled);
+
+    StoichiometryMatrix BuildStoichiometry(const types::Mechanism& mechanism);
+  }  // namespace mechanism_configuration
+}  // namespace open_atmos
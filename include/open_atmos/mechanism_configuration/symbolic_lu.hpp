@@ -0,0 +1,75 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+#include <open_atmos/mechanism_configuration/reordering.hpp>
+#include <open_atmos/mechanism_configuration/sparse_matrix.hpp>
+#include <open_atmos/types.hpp>
+#include <vector>
+
+namespace open_atmos
+{
+  namespace mechanism_configuration
+  {
+    /// @brief The symbolic LU factorization of a square pattern, without pivoting. L and U share one pattern: the
+    ///        entries of a row before its diagonal are L (whose unit diagonal is not stored) and the rest are U.
+    ///
+    ///        The elimination is recorded as flat arrays of positions in that pattern, row by row. For each entry
+    ///        (i, k) of L, in order, the numeric factorization divides it by the pivot at diagonal[k] and then, for
+    ///        each of its updates u, subtracts it times values[update_sources[u]] (entry (k, j) of U) from
+    ///        values[update_targets[u]] (entry (i, j)). Nothing has to be searched or allocated while factorizing.
+    struct SymbolicLU
+    {
+      /// @brief The pattern of L + U, which is the factorized pattern with its fill-in
+      SparsityPattern pattern;
+      /// @brief The position of each diagonal entry in pattern
+      std::vector<std::uint32_t> diagonal;
+      /// @brief The position of each entry of L, in elimination order
+      std::vector<std::uint32_t> lower;
+      /// @brief The row of U each entry of L is eliminated with
+      std::vector<std::uint32_t> lower_pivots;
+      /// @brief The updates of lower[l] are at positions update_offsets[l] to update_offsets[l + 1]
+      std::vector<std::uint32_t> update_offsets{ 0 };
+      std::vector<std::uint32_t> update_targets;
+      std::vector<std::uint32_t> update_sources;
+      /// @brief The position in pattern of each entry of the pattern that was factorized, for copying a matrix into
+      ///        the factorization
+      std::vector<std::uint32_t> matrix_positions;
+
+      /// @brief The number of entries that were not in the factorized pattern
+      std::size_t Fill() const
+      {
+        return pattern.Size() - matrix_positions.size();
+      }
+    };
+
+    /// @brief Computes the symbolic factorization of a square pattern in its current order. The diagonal is always
+    ///        part of the factorization.
+    SymbolicLU BuildSymbolicLU(const SparsityPattern& pattern);
+
+    /// @brief The symbolic factorization of the Jacobian of a mechanism, in a fill-reducing species order
+    struct MechanismLU
+    {
+      SymbolicLU lu;
+      /// @brief The species identifier at each row and column of the factorization
+      std::vector<std::uint32_t> species_order;
+    };
+
+    MechanismLU BuildSymbolicLU(const types::Mechanism& mechanism, SpeciesOrdering ordering = SpeciesOrdering::MinimumDegree);
+
+    /// @brief Scatters the values of a matrix with the factorized pattern into the layout of the factorization, with
+    ///        zeros for the fill-in
+    std::vector<double> ScatterToLU(const SymbolicLU& lu, const std::vector<double>& matrix_values);
+
+    /// @brief Factorizes in place values laid out as lu.pattern. This is the reference numeric factorization: it does
+    ///        not pivot, so it expects a matrix that can be factorized in the given order, such as the diagonally
+    ///        dominant I - h·J of an implicit step.
+    void Factorize(const SymbolicLU& lu, std::vector<double>& values);
+
+    /// @brief Solves L·U·x = b in place with factorized values
+    void Solve(const SymbolicLU& lu, const std::vector<double>& values, std::vector<double>& b);
+  }  // namespace mechanism_configuration
+}  // namespace open_atmos
@@ -7,10 +7,13 @@
 #include <yaml-cpp/yaml.h>
 
 #include <iostream>
+#include <open_atmos/mechanism_configuration/mechanism_index.hpp>
+#include <open_atmos/mechanism_configuration/object_schema.hpp>
 #include <open_atmos/mechanism_configuration/parse_status.hpp>
 #include <open_atmos/mechanism_configuration/validation.hpp>
 #include <open_atmos/types.hpp>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
@@ -23,8 +26,7 @@ namespace open_atmos
      public:
       virtual ConfigParseStatus parse(
           const YAML::Node& object,
-          const std::vector<types::Species>& existing_species,
-          const std::vector<types::Phase>& existing_phases,
+          const MechanismIndex& index,
           types::Reactions& reactions) = 0;
       virtual ~IReactionParser() = default;
     };
@@ -35,59 +37,60 @@ namespace open_atmos
     ConfigParseStatus
     ValidateSchema(const YAML::Node& object, const std::vector<std::string>& required_keys, const std::vector<std::string>& optional_keys);
 
+    std::pair<ConfigParseStatus, types::Species> ParseSpeciesObject(const YAML::Node& object);
+
     std::pair<ConfigParseStatus, std::vector<types::Species>> ParseSpecies(const YAML::Node& objects);
 
-    std::pair<ConfigParseStatus, std::vector<types::Phase>> ParsePhases(
-        const YAML::Node& objects,
-        const std::vector<types::Species> existing_species);
+    std::pair<ConfigParseStatus, types::Phase> ParsePhaseObject(const YAML::Node& object, const MechanismIndex& index);
+
+    std::pair<ConfigParseStatus, std::vector<types::Phase>> ParsePhases(const YAML::Node& objects, const MechanismIndex& index);
 
-    std::pair<ConfigParseStatus, types::ReactionComponent> ParseReactionComponent(const YAML::Node& object);
+    /// @brief Parses a reactant or product, resolving its species to an identifier. A species that is not defined in the
+    ///        mechanism is given types::unknown_symbol, and is left for the reaction parser to report.
+    std::pair<ConfigParseStatus, types::ReactionComponent> ParseReactionComponent(const YAML::Node& object, const MechanismIndex& index);
 
-    std::vector<types::ReactionComponent> ParseReactantsOrProducts(const std::string& key, const YAML::Node& object, ConfigParseStatus& status);
+    /// @brief Parses a list of reactants or products, stopping at the first that is invalid
+    std::vector<types::ReactionComponent> ParseReactantsOrProducts(const YAML::Node& objects, const MechanismIndex& index, ConfigParseStatus& status);
 
+    /// @brief A name that is given to more than one object, and the position of every object that uses it
+    struct DuplicateName
+    {
+      std::string name;
+      std::vector<std::size_t> positions;
+    };
+
+    /// @brief Finds every name that is used by more than one object in a single pass over the collection
+    /// @return The duplicated names, in the order they first appear
     template<typename T>
-    bool ContainsUniqueObjectsByName(const std::vector<T>& collection)
+    std::vector<DuplicateName> FindDuplicateObjectsByName(const std::vector<T>& collection)
     {
-      for (size_t i = 0; i < collection.size(); ++i)
+      std::vector<DuplicateName> duplicates;
+      // position of the first object with each name, and then where that name is in the list of duplicates
+      std::unordered_map<std::string_view, std::size_t> first_positions;
+      std::unordered_map<std::string_view, std::size_t> duplicate_positions;
+      first_positions.reserve(collection.size());
+
+      for (std::size_t i = 0; i < collection.size(); ++i)
       {
-        for (size_t j = i + 1; j < collection.size(); ++j)
+        std::string_view name = collection[i].name;
+        auto first = first_positions.emplace(name, i);
+        if (first.second)
         {
-          if (collection[i].name == collection[j].name)
-          {
-            return false;
-          }
+          continue;
         }
-      }
-      return true;
-    }
-
-    template<typename SpeciesType>
-    bool RequiresUnknownSpecies(const std::vector<std::string>& requested_species, const std::vector<SpeciesType>& existing_species)
-    {
-      for (const auto& spec : requested_species)
-      {
-        auto it = std::find_if(
-            existing_species.begin(),
-            existing_species.end(),
-            [&spec](const auto& existing)
-            {
-              if constexpr (std::is_same<SpeciesType, std::string>::value)
-              {
-                return existing == spec;
-              }
-              else
-              {
-                return existing.name == spec;
-              }
-            });
-
-        if (it == existing_species.end())
+        auto duplicate = duplicate_positions.emplace(name, duplicates.size());
+        if (duplicate.second)
         {
-          return true;
+          duplicates.push_back({ collection[i].name, { first.first->second } });
         }
+        duplicates[duplicate.first->second].positions.push_back(i);
       }
-      return false;
+
+      return duplicates;
     }
 
+    /// @brief Writes one message per duplicated name, listing every position it was found at
+    void ReportDuplicates(const std::string& object_type, const std::vector<DuplicateName>& duplicates);
+
   }  // namespace mechanism_configuration
 }  // namespace open_atmos
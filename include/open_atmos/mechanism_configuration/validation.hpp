@@ -15,21 +15,6 @@ namespace open_atmos
     extern struct Mechanism mechanism;
     extern struct Species species;
     extern struct Phase phase;
-    extern struct ReactionComponent reaction_component;
-    extern struct Arrhenius arrhenius;
-    extern struct CondensedPhaseArrhenius condensed_phase_arrhenius;
-    extern struct Troe troe;
-    extern struct Branched branched;
-    extern struct Tunneling tunneling;
-    extern struct Surface surface;
-    extern struct Photolysis photolysis;
-    extern struct CondensedPhasePhotolysis condensed_phase_photolysis;
-    extern struct Emission emission;
-    extern struct FirstOrderLoss first_order_loss;
-    extern struct SimpolPhaseTransfer simpol_phase_transfer;
-    extern struct WetDeposition wet_deposition;
-    extern struct HenrysLaw henrys_law;
-    extern struct AqueousEquilibrium aqueous_equilibrium;
 
     struct Keys
     {
@@ -193,101 +178,5 @@ namespace open_atmos
       const std::vector<std::string> required_keys{ keys.name, keys.species };
       const std::vector<std::string> optional_keys{};
     };
-
-    struct ReactionComponent
-    {
-      const std::vector<std::string> required_keys{ keys.species_name };
-      const std::vector<std::string> optional_keys{ keys.coefficient };
-    };
-
-    struct Arrhenius
-    {
-      const std::vector<std::string> required_keys{ keys.products, keys.reactants, keys.type, keys.gas_phase };
-      const std::vector<std::string> optional_keys{ keys.A, keys.B, keys.C, keys.D, keys.E, keys.Ea, keys.name };
-    };
-
-    struct CondensedPhaseArrhenius
-    {
-      const std::vector<std::string> required_keys{ keys.products, keys.reactants, keys.type, keys.aerosol_phase, keys.aerosol_phase_water };
-      const std::vector<std::string> optional_keys{ keys.A, keys.B, keys.C, keys.D, keys.E, keys.Ea, keys.name };
-    };
-
-    struct Troe
-    {
-      const std::vector<std::string> required_keys{ keys.products, keys.reactants, keys.type, keys.gas_phase };
-      const std::vector<std::string> optional_keys{
-        keys.name, keys.k0_A, keys.k0_B, keys.k0_C, keys.kinf_A, keys.kinf_B, keys.kinf_C, keys.Fc, keys.N
-      };
-    };
-
-    struct Branched
-    {
-      const std::vector<std::string> required_keys{ keys.nitrate_products, keys.alkoxy_products, keys.reactants, keys.type, keys.gas_phase };
-      const std::vector<std::string> optional_keys{ keys.name, keys.X, keys.Y, keys.a0, keys.n };
-    };
-
-    struct Tunneling
-    {
-      const std::vector<std::string> required_keys{ keys.products, keys.reactants, keys.type, keys.gas_phase };
-      const std::vector<std::string> optional_keys{ keys.name, keys.A, keys.B, keys.C };
-    };
-
-    struct Surface
-    {
-      const std::vector<std::string> required_keys{ keys.gas_phase_products, keys.gas_phase_species, keys.type, keys.gas_phase, keys.aerosol_phase };
-      const std::vector<std::string> optional_keys{ keys.name, keys.reaction_probability };
-    };
-
-    struct Photolysis
-    {
-      const std::vector<std::string> required_keys{ keys.reactants, keys.products, keys.type, keys.gas_phase };
-      const std::vector<std::string> optional_keys{ keys.name, keys.scaling_factor };
-    };
-
-    struct CondensedPhasePhotolysis
-    {
-      const std::vector<std::string> required_keys{ keys.reactants, keys.products, keys.type, keys.aerosol_phase, keys.aerosol_phase_water };
-      const std::vector<std::string> optional_keys{ keys.name, keys.scaling_factor };
-    };
-
-    struct Emission
-    {
-      const std::vector<std::string> required_keys{ keys.products, keys.type, keys.gas_phase };
-      const std::vector<std::string> optional_keys{ keys.name, keys.scaling_factor };
-    };
-
-    struct FirstOrderLoss
-    {
-      const std::vector<std::string> required_keys{ keys.reactants, keys.type, keys.gas_phase };
-      const std::vector<std::string> optional_keys{ keys.name, keys.scaling_factor };
-    };
-
-    struct SimpolPhaseTransfer
-    {
-      const std::vector<std::string> required_keys{ keys.type, keys.gas_phase, keys.gas_phase_species, keys.aerosol_phase, keys.aerosol_phase_species,
-                                                    keys.B };
-      const std::vector<std::string> optional_keys{ keys.name };
-    };
-
-    struct WetDeposition
-    {
-      const std::vector<std::string> required_keys{ keys.aerosol_phase, keys.type };
-      const std::vector<std::string> optional_keys{ keys.name, keys.scaling_factor };
-    };
-
-    struct HenrysLaw
-    {
-      const std::vector<std::string> required_keys{
-        keys.type, keys.gas_phase, keys.gas_phase_species, keys.aerosol_phase, keys.aerosol_phase_species, keys.aerosol_phase_water
-      };
-      const std::vector<std::string> optional_keys{ keys.name };
-    };
-
-    struct AqueousEquilibrium
-    {
-      const std::vector<std::string> required_keys{ keys.type,          keys.reactants,           keys.products,
-                                                    keys.aerosol_phase, keys.aerosol_phase_water, keys.k_reverse };
-      const std::vector<std::string> optional_keys{ keys.name, keys.A, keys.C };
-    };
   }  // namespace validation
 }  // namespace open_atmos
\ No newline at end of file
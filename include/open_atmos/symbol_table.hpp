@@ -0,0 +1,54 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace open_atmos
+{
+  namespace types
+  {
+    /// @brief A compact identifier for a name stored in a SymbolTable
+    using SymbolId = std::uint32_t;
+
+    /// @brief The identifier given to a name that is not in the symbol table it was looked up in
+    static constexpr SymbolId unknown_symbol = std::numeric_limits<SymbolId>::max();
+
+    /// @brief Stores each distinct name once and identifies it by its position in the order the names were first interned
+    class SymbolTable
+    {
+     public:
+      SymbolTable() = default;
+      SymbolTable(const SymbolTable& other);
+      SymbolTable(SymbolTable&& other) = default;
+      SymbolTable& operator=(const SymbolTable& other);
+      SymbolTable& operator=(SymbolTable&& other) = default;
+
+      /// @brief Adds the name to the table if it is not already there
+      /// @return The identifier of the name
+      SymbolId Intern(std::string_view name);
+
+      /// @brief Returns the identifier of the name, or unknown_symbol if it has not been interned
+      SymbolId Find(std::string_view name) const;
+
+      /// @brief Returns the name with the given identifier
+      /// @throws std::out_of_range if the identifier is not in the table
+      const std::string& Name(SymbolId id) const;
+
+      std::size_t Size() const;
+
+     private:
+      // a deque never moves its elements as it grows, so the keys of the lookup can view the stored names
+      std::deque<std::string> names_;
+      std::unordered_map<std::string_view, SymbolId> ids_;
+    };
+  }  // namespace types
+}  // namespace open_atmos
@@ -5,7 +5,9 @@
 #pragma once
 
 #include <array>
+#include <cstdint>
 #include <map>
+#include <open_atmos/symbol_table.hpp>
 #include <optional>
 #include <string>
 #include <unordered_map>
@@ -33,7 +35,8 @@ namespace open_atmos
 
     struct ReactionComponent
     {
-      std::string species_name;
+      /// @brief The species, as an identifier in Mechanism::species_symbols
+      SymbolId species_id{ unknown_symbol };
       double coefficient{ 1.0 };
       /// @brief Unknown properties, prefixed with two underscores (__)
       std::unordered_map<std::string, std::string> unknown_properties;
@@ -58,8 +61,8 @@ namespace open_atmos
       std::vector<ReactionComponent> products;
       /// @brief An identifier, optional, uniqueness not enforced
       std::string name;
-      /// @brief An identifier indicating which gas phase this reaction takes place in
-      std::string gas_phase;
+      /// @brief An identifier indicating which gas phase this reaction takes place in, in Mechanism::phase_symbols
+      SymbolId gas_phase{ unknown_symbol };
       /// @brief Unknown properties, prefixed with two underscores (__)
       std::unordered_map<std::string, std::string> unknown_properties;
     };
@@ -83,10 +86,10 @@ namespace open_atmos
       std::vector<ReactionComponent> products;
       /// @brief An identifier, optional, uniqueness not enforced
       std::string name;
-      /// @brief An identifier indicating which aerosol phase this reaction takes place in
-      std::string aerosol_phase;
-      /// @brief An identifier indicating the species label of aqueous phase water
-      std::string aerosol_phase_water;
+      /// @brief An identifier indicating which aerosol phase this reaction takes place in, in Mechanism::phase_symbols
+      SymbolId aerosol_phase{ unknown_symbol };
+      /// @brief An identifier indicating the species label of aqueous phase water, in Mechanism::species_symbols
+      SymbolId aerosol_phase_water{ unknown_symbol };
       /// @brief Unknown properties, prefixed with two underscores (__)
       std::unordered_map<std::string, std::string> unknown_properties;
     };
@@ -115,8 +118,8 @@ namespace open_atmos
       std::vector<ReactionComponent> products;
       /// @brief An identifier, optional, uniqueness not enforced
       std::string name;
-      /// @brief An identifier indicating which gas phase this reaction takes place in
-      std::string gas_phase;
+      /// @brief An identifier indicating which gas phase this reaction takes place in, in Mechanism::phase_symbols
+      SymbolId gas_phase{ unknown_symbol };
       /// @brief Unknown properties, prefixed with two underscores (__)
       std::unordered_map<std::string, std::string> unknown_properties;
     };
@@ -139,8 +142,8 @@ namespace open_atmos
       std::vector<ReactionComponent> alkoxy_products;
       /// @brief An identifier, optional, uniqueness not enforced
       std::string name;
-      /// @brief An identifier indicating which gas phase this reaction takes place in
-      std::string gas_phase;
+      /// @brief An identifier indicating which gas phase this reaction takes place in, in Mechanism::phase_symbols
+      SymbolId gas_phase{ unknown_symbol };
       /// @brief Unknown properties, prefixed with two underscores (__)
       std::unordered_map<std::string, std::string> unknown_properties;
     };
@@ -159,8 +162,8 @@ namespace open_atmos
       std::vector<ReactionComponent> products;
       /// @brief An identifier, optional, uniqueness not enforced
       std::string name;
-      /// @brief An identifier indicating which gas phase this reaction takes place in
-      std::string gas_phase;
+      /// @brief An identifier indicating which gas phase this reaction takes place in, in Mechanism::phase_symbols
+      SymbolId gas_phase{ unknown_symbol };
       /// @brief Unknown properties, prefixed with two underscores (__)
       std::unordered_map<std::string, std::string> unknown_properties;
     };
@@ -175,10 +178,10 @@ namespace open_atmos
       std::vector<ReactionComponent> gas_phase_products;
       /// @brief An identifier, optional, uniqueness not enforced
       std::string name;
-      /// @brief An identifier indicating which gas phase this reaction takes place in
-      std::string gas_phase;
-      /// @brief An identifier indicating which aerosol phase this reaction takes place in
-      std::string aerosol_phase;
+      /// @brief An identifier indicating which gas phase this reaction takes place in, in Mechanism::phase_symbols
+      SymbolId gas_phase{ unknown_symbol };
+      /// @brief An identifier indicating which aerosol phase this reaction takes place in, in Mechanism::phase_symbols
+      SymbolId aerosol_phase{ unknown_symbol };
       /// @brief Unknown properties, prefixed with two underscores (__)
       std::unordered_map<std::string, std::string> unknown_properties;
     };
@@ -193,8 +196,8 @@ namespace open_atmos
       std::vector<ReactionComponent> products;
       /// @brief An identifier, optional, uniqueness not enforced
       std::string name;
-      /// @brief An identifier indicating which gas phase this reaction takes place in
-      std::string gas_phase;
+      /// @brief An identifier indicating which gas phase this reaction takes place in, in Mechanism::phase_symbols
+      SymbolId gas_phase{ unknown_symbol };
       /// @brief Unknown properties, prefixed with two underscores (__)
       std::unordered_map<std::string, std::string> unknown_properties;
     };
@@ -209,10 +212,10 @@ namespace open_atmos
       std::vector<ReactionComponent> products;
       /// @brief An identifier, optional, uniqueness not enforced
       std::string name;
-      /// @brief An identifier indicating which aerosol phase this reaction takes place in
-      std::string aerosol_phase;
-      /// @brief An identifier indicating the species label of aqueous phase water
-      std::string aerosol_phase_water;
+      /// @brief An identifier indicating which aerosol phase this reaction takes place in, in Mechanism::phase_symbols
+      SymbolId aerosol_phase{ unknown_symbol };
+      /// @brief An identifier indicating the species label of aqueous phase water, in Mechanism::species_symbols
+      SymbolId aerosol_phase_water{ unknown_symbol };
       /// @brief Unknown properties, prefixed with two underscores (__)
       std::unordered_map<std::string, std::string> unknown_properties;
     };
@@ -225,8 +228,8 @@ namespace open_atmos
       std::vector<ReactionComponent> products;
       /// @brief An identifier, optional, uniqueness not enforced
       std::string name;
-      /// @brief An identifier indicating which gas phase this reaction takes place in
-      std::string gas_phase;
+      /// @brief An identifier indicating which gas phase this reaction takes place in, in Mechanism::phase_symbols
+      SymbolId gas_phase{ unknown_symbol };
       /// @brief Unknown properties, prefixed with two underscores (__)
       std::unordered_map<std::string, std::string> unknown_properties;
     };
@@ -239,8 +242,8 @@ namespace open_atmos
       std::vector<ReactionComponent> reactants;
       /// @brief An identifier, optional, uniqueness not enforced
       std::string name;
-      /// @brief An identifier indicating which gas phase this reaction takes place in
-      std::string gas_phase;
+      /// @brief An identifier indicating which gas phase this reaction takes place in, in Mechanism::phase_symbols
+      SymbolId gas_phase{ unknown_symbol };
       /// @brief Unknown properties, prefixed with two underscores (__)
       std::unordered_map<std::string, std::string> unknown_properties;
     };
@@ -248,12 +251,12 @@ namespace open_atmos
     {
       /// @brief An identifier, optional, uniqueness not enforced
       std::string name;
-      /// @brief An identifier indicating which gas phase this reaction takes place in
-      std::string gas_phase;
-      /// @brief An identifier indicating which aerosol phase this reaction takes place in
-      std::string aerosol_phase;
-      /// @brief An identifier indicating the species label of aqueous phase water
-      std::string aerosol_phase_water;
+      /// @brief An identifier indicating which gas phase this reaction takes place in, in Mechanism::phase_symbols
+      SymbolId gas_phase{ unknown_symbol };
+      /// @brief An identifier indicating which aerosol phase this reaction takes place in, in Mechanism::phase_symbols
+      SymbolId aerosol_phase{ unknown_symbol };
+      /// @brief An identifier indicating the species label of aqueous phase water, in Mechanism::species_symbols
+      SymbolId aerosol_phase_water{ unknown_symbol };
       /// @brief A list of reactants
       std::vector<ReactionComponent> reactants;
       /// @brief A list of products
@@ -274,8 +277,8 @@ namespace open_atmos
       double scaling_factor{ 1.0 };
       /// @brief An identifier, optional, uniqueness not enforced
       std::string name;
-      /// @brief An identifier indicating which aerosol phase this reaction takes place in
-      std::string aerosol_phase;
+      /// @brief An identifier indicating which aerosol phase this reaction takes place in, in Mechanism::phase_symbols
+      SymbolId aerosol_phase{ unknown_symbol };
       /// @brief Unknown properties, prefixed with two underscores (__)
       std::unordered_map<std::string, std::string> unknown_properties;
     };
@@ -284,28 +287,28 @@ namespace open_atmos
     {
       /// @brief An identifier, optional, uniqueness not enforced
       std::string name;
-      /// @brief An identifier indicating which gas phase this reaction takes place in
-      std::string gas_phase;
-      /// @brief An identifier indicating which gas phase species this reaction involves
-      std::string gas_phase_species;
-      /// @brief An identifier indicating which aerosol phase this reaction takes place in
-      std::string aerosol_phase;
-      /// @brief An identifier indicating the species label of aqueous phase water
-      std::string aerosol_phase_water;
-      /// @brief An identifier indicating which aerosol phase species this reaction involves
-      std::string aerosol_phase_species;
+      /// @brief An identifier indicating which gas phase this reaction takes place in, in Mechanism::phase_symbols
+      SymbolId gas_phase{ unknown_symbol };
+      /// @brief An identifier indicating which gas phase species this reaction involves, in Mechanism::species_symbols
+      SymbolId gas_phase_species{ unknown_symbol };
+      /// @brief An identifier indicating which aerosol phase this reaction takes place in, in Mechanism::phase_symbols
+      SymbolId aerosol_phase{ unknown_symbol };
+      /// @brief An identifier indicating the species label of aqueous phase water, in Mechanism::species_symbols
+      SymbolId aerosol_phase_water{ unknown_symbol };
+      /// @brief An identifier indicating which aerosol phase species this reaction involves, in Mechanism::species_symbols
+      SymbolId aerosol_phase_species{ unknown_symbol };
       /// @brief Unknown properties, prefixed with two underscores (__)
       std::unordered_map<std::string, std::string> unknown_properties;
     };
 
     struct SimpolPhaseTransfer
     {
-      /// @brief An identifier indicating which gas phase this reaction takes place in
-      std::string gas_phase;
+      /// @brief An identifier indicating which gas phase this reaction takes place in, in Mechanism::phase_symbols
+      SymbolId gas_phase{ unknown_symbol };
       /// @brief The species in the gas phase participating in this reaction
       ReactionComponent gas_phase_species;
-      /// @brief An identifier indicating which aerosol phase this reaction takes place in
-      std::string aerosol_phase;
+      /// @brief An identifier indicating which aerosol phase this reaction takes place in, in Mechanism::phase_symbols
+      SymbolId aerosol_phase{ unknown_symbol };
       /// @brief The species in the aerosol phase participating in this reaction
       ReactionComponent aerosol_phase_species;
       /// @brief An identifier, optional, uniqueness not enforced
@@ -316,6 +319,25 @@ namespace open_atmos
       std::unordered_map<std::string, std::string> unknown_properties;
     };
 
+    /// @brief The kinds of reaction, in the order their lists appear in Reactions
+    enum class ReactionType : std::uint32_t
+    {
+      Arrhenius,
+      Branched,
+      CondensedPhaseArrhenius,
+      CondensedPhasePhotolysis,
+      Emission,
+      FirstOrderLoss,
+      SimpolPhaseTransfer,
+      AqueousEquilibrium,
+      WetDeposition,
+      HenrysLaw,
+      Photolysis,
+      Surface,
+      Troe,
+      Tunneling
+    };
+
     struct Reactions
     {
       std::vector<types::Arrhenius> arrhenius;
@@ -341,6 +363,12 @@ namespace open_atmos
       std::vector<types::Species> species;
       std::vector<types::Phase> phases;
       Reactions reactions;
+      /// @brief The species names that reactions refer to by identifier. For a mechanism that parsed successfully, the
+      ///        identifier of each species is also its position in species.
+      SymbolTable species_symbols;
+      /// @brief The phase names that reactions refer to by identifier. For a mechanism that parsed successfully, the
+      ///        identifier of each phase is also its position in phases.
+      SymbolTable phase_symbols;
     };
 
   }  // namespace types
@@ -7,63 +7,74 @@ namespace open_atmos
 {
   namespace mechanism_configuration
   {
+    namespace
+    {
+      enum Field
+      {
+        Type,
+        Reactants,
+        Products,
+        AerosolPhase,
+        AerosolPhaseWater,
+        KReverse,
+        Name,
+        A,
+        C,
+        NumberOfFields
+      };
+
+      const ObjectSchema<types::AqueousEquilibrium, NumberOfFields>& Schema()
+      {
+        static const ObjectSchema<types::AqueousEquilibrium, NumberOfFields> schema{ { {
+            { validation::keys.type, FieldPresence::Required },
+            { validation::keys.reactants, FieldPresence::Required },
+            { validation::keys.products, FieldPresence::Required },
+            { validation::keys.aerosol_phase, FieldPresence::Required },
+            { validation::keys.aerosol_phase_water, FieldPresence::Required },
+            { validation::keys.k_reverse, FieldPresence::Required, DecodeMember<&types::AqueousEquilibrium::k_reverse> },
+            { validation::keys.name, FieldPresence::Optional, DecodeMember<&types::AqueousEquilibrium::name> },
+            { validation::keys.A, FieldPresence::Optional, DecodeMember<&types::AqueousEquilibrium::A> },
+            { validation::keys.C, FieldPresence::Optional, DecodeMember<&types::AqueousEquilibrium::C> } } } };
+        return schema;
+      }
+    }  // namespace
+
     ConfigParseStatus AqueousEquilibriumParser::parse(
         const YAML::Node& object,
-        const std::vector<types::Species>& existing_species,
-        const std::vector<types::Phase>& existing_phases,
+        const MechanismIndex& index,
         open_atmos::types::Reactions& reactions)
     {
-      ConfigParseStatus status = ConfigParseStatus::Success;
       types::AqueousEquilibrium aqueous_equilibrium;
+      ObjectFields<NumberOfFields> fields;
 
-      status = ValidateSchema(object, validation::aqueous_equilibrium.required_keys, validation::aqueous_equilibrium.optional_keys);
+      ConfigParseStatus status = DecodeObject(object, Schema(), aqueous_equilibrium, fields);
       if (status == ConfigParseStatus::Success)
       {
-        auto products = ParseReactantsOrProducts(validation::keys.products, object, status);
-        auto reactants = ParseReactantsOrProducts(validation::keys.reactants, object, status);
-
-        if (object[validation::keys.A])
-        {
-          aqueous_equilibrium.A = object[validation::keys.A].as<double>();
-        }
-        if (object[validation::keys.C])
-        {
-          aqueous_equilibrium.C = object[validation::keys.C].as<double>();
-        }
-
-        aqueous_equilibrium.k_reverse = object[validation::keys.k_reverse].as<double>();
+        auto products = ParseReactantsOrProducts(fields[Products], index, status);
+        auto reactants = ParseReactantsOrProducts(fields[Reactants], index, status);
 
-        if (object[validation::keys.name])
-        {
-          aqueous_equilibrium.name = object[validation::keys.name].as<std::string>();
-        }
+        types::SymbolId aerosol_phase = index.FindPhase(fields[AerosolPhase].as<std::string>());
+        types::SymbolId aerosol_phase_water = index.FindSpecies(fields[AerosolPhaseWater].as<std::string>());
 
-        std::string aerosol_phase = object[validation::keys.aerosol_phase].as<std::string>();
-        std::string aerosol_phase_water = object[validation::keys.aerosol_phase_water].as<std::string>();
-
-        std::vector<std::string> requested_species;
+        std::vector<types::SymbolId> requested_species;
         for (const auto& spec : products)
         {
-          requested_species.push_back(spec.species_name);
+          requested_species.push_back(spec.species_id);
         }
         for (const auto& spec : reactants)
         {
-          requested_species.push_back(spec.species_name);
+          requested_species.push_back(spec.species_id);
         }
         requested_species.push_back(aerosol_phase_water);
 
-        if (status == ConfigParseStatus::Success && RequiresUnknownSpecies(requested_species, existing_species))
+        if (status == ConfigParseStatus::Success && index.RequiresUnknownSpecies(requested_species))
         {
           status = ConfigParseStatus::ReactionRequiresUnknownSpecies;
         }
 
-        auto phase_it = std::find_if(
-            existing_phases.begin(), existing_phases.end(), [&aerosol_phase](const types::Phase& phase) { return phase.name == aerosol_phase; });
-
-        if (phase_it != existing_phases.end())
+        if (aerosol_phase != types::unknown_symbol)
         {
-          std::vector<std::string> aerosol_phase_species = { (*phase_it).species.begin(), (*phase_it).species.end() };
-          if (status == ConfigParseStatus::Success && RequiresUnknownSpecies(requested_species, aerosol_phase_species))
+          if (status == ConfigParseStatus::Success && index.RequiresSpeciesOutsidePhase(requested_species, aerosol_phase))
           {
             status = ConfigParseStatus::RequestedAerosolSpeciesNotIncludedInAerosolPhase;
           }
@@ -77,8 +88,6 @@ namespace open_atmos
         aqueous_equilibrium.aerosol_phase_water = aerosol_phase_water;
         aqueous_equilibrium.products = products;
         aqueous_equilibrium.reactants = reactants;
-        aqueous_equilibrium.unknown_properties =
-            GetComments(object, validation::aqueous_equilibrium.required_keys, validation::aqueous_equilibrium.optional_keys);
         reactions.aqueous_equilibrium.push_back(aqueous_equilibrium);
       }
 
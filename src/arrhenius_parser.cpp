@@ -7,74 +7,89 @@ namespace open_atmos
 {
   namespace mechanism_configuration
   {
+    namespace
+    {
+      enum Field
+      {
+        Products,
+        Reactants,
+        Type,
+        GasPhase,
+        Name,
+        A,
+        B,
+        C,
+        D,
+        E,
+        Ea,
+        NumberOfFields
+      };
+
+      const ObjectSchema<types::Arrhenius, NumberOfFields>& Schema()
+      {
+        static const ObjectSchema<types::Arrhenius, NumberOfFields> schema{ { {
+            { validation::keys.products, FieldPresence::Required },
+            { validation::keys.reactants, FieldPresence::Required },
+            { validation::keys.type, FieldPresence::Required },
+            { validation::keys.gas_phase, FieldPresence::Required },
+            { validation::keys.name, FieldPresence::Optional, DecodeMember<&types::Arrhenius::name> },
+            { validation::keys.A, FieldPresence::Optional, DecodeMember<&types::Arrhenius::A> },
+            { validation::keys.B, FieldPresence::Optional, DecodeMember<&types::Arrhenius::B> },
+            { validation::keys.C, FieldPresence::Optional, DecodeMember<&types::Arrhenius::C> },
+            { validation::keys.D, FieldPresence::Optional, DecodeMember<&types::Arrhenius::D> },
+            { validation::keys.E, FieldPresence::Optional, DecodeMember<&types::Arrhenius::E> },
+            { validation::keys.Ea, FieldPresence::Optional }
+        } } };
+        return schema;
+      }
+    }  // namespace
+
     ConfigParseStatus ArrheniusParser::parse(
         const YAML::Node& object,
-        const std::vector<types::Species>& existing_species,
-        const std::vector<types::Phase>& existing_phases,
+        const MechanismIndex& index,
         open_atmos::types::Reactions& reactions)
     {
-      ConfigParseStatus status = ConfigParseStatus::Success;
       types::Arrhenius arrhenius;
+      ObjectFields<NumberOfFields> fields;
 
-      status = ValidateSchema(object, validation::arrhenius.required_keys, validation::arrhenius.optional_keys);
+      ConfigParseStatus status = DecodeObject(object, Schema(), arrhenius, fields);
       if (status == ConfigParseStatus::Success)
       {
-        auto products = ParseReactantsOrProducts(validation::keys.products, object, status);
-        auto reactants = ParseReactantsOrProducts(validation::keys.reactants, object, status);
+        auto products = ParseReactantsOrProducts(fields[Products], index, status);
+        auto reactants = ParseReactantsOrProducts(fields[Reactants], index, status);
 
-        if (object[validation::keys.A])
-        {
-          arrhenius.A = object[validation::keys.A].as<double>();
-        }
-        if (object[validation::keys.B])
-        {
-          arrhenius.B = object[validation::keys.B].as<double>();
-        }
-        if (object[validation::keys.C])
-        {
-          arrhenius.C = object[validation::keys.C].as<double>();
-        }
-        if (object[validation::keys.D])
-        {
-          arrhenius.D = object[validation::keys.D].as<double>();
-        }
-        if (object[validation::keys.E])
-        {
-          arrhenius.E = object[validation::keys.E].as<double>();
-        }
-        if (object[validation::keys.Ea])
+        if (fields.Has(Ea))
         {
           if (arrhenius.C != 0)
           {
             std::cerr << "Ea is specified when C is also specified for an Arrhenius reaction. Pick one." << std::endl;
             status = ConfigParseStatus::MutuallyExclusiveOption;
           }
-          arrhenius.C = -1 * object[validation::keys.Ea].as<double>() / constants::boltzmann;
-        }
-
-        if (object[validation::keys.name])
-        {
-          arrhenius.name = object[validation::keys.name].as<std::string>();
+          double ea = 0;
+          if (DecodeNumber(fields[Ea], ea) != ConfigParseStatus::Success)
+          {
+            status = ConfigParseStatus::InvalidNumericValue;
+          }
+          arrhenius.C = -1 * ea / constants::boltzmann;
         }
 
-        std::vector<std::string> requested_species;
+        std::vector<types::SymbolId> requested_species;
         for (const auto& spec : products)
         {
-          requested_species.push_back(spec.species_name);
+          requested_species.push_back(spec.species_id);
         }
         for (const auto& spec : reactants)
         {
-          requested_species.push_back(spec.species_name);
+          requested_species.push_back(spec.species_id);
         }
 
-        if (status == ConfigParseStatus::Success && RequiresUnknownSpecies(requested_species, existing_species))
+        if (status == ConfigParseStatus::Success && index.RequiresUnknownSpecies(requested_species))
         {
           status = ConfigParseStatus::ReactionRequiresUnknownSpecies;
         }
 
-        std::string gas_phase = object[validation::keys.gas_phase].as<std::string>();
-        auto it = std::find_if(existing_phases.begin(), existing_phases.end(), [&gas_phase](const auto& phase) { return phase.name == gas_phase; });
-        if (status == ConfigParseStatus::Success && it == existing_phases.end())
+        types::SymbolId gas_phase = index.FindPhase(fields[GasPhase].as<std::string>());
+        if (status == ConfigParseStatus::Success && gas_phase == types::unknown_symbol)
         {
           status = ConfigParseStatus::UnknownPhase;
         }
@@ -82,7 +97,6 @@ namespace open_atmos
         arrhenius.gas_phase = gas_phase;
         arrhenius.products = products;
         arrhenius.reactants = reactants;
-        arrhenius.unknown_properties = GetComments(object, validation::arrhenius.required_keys, validation::arrhenius.optional_keys);
         reactions.arrhenius.push_back(arrhenius);
       }
 
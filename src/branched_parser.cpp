@@ -7,54 +7,91 @@ namespace open_atmos
 {
   namespace mechanism_configuration
   {
+    namespace
+    {
+      enum Field
+      {
+        NitrateProducts,
+        AlkoxyProducts,
+        Reactants,
+        Type,
+        GasPhase,
+        Name,
+        X,
+        Y,
+        A0,
+        N,
+        NumberOfFields
+      };
+
+      const ObjectSchema<types::Branched, NumberOfFields>& Schema()
+      {
+        static const ObjectSchema<types::Branched, NumberOfFields> schema{ { {
+            { validation::keys.nitrate_products, FieldPresence::Required },
+            { validation::keys.alkoxy_products, FieldPresence::Required },
+            { validation::keys.reactants, FieldPresence::Required },
+            { validation::keys.type, FieldPresence::Required },
+            { validation::keys.gas_phase, FieldPresence::Required },
+            { validation::keys.name, FieldPresence::Optional, DecodeMember<&types::Branched::name> },
+            { validation::keys.X, FieldPresence::Optional },
+            { validation::keys.Y, FieldPresence::Optional },
+            { validation::keys.a0, FieldPresence::Optional },
+            { validation::keys.n, FieldPresence::Optional } } } };
+        return schema;
+      }
+    }  // namespace
+
     ConfigParseStatus BranchedParser::parse(
         const YAML::Node& object,
-        const std::vector<types::Species>& existing_species,
-        const std::vector<types::Phase>& existing_phases,
+        const MechanismIndex& index,
         open_atmos::types::Reactions& reactions)
     {
-      ConfigParseStatus status = ConfigParseStatus::Success;
       types::Branched branched;
+      ObjectFields<NumberOfFields> fields;
 
-      status = ValidateSchema(object, validation::branched.required_keys, validation::branched.optional_keys);
+      ConfigParseStatus status = DecodeObject(object, Schema(), branched, fields);
       if (status == ConfigParseStatus::Success)
       {
-        auto alkoxy_products = ParseReactantsOrProducts(validation::keys.alkoxy_products, object, status);
-        auto nitrate_products = ParseReactantsOrProducts(validation::keys.nitrate_products, object, status);
-        auto reactants = ParseReactantsOrProducts(validation::keys.reactants, object, status);
+        auto alkoxy_products = ParseReactantsOrProducts(fields[AlkoxyProducts], index, status);
+        auto nitrate_products = ParseReactantsOrProducts(fields[NitrateProducts], index, status);
+        auto reactants = ParseReactantsOrProducts(fields[Reactants], index, status);
 
-        branched.X = object[validation::keys.X].as<double>();
-        branched.Y = object[validation::keys.Y].as<double>();
-        branched.a0 = object[validation::keys.a0].as<double>();
-        branched.n = object[validation::keys.n].as<double>();
-
-        if (object[validation::keys.name])
+        auto decode = [&](Field field, double& value)
         {
-          branched.name = object[validation::keys.name].as<std::string>();
-        }
+          ConfigParseStatus field_status = DecodeNumber(fields[field], value);
+          if (status == ConfigParseStatus::Success)
+          {
+            status = field_status;
+          }
+        };
+        double n = 0;
+        decode(X, branched.X);
+        decode(Y, branched.Y);
+        decode(A0, branched.a0);
+        decode(N, n);
+        branched.n = static_cast<int>(n);
 
-        std::vector<std::string> requested_species;
+        std::vector<types::SymbolId> requested_species;
         for (const auto& spec : nitrate_products)
         {
-          requested_species.push_back(spec.species_name);
+          requested_species.push_back(spec.species_id);
         }
         for (const auto& spec : alkoxy_products)
         {
-          requested_species.push_back(spec.species_name);
+          requested_species.push_back(spec.species_id);
         }
         for (const auto& spec : reactants)
         {
-          requested_species.push_back(spec.species_name);
+          requested_species.push_back(spec.species_id);
         }
 
-        if (status == ConfigParseStatus::Success && RequiresUnknownSpecies(requested_species, existing_species))
+        if (status == ConfigParseStatus::Success && index.RequiresUnknownSpecies(requested_species))
         {
           status = ConfigParseStatus::ReactionRequiresUnknownSpecies;
         }
 
-        std::string gas_phase = object[validation::keys.gas_phase].as<std::string>();
-        auto it = std::find_if(existing_phases.begin(), existing_phases.end(), [&gas_phase](const auto& phase) { return phase.name == gas_phase; });
-        if (status == ConfigParseStatus::Success && it == existing_phases.end())
+        types::SymbolId gas_phase = index.FindPhase(fields[GasPhase].as<std::string>());
+        if (status == ConfigParseStatus::Success && gas_phase == types::unknown_symbol)
         {
           status = ConfigParseStatus::UnknownPhase;
         }
@@ -63,7 +100,6 @@ namespace open_atmos
         branched.nitrate_products = nitrate_products;
         branched.alkoxy_products = alkoxy_products;
         branched.reactants = reactants;
-        branched.unknown_properties = GetComments(object, validation::branched.required_keys, validation::branched.optional_keys);
         reactions.branched.push_back(branched);
       }
 
@@ -0,0 +1,245 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <initializer_list>
+#include <open_atmos/mechanism_configuration/compiled_mechanism.hpp>
+
+namespace open_atmos
+{
+  namespace mechanism_configuration
+  {
+    namespace
+    {
+      void Append(compiled::ComponentLists& lists, const std::vector<types::ReactionComponent>& components)
+      {
+        for (const auto& component : components)
+        {
+          lists.species.push_back(component.species_id);
+          lists.coefficients.push_back(component.coefficient);
+        }
+        lists.offsets.push_back(static_cast<std::uint32_t>(lists.species.size()));
+      }
+
+      void Append(compiled::ComponentLists& lists, types::SymbolId species_id, double coefficient)
+      {
+        lists.species.push_back(species_id);
+        lists.coefficients.push_back(coefficient);
+        lists.offsets.push_back(static_cast<std::uint32_t>(lists.species.size()));
+      }
+
+      void AppendEmpty(compiled::ComponentLists& lists)
+      {
+        lists.offsets.push_back(static_cast<std::uint32_t>(lists.species.size()));
+      }
+
+      /// @brief Builds the compiled mechanism one reaction at a time. Each Add fills the common columns for one kind of
+      ///        reaction and appends its parameters, following the layout documented on CompiledMechanism.
+      class Compiler
+      {
+       public:
+        explicit Compiler(CompiledMechanism& compiled)
+            : compiled_(compiled)
+        {
+          compiled_.reactants.offsets.push_back(0);
+          compiled_.products.offsets.push_back(0);
+          compiled_.alternative_products.offsets.push_back(0);
+        }
+
+        template<typename T>
+        void AddAll(types::ReactionType type, const std::vector<T>& reactions)
+        {
+          compiled_.type_offsets[static_cast<std::size_t>(type)] = compiled_.types.size();
+          for (const auto& reaction : reactions)
+          {
+            compiled_.types.push_back(type);
+            compiled_.gas_phase.push_back(types::unknown_symbol);
+            compiled_.aerosol_phase.push_back(types::unknown_symbol);
+            compiled_.aerosol_phase_water.push_back(types::unknown_symbol);
+            Add(reaction);
+            // lists a reaction type does not fill stay empty
+            for (auto* lists : { &compiled_.reactants, &compiled_.products, &compiled_.alternative_products })
+            {
+              if (lists->offsets.size() < compiled_.types.size() + 1)
+              {
+                AppendEmpty(*lists);
+              }
+            }
+          }
+        }
+
+       private:
+        void Add(const types::Arrhenius& reaction)
+        {
+          AddArrhenius(compiled_.arrhenius, reaction);
+          compiled_.gas_phase.back() = reaction.gas_phase;
+        }
+
+        void Add(const types::Branched& reaction)
+        {
+          compiled_.branched.X.push_back(reaction.X);
+          compiled_.branched.Y.push_back(reaction.Y);
+          compiled_.branched.a0.push_back(reaction.a0);
+          compiled_.branched.n.push_back(reaction.n);
+          compiled_.gas_phase.back() = reaction.gas_phase;
+          Append(compiled_.reactants, reaction.reactants);
+          Append(compiled_.products, reaction.nitrate_products);
+          Append(compiled_.alternative_products, reaction.alkoxy_products);
+        }
+
+        void Add(const types::CondensedPhaseArrhenius& reaction)
+        {
+          AddArrhenius(compiled_.condensed_phase_arrhenius, reaction);
+          compiled_.aerosol_phase.back() = reaction.aerosol_phase;
+          compiled_.aerosol_phase_water.back() = reaction.aerosol_phase_water;
+        }
+
+        void Add(const types::CondensedPhasePhotolysis& reaction)
+        {
+          compiled_.condensed_phase_photolysis.push_back(reaction.scaling_factor_);
+          compiled_.aerosol_phase.back() = reaction.aerosol_phase;
+          compiled_.aerosol_phase_water.back() = reaction.aerosol_phase_water;
+          Append(compiled_.reactants, reaction.reactants);
+          Append(compiled_.products, reaction.products);
+        }
+
+        void Add(const types::Emission& reaction)
+        {
+          compiled_.emission.push_back(reaction.scaling_factor);
+          compiled_.gas_phase.back() = reaction.gas_phase;
+          Append(compiled_.products, reaction.products);
+        }
+
+        void Add(const types::FirstOrderLoss& reaction)
+        {
+          compiled_.first_order_loss.push_back(reaction.scaling_factor);
+          compiled_.gas_phase.back() = reaction.gas_phase;
+          Append(compiled_.reactants, reaction.reactants);
+        }
+
+        void Add(const types::SimpolPhaseTransfer& reaction)
+        {
+          compiled_.simpol_phase_transfer.B0.push_back(reaction.B[0]);
+          compiled_.simpol_phase_transfer.B1.push_back(reaction.B[1]);
+          compiled_.simpol_phase_transfer.B2.push_back(reaction.B[2]);
+          compiled_.simpol_phase_transfer.B3.push_back(reaction.B[3]);
+          compiled_.gas_phase.back() = reaction.gas_phase;
+          compiled_.aerosol_phase.back() = reaction.aerosol_phase;
+          Append(compiled_.reactants, reaction.gas_phase_species.species_id, reaction.gas_phase_species.coefficient);
+          Append(compiled_.products, reaction.aerosol_phase_species.species_id, reaction.aerosol_phase_species.coefficient);
+        }
+
+        void Add(const types::AqueousEquilibrium& reaction)
+        {
+          compiled_.aqueous_equilibrium.A.push_back(reaction.A);
+          compiled_.aqueous_equilibrium.C.push_back(reaction.C);
+          compiled_.aqueous_equilibrium.k_reverse.push_back(reaction.k_reverse);
+          compiled_.gas_phase.back() = reaction.gas_phase;
+          compiled_.aerosol_phase.back() = reaction.aerosol_phase;
+          compiled_.aerosol_phase_water.back() = reaction.aerosol_phase_water;
+          Append(compiled_.reactants, reaction.reactants);
+          Append(compiled_.products, reaction.products);
+        }
+
+        void Add(const types::WetDeposition& reaction)
+        {
+          compiled_.wet_deposition.push_back(reaction.scaling_factor);
+          compiled_.aerosol_phase.back() = reaction.aerosol_phase;
+        }
+
+        void Add(const types::HenrysLaw& reaction)
+        {
+          compiled_.gas_phase.back() = reaction.gas_phase;
+          compiled_.aerosol_phase.back() = reaction.aerosol_phase;
+          compiled_.aerosol_phase_water.back() = reaction.aerosol_phase_water;
+          Append(compiled_.reactants, reaction.gas_phase_species, 1.0);
+          Append(compiled_.products, reaction.aerosol_phase_species, 1.0);
+        }
+
+        void Add(const types::Photolysis& reaction)
+        {
+          compiled_.photolysis.push_back(reaction.scaling_factor);
+          compiled_.gas_phase.back() = reaction.gas_phase;
+          Append(compiled_.reactants, reaction.reactants);
+          Append(compiled_.products, reaction.products);
+        }
+
+        void Add(const types::Surface& reaction)
+        {
+          compiled_.surface.push_back(reaction.reaction_probability);
+          compiled_.gas_phase.back() = reaction.gas_phase;
+          compiled_.aerosol_phase.back() = reaction.aerosol_phase;
+          Append(compiled_.reactants, reaction.gas_phase_species.species_id, reaction.gas_phase_species.coefficient);
+          Append(compiled_.products, reaction.gas_phase_products);
+        }
+
+        void Add(const types::Troe& reaction)
+        {
+          compiled::TroeParameters& troe = compiled_.troe;
+          troe.k0_A.push_back(reaction.k0_A);
+          troe.k0_B.push_back(reaction.k0_B);
+          troe.k0_C.push_back(reaction.k0_C);
+          troe.kinf_A.push_back(reaction.kinf_A);
+          troe.kinf_B.push_back(reaction.kinf_B);
+          troe.kinf_C.push_back(reaction.kinf_C);
+          troe.Fc.push_back(reaction.Fc);
+          troe.N.push_back(reaction.N);
+          compiled_.gas_phase.back() = reaction.gas_phase;
+          Append(compiled_.reactants, reaction.reactants);
+          Append(compiled_.products, reaction.products);
+        }
+
+        void Add(const types::Tunneling& reaction)
+        {
+          compiled_.tunneling.A.push_back(reaction.A);
+          compiled_.tunneling.B.push_back(reaction.B);
+          compiled_.tunneling.C.push_back(reaction.C);
+          compiled_.gas_phase.back() = reaction.gas_phase;
+          Append(compiled_.reactants, reaction.reactants);
+          Append(compiled_.products, reaction.products);
+        }
+
+        template<typename T>
+        void AddArrhenius(compiled::ArrheniusParameters& parameters, const T& reaction)
+        {
+          parameters.A.push_back(reaction.A);
+          parameters.B.push_back(reaction.B);
+          parameters.C.push_back(reaction.C);
+          parameters.D.push_back(reaction.D);
+          parameters.E.push_back(reaction.E);
+          Append(compiled_.reactants, reaction.reactants);
+          Append(compiled_.products, reaction.products);
+        }
+
+        CompiledMechanism& compiled_;
+      };
+    }  // namespace
+
+    CompiledMechanism Compile(const types::Mechanism& mechanism)
+    {
+      CompiledMechanism compiled;
+      compiled.number_of_species = mechanism.species.size();
+
+      const types::Reactions& reactions = mechanism.reactions;
+      Compiler compiler(compiled);
+      compiler.AddAll(types::ReactionType::Arrhenius, reactions.arrhenius);
+      compiler.AddAll(types::ReactionType::Branched, reactions.branched);
+      compiler.AddAll(types::ReactionType::CondensedPhaseArrhenius, reactions.condensed_phase_arrhenius);
+      compiler.AddAll(types::ReactionType::CondensedPhasePhotolysis, reactions.condensed_phase_photolysis);
+      compiler.AddAll(types::ReactionType::Emission, reactions.emission);
+      compiler.AddAll(types::ReactionType::FirstOrderLoss, reactions.first_order_loss);
+      compiler.AddAll(types::ReactionType::SimpolPhaseTransfer, reactions.simpol_phase_transfer);
+      compiler.AddAll(types::ReactionType::AqueousEquilibrium, reactions.aqueous_equilibrium);
+      compiler.AddAll(types::ReactionType::WetDeposition, reactions.wet_deposition);
+      compiler.AddAll(types::ReactionType::HenrysLaw, reactions.henrys_law);
+      compiler.AddAll(types::ReactionType::Photolysis, reactions.photolysis);
+      compiler.AddAll(types::ReactionType::Surface, reactions.surface);
+      compiler.AddAll(types::ReactionType::Troe, reactions.troe);
+      compiler.AddAll(types::ReactionType::Tunneling, reactions.tunneling);
+
+      compiled.number_of_reactions = compiled.types.size();
+      compiled.type_offsets[number_of_reaction_types] = compiled.number_of_reactions;
+      return compiled;
+    }
+  }  // namespace mechanism_configuration
+}  // namespace open_atmos
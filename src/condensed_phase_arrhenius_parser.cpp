@@ -7,82 +7,95 @@ namespace open_atmos
 {
   namespace mechanism_configuration
   {
+    namespace
+    {
+      enum Field
+      {
+        Products,
+        Reactants,
+        Type,
+        AerosolPhase,
+        AerosolPhaseWater,
+        Name,
+        A,
+        B,
+        C,
+        D,
+        E,
+        Ea,
+        NumberOfFields
+      };
+
+      const ObjectSchema<types::CondensedPhaseArrhenius, NumberOfFields>& Schema()
+      {
+        static const ObjectSchema<types::CondensedPhaseArrhenius, NumberOfFields> schema{ { {
+            { validation::keys.products, FieldPresence::Required },
+            { validation::keys.reactants, FieldPresence::Required },
+            { validation::keys.type, FieldPresence::Required },
+            { validation::keys.aerosol_phase, FieldPresence::Required },
+            { validation::keys.aerosol_phase_water, FieldPresence::Required },
+            { validation::keys.name, FieldPresence::Optional, DecodeMember<&types::CondensedPhaseArrhenius::name> },
+            { validation::keys.A, FieldPresence::Optional, DecodeMember<&types::CondensedPhaseArrhenius::A> },
+            { validation::keys.B, FieldPresence::Optional, DecodeMember<&types::CondensedPhaseArrhenius::B> },
+            { validation::keys.C, FieldPresence::Optional, DecodeMember<&types::CondensedPhaseArrhenius::C> },
+            { validation::keys.D, FieldPresence::Optional, DecodeMember<&types::CondensedPhaseArrhenius::D> },
+            { validation::keys.E, FieldPresence::Optional, DecodeMember<&types::CondensedPhaseArrhenius::E> },
+            { validation::keys.Ea, FieldPresence::Optional } } } };
+        return schema;
+      }
+    }  // namespace
+
     ConfigParseStatus CondensedPhaseArrheniusParser::parse(
         const YAML::Node& object,
-        const std::vector<types::Species>& existing_species,
-        const std::vector<types::Phase>& existing_phases,
+        const MechanismIndex& index,
         open_atmos::types::Reactions& reactions)
     {
-      ConfigParseStatus status = ConfigParseStatus::Success;
       types::CondensedPhaseArrhenius condensed_phase_arrhenius;
+      ObjectFields<NumberOfFields> fields;
 
-      status = ValidateSchema(object, validation::condensed_phase_arrhenius.required_keys, validation::condensed_phase_arrhenius.optional_keys);
+      ConfigParseStatus status = DecodeObject(object, Schema(), condensed_phase_arrhenius, fields);
       if (status == ConfigParseStatus::Success)
       {
-        auto products = ParseReactantsOrProducts(validation::keys.products, object, status);
-        auto reactants = ParseReactantsOrProducts(validation::keys.reactants, object, status);
+        auto products = ParseReactantsOrProducts(fields[Products], index, status);
+        auto reactants = ParseReactantsOrProducts(fields[Reactants], index, status);
 
-        if (object[validation::keys.A])
-        {
-          condensed_phase_arrhenius.A = object[validation::keys.A].as<double>();
-        }
-        if (object[validation::keys.B])
-        {
-          condensed_phase_arrhenius.B = object[validation::keys.B].as<double>();
-        }
-        if (object[validation::keys.C])
-        {
-          condensed_phase_arrhenius.C = object[validation::keys.C].as<double>();
-        }
-        if (object[validation::keys.D])
-        {
-          condensed_phase_arrhenius.D = object[validation::keys.D].as<double>();
-        }
-        if (object[validation::keys.E])
-        {
-          condensed_phase_arrhenius.E = object[validation::keys.E].as<double>();
-        }
-        if (object[validation::keys.Ea])
+        if (fields.Has(Ea))
         {
           if (condensed_phase_arrhenius.C != 0)
           {
             std::cerr << "Ea is specified when C is also specified for an CondensedPhasecondensed_phase_arrhenius reaction. Pick one." << std::endl;
             status = ConfigParseStatus::MutuallyExclusiveOption;
           }
-          condensed_phase_arrhenius.C = -1 * object[validation::keys.Ea].as<double>() / constants::boltzmann;
-        }
-
-        if (object[validation::keys.name])
-        {
-          condensed_phase_arrhenius.name = object[validation::keys.name].as<std::string>();
+          double ea = 0;
+          if (DecodeNumber(fields[Ea], ea) != ConfigParseStatus::Success)
+          {
+            status = ConfigParseStatus::InvalidNumericValue;
+          }
+          condensed_phase_arrhenius.C = -1 * ea / constants::boltzmann;
         }
 
-        std::string aerosol_phase = object[validation::keys.aerosol_phase].as<std::string>();
-        std::string aerosol_phase_water = object[validation::keys.aerosol_phase_water].as<std::string>();
+        types::SymbolId aerosol_phase = index.FindPhase(fields[AerosolPhase].as<std::string>());
+        types::SymbolId aerosol_phase_water = index.FindSpecies(fields[AerosolPhaseWater].as<std::string>());
 
-        std::vector<std::string> requested_species;
+        std::vector<types::SymbolId> requested_species;
         for (const auto& spec : products)
         {
-          requested_species.push_back(spec.species_name);
+          requested_species.push_back(spec.species_id);
         }
         for (const auto& spec : reactants)
         {
-          requested_species.push_back(spec.species_name);
+          requested_species.push_back(spec.species_id);
         }
         requested_species.push_back(aerosol_phase_water);
 
-        if (status == ConfigParseStatus::Success && RequiresUnknownSpecies(requested_species, existing_species))
+        if (status == ConfigParseStatus::Success && index.RequiresUnknownSpecies(requested_species))
         {
           status = ConfigParseStatus::ReactionRequiresUnknownSpecies;
         }
 
-        auto phase_it = std::find_if(
-            existing_phases.begin(), existing_phases.end(), [&aerosol_phase](const types::Phase& phase) { return phase.name == aerosol_phase; });
-
-        if (phase_it != existing_phases.end())
+        if (aerosol_phase != types::unknown_symbol)
         {
-          std::vector<std::string> aerosol_phase_species = { (*phase_it).species.begin(), (*phase_it).species.end() };
-          if (status == ConfigParseStatus::Success && RequiresUnknownSpecies(requested_species, aerosol_phase_species))
+          if (status == ConfigParseStatus::Success && index.RequiresSpeciesOutsidePhase(requested_species, aerosol_phase))
           {
             status = ConfigParseStatus::RequestedAerosolSpeciesNotIncludedInAerosolPhase;
           }
@@ -96,8 +109,6 @@ namespace open_atmos
         condensed_phase_arrhenius.aerosol_phase_water = aerosol_phase_water;
         condensed_phase_arrhenius.products = products;
         condensed_phase_arrhenius.reactants = reactants;
-        condensed_phase_arrhenius.unknown_properties =
-            GetComments(object, validation::condensed_phase_arrhenius.required_keys, validation::condensed_phase_arrhenius.optional_keys);
         reactions.condensed_phase_arrhenius.push_back(condensed_phase_arrhenius);
       }
 
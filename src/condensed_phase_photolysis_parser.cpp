@@ -7,46 +7,63 @@ namespace open_atmos
 {
   namespace mechanism_configuration
   {
+    namespace
+    {
+      enum Field
+      {
+        Reactants,
+        Products,
+        Type,
+        AerosolPhase,
+        AerosolPhaseWater,
+        Name,
+        ScalingFactor,
+        NumberOfFields
+      };
+
+      const ObjectSchema<types::CondensedPhasePhotolysis, NumberOfFields>& Schema()
+      {
+        static const ObjectSchema<types::CondensedPhasePhotolysis, NumberOfFields> schema{ { {
+            { validation::keys.reactants, FieldPresence::Required },
+            { validation::keys.products, FieldPresence::Required },
+            { validation::keys.type, FieldPresence::Required },
+            { validation::keys.aerosol_phase, FieldPresence::Required },
+            { validation::keys.aerosol_phase_water, FieldPresence::Required },
+            { validation::keys.name, FieldPresence::Optional, DecodeMember<&types::CondensedPhasePhotolysis::name> },
+            { validation::keys.scaling_factor, FieldPresence::Optional, DecodeMember<&types::CondensedPhasePhotolysis::scaling_factor_> } } } };
+        return schema;
+      }
+    }  // namespace
+
     ConfigParseStatus CondensedPhasePhotolysisParser::parse(
         const YAML::Node& object,
-        const std::vector<types::Species>& existing_species,
-        const std::vector<types::Phase>& existing_phases,
+        const MechanismIndex& index,
         open_atmos::types::Reactions& reactions)
     {
-      ConfigParseStatus status = ConfigParseStatus::Success;
       types::CondensedPhasePhotolysis condensed_phase_photolysis;
+      ObjectFields<NumberOfFields> fields;
 
-      status = ValidateSchema(object, validation::condensed_phase_photolysis.required_keys, validation::photolysis.optional_keys);
+      ConfigParseStatus status = DecodeObject(object, Schema(), condensed_phase_photolysis, fields);
       if (status == ConfigParseStatus::Success)
       {
-        auto products = ParseReactantsOrProducts(validation::keys.products, object, status);
-        auto reactants = ParseReactantsOrProducts(validation::keys.reactants, object, status);
+        auto products = ParseReactantsOrProducts(fields[Products], index, status);
+        auto reactants = ParseReactantsOrProducts(fields[Reactants], index, status);
 
-        if (object[validation::keys.scaling_factor])
-        {
-          condensed_phase_photolysis.scaling_factor_ = object[validation::keys.scaling_factor].as<double>();
-        }
-
-        if (object[validation::keys.name])
-        {
-          condensed_phase_photolysis.name = object[validation::keys.name].as<std::string>();
-        }
-
-        std::string aerosol_phase = object[validation::keys.aerosol_phase].as<std::string>();
-        std::string aerosol_phase_water = object[validation::keys.aerosol_phase_water].as<std::string>();
+        types::SymbolId aerosol_phase = index.FindPhase(fields[AerosolPhase].as<std::string>());
+        types::SymbolId aerosol_phase_water = index.FindSpecies(fields[AerosolPhaseWater].as<std::string>());
 
-        std::vector<std::string> requested_species;
+        std::vector<types::SymbolId> requested_species;
         for (const auto& spec : products)
         {
-          requested_species.push_back(spec.species_name);
+          requested_species.push_back(spec.species_id);
         }
         for (const auto& spec : reactants)
         {
-          requested_species.push_back(spec.species_name);
+          requested_species.push_back(spec.species_id);
         }
         requested_species.push_back(aerosol_phase_water);
 
-        if (status == ConfigParseStatus::Success && RequiresUnknownSpecies(requested_species, existing_species))
+        if (status == ConfigParseStatus::Success && index.RequiresUnknownSpecies(requested_species))
         {
           status = ConfigParseStatus::ReactionRequiresUnknownSpecies;
         }
@@ -56,13 +73,9 @@ namespace open_atmos
           status = ConfigParseStatus::TooManyReactionComponents;
         }
 
-        auto phase_it = std::find_if(
-            existing_phases.begin(), existing_phases.end(), [&aerosol_phase](const types::Phase& phase) { return phase.name == aerosol_phase; });
-
-        if (phase_it != existing_phases.end())
+        if (aerosol_phase != types::unknown_symbol)
         {
-          std::vector<std::string> aerosol_phase_species = { (*phase_it).species.begin(), (*phase_it).species.end() };
-          if (status == ConfigParseStatus::Success && RequiresUnknownSpecies(requested_species, aerosol_phase_species))
+          if (status == ConfigParseStatus::Success && index.RequiresSpeciesOutsidePhase(requested_species, aerosol_phase))
           {
             status = ConfigParseStatus::RequestedAerosolSpeciesNotIncludedInAerosolPhase;
           }
@@ -76,8 +89,6 @@ namespace open_atmos
         condensed_phase_photolysis.aerosol_phase_water = aerosol_phase_water;
         condensed_phase_photolysis.products = products;
         condensed_phase_photolysis.reactants = reactants;
-        condensed_phase_photolysis.unknown_properties =
-            GetComments(object, validation::condensed_phase_photolysis.required_keys, validation::photolysis.optional_keys);
         reactions.condensed_phase_photolysis.push_back(condensed_phase_photolysis);
       }
 
@@ -7,51 +7,62 @@ namespace open_atmos
 {
   namespace mechanism_configuration
   {
+    namespace
+    {
+      enum Field
+      {
+        Products,
+        Type,
+        GasPhase,
+        Name,
+        ScalingFactor,
+        NumberOfFields
+      };
+
+      const ObjectSchema<types::Emission, NumberOfFields>& Schema()
+      {
+        static const ObjectSchema<types::Emission, NumberOfFields> schema{ { {
+            { validation::keys.products, FieldPresence::Required },
+            { validation::keys.type, FieldPresence::Required },
+            { validation::keys.gas_phase, FieldPresence::Required },
+            { validation::keys.name, FieldPresence::Optional, DecodeMember<&types::Emission::name> },
+            { validation::keys.scaling_factor, FieldPresence::Optional, DecodeMember<&types::Emission::scaling_factor> } } } };
+        return schema;
+      }
+    }  // namespace
+
     ConfigParseStatus EmissionParser::parse(
         const YAML::Node& object,
-        const std::vector<types::Species>& existing_species,
-        const std::vector<types::Phase>& existing_phases,
+        const MechanismIndex& index,
         open_atmos::types::Reactions& reactions)
     {
-      ConfigParseStatus status = ConfigParseStatus::Success;
       types::Emission emission;
+      ObjectFields<NumberOfFields> fields;
 
-      status = ValidateSchema(object, validation::emission.required_keys, validation::emission.optional_keys);
+      ConfigParseStatus status = DecodeObject(object, Schema(), emission, fields);
       if (status == ConfigParseStatus::Success)
       {
-        auto products = ParseReactantsOrProducts(validation::keys.products, object, status);
-
-        if (object[validation::keys.scaling_factor])
-        {
-          emission.scaling_factor = object[validation::keys.scaling_factor].as<double>();
-        }
-
-        if (object[validation::keys.name])
-        {
-          emission.name = object[validation::keys.name].as<std::string>();
-        }
+        auto products = ParseReactantsOrProducts(fields[Products], index, status);
 
-        std::vector<std::string> requested_species;
+        std::vector<types::SymbolId> requested_species;
         for (const auto& spec : products)
         {
-          requested_species.push_back(spec.species_name);
+          requested_species.push_back(spec.species_id);
         }
 
-        if (status == ConfigParseStatus::Success && RequiresUnknownSpecies(requested_species, existing_species))
+        if (status == ConfigParseStatus::Success && index.RequiresUnknownSpecies(requested_species))
         {
           status = ConfigParseStatus::ReactionRequiresUnknownSpecies;
         }
 
-        std::string gas_phase = object[validation::keys.gas_phase].as<std::string>();
-        auto it = std::find_if(existing_phases.begin(), existing_phases.end(), [&gas_phase](const auto& phase) { return phase.name == gas_phase; });
-        if (status == ConfigParseStatus::Success && it == existing_phases.end())
+        types::SymbolId gas_phase = index.FindPhase(fields[GasPhase].as<std::string>());
+        if (status == ConfigParseStatus::Success && gas_phase == types::unknown_symbol)
         {
           status = ConfigParseStatus::UnknownPhase;
         }
 
         emission.gas_phase = gas_phase;
         emission.products = products;
-        emission.unknown_properties = GetComments(object, validation::emission.required_keys, validation::emission.optional_keys);
         reactions.emission.push_back(emission);
       }
 
@@ -7,44 +7,56 @@ namespace open_atmos
 {
   namespace mechanism_configuration
   {
+    namespace
+    {
+      enum Field
+      {
+        Reactants,
+        Type,
+        GasPhase,
+        Name,
+        ScalingFactor,
+        NumberOfFields
+      };
+
+      const ObjectSchema<types::FirstOrderLoss, NumberOfFields>& Schema()
+      {
+        static const ObjectSchema<types::FirstOrderLoss, NumberOfFields> schema{ { {
+            { validation::keys.reactants, FieldPresence::Required },
+            { validation::keys.type, FieldPresence::Required },
+            { validation::keys.gas_phase, FieldPresence::Required },
+            { validation::keys.name, FieldPresence::Optional, DecodeMember<&types::FirstOrderLoss::name> },
+            { validation::keys.scaling_factor, FieldPresence::Optional, DecodeMember<&types::FirstOrderLoss::scaling_factor> } } } };
+        return schema;
+      }
+    }  // namespace
+
     ConfigParseStatus FirstOrderLossParser::parse(
         const YAML::Node& object,
-        const std::vector<types::Species>& existing_species,
-        const std::vector<types::Phase>& existing_phases,
+        const MechanismIndex& index,
         open_atmos::types::Reactions& reactions)
     {
-      ConfigParseStatus status = ConfigParseStatus::Success;
       types::FirstOrderLoss first_order_loss;
+      ObjectFields<NumberOfFields> fields;
 
-      status = ValidateSchema(object, validation::first_order_loss.required_keys, validation::first_order_loss.optional_keys);
+      ConfigParseStatus status = DecodeObject(object, Schema(), first_order_loss, fields);
       if (status == ConfigParseStatus::Success)
       {
-        auto reactants = ParseReactantsOrProducts(validation::keys.reactants, object, status);
-
-        if (object[validation::keys.scaling_factor])
-        {
-          first_order_loss.scaling_factor = object[validation::keys.scaling_factor].as<double>();
-        }
-
-        if (object[validation::keys.name])
-        {
-          first_order_loss.name = object[validation::keys.name].as<std::string>();
-        }
+        auto reactants = ParseReactantsOrProducts(fields[Reactants], index, status);
 
-        std::vector<std::string> requested_species;
+        std::vector<types::SymbolId> requested_species;
         for (const auto& spec : reactants)
         {
-          requested_species.push_back(spec.species_name);
+          requested_species.push_back(spec.species_id);
         }
 
-        if (status == ConfigParseStatus::Success && RequiresUnknownSpecies(requested_species, existing_species))
+        if (status == ConfigParseStatus::Success && index.RequiresUnknownSpecies(requested_species))
         {
           status = ConfigParseStatus::ReactionRequiresUnknownSpecies;
         }
 
-        std::string gas_phase = object[validation::keys.gas_phase].as<std::string>();
-        auto it = std::find_if(existing_phases.begin(), existing_phases.end(), [&gas_phase](const auto& phase) { return phase.name == gas_phase; });
-        if (status == ConfigParseStatus::Success && it == existing_phases.end())
+        types::SymbolId gas_phase = index.FindPhase(fields[GasPhase].as<std::string>());
+        if (status == ConfigParseStatus::Success && gas_phase == types::unknown_symbol)
         {
           status = ConfigParseStatus::UnknownPhase;
         }
@@ -56,8 +68,6 @@ namespace open_atmos
 
         first_order_loss.gas_phase = gas_phase;
         first_order_loss.reactants = reactants;
-        first_order_loss.unknown_properties =
-            GetComments(object, validation::first_order_loss.required_keys, validation::first_order_loss.optional_keys);
         reactions.first_order_loss.push_back(first_order_loss);
       }
 
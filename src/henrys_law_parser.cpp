@@ -7,56 +7,73 @@ namespace open_atmos
 {
   namespace mechanism_configuration
   {
+    namespace
+    {
+      enum Field
+      {
+        Type,
+        GasPhase,
+        GasPhaseSpecies,
+        AerosolPhase,
+        AerosolPhaseSpecies,
+        AerosolPhaseWater,
+        Name,
+        NumberOfFields
+      };
+
+      const ObjectSchema<types::HenrysLaw, NumberOfFields>& Schema()
+      {
+        static const ObjectSchema<types::HenrysLaw, NumberOfFields> schema{ { {
+            { validation::keys.type, FieldPresence::Required },
+            { validation::keys.gas_phase, FieldPresence::Required },
+            { validation::keys.gas_phase_species, FieldPresence::Required },
+            { validation::keys.aerosol_phase, FieldPresence::Required },
+            { validation::keys.aerosol_phase_species, FieldPresence::Required },
+            { validation::keys.aerosol_phase_water, FieldPresence::Required },
+            { validation::keys.name, FieldPresence::Optional, DecodeMember<&types::HenrysLaw::name> } } } };
+        return schema;
+      }
+    }  // namespace
+
     ConfigParseStatus HenrysLawParser::parse(
         const YAML::Node& object,
-        const std::vector<types::Species>& existing_species,
-        const std::vector<types::Phase>& existing_phases,
+        const MechanismIndex& index,
         open_atmos::types::Reactions& reactions)
     {
-      ConfigParseStatus status = ConfigParseStatus::Success;
       types::HenrysLaw henrys_law;
+      ObjectFields<NumberOfFields> fields;
 
-      status = ValidateSchema(object, validation::henrys_law.required_keys, validation::henrys_law.optional_keys);
+      ConfigParseStatus status = DecodeObject(object, Schema(), henrys_law, fields);
       if (status == ConfigParseStatus::Success)
       {
-        std::string gas_phase = object[validation::keys.gas_phase].as<std::string>();
-        std::string gas_phase_species = object[validation::keys.gas_phase_species].as<std::string>();
-        std::string aerosol_phase = object[validation::keys.aerosol_phase].as<std::string>();
-        std::string aerosol_phase_species = object[validation::keys.aerosol_phase_species].as<std::string>();
-        std::string aerosol_phase_water = object[validation::keys.aerosol_phase_water].as<std::string>();
+        types::SymbolId gas_phase = index.FindPhase(fields[GasPhase].as<std::string>());
+        types::SymbolId gas_phase_species = index.FindSpecies(fields[GasPhaseSpecies].as<std::string>());
+        types::SymbolId aerosol_phase = index.FindPhase(fields[AerosolPhase].as<std::string>());
+        types::SymbolId aerosol_phase_species = index.FindSpecies(fields[AerosolPhaseSpecies].as<std::string>());
+        types::SymbolId aerosol_phase_water = index.FindSpecies(fields[AerosolPhaseWater].as<std::string>());
 
-        if (object[validation::keys.name])
-        {
-          henrys_law.name = object[validation::keys.name].as<std::string>();
-        }
-
-        std::vector<std::string> requested_species;
+        std::vector<types::SymbolId> requested_species;
         requested_species.push_back(gas_phase_species);
         requested_species.push_back(aerosol_phase_species);
         requested_species.push_back(aerosol_phase_water);
 
-        std::vector<std::string> requested_aerosol_species;
+        std::vector<types::SymbolId> requested_aerosol_species;
         requested_aerosol_species.push_back(aerosol_phase_species);
         requested_aerosol_species.push_back(aerosol_phase_water);
 
-        if (status == ConfigParseStatus::Success && RequiresUnknownSpecies(requested_species, existing_species))
+        if (status == ConfigParseStatus::Success && index.RequiresUnknownSpecies(requested_species))
         {
           status = ConfigParseStatus::ReactionRequiresUnknownSpecies;
         }
 
-        auto it = std::find_if(existing_phases.begin(), existing_phases.end(), [&gas_phase](const auto& phase) { return phase.name == gas_phase; });
-        if (status == ConfigParseStatus::Success && it == existing_phases.end())
+        if (status == ConfigParseStatus::Success && gas_phase == types::unknown_symbol)
         {
           status = ConfigParseStatus::UnknownPhase;
         }
 
-        auto phase_it = std::find_if(
-            existing_phases.begin(), existing_phases.end(), [&aerosol_phase](const types::Phase& phase) { return phase.name == aerosol_phase; });
-
-        if (phase_it != existing_phases.end())
+        if (aerosol_phase != types::unknown_symbol)
         {
-          std::vector<std::string> aerosol_phase_species = { (*phase_it).species.begin(), (*phase_it).species.end() };
-          if (status == ConfigParseStatus::Success && RequiresUnknownSpecies(requested_aerosol_species, aerosol_phase_species))
+          if (status == ConfigParseStatus::Success && index.RequiresSpeciesOutsidePhase(requested_aerosol_species, aerosol_phase))
           {
             status = ConfigParseStatus::RequestedAerosolSpeciesNotIncludedInAerosolPhase;
           }
@@ -71,7 +88,6 @@ namespace open_atmos
         henrys_law.aerosol_phase = aerosol_phase;
         henrys_law.aerosol_phase_species = aerosol_phase_species;
         henrys_law.aerosol_phase_water = aerosol_phase_water;
-        henrys_law.unknown_properties = GetComments(object, validation::henrys_law.required_keys, validation::henrys_law.optional_keys);
         reactions.henrys_law.push_back(henrys_law);
       }
 
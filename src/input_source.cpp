@@ -0,0 +1,360 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <open_atmos/mechanism_configuration/input_source.hpp>
+#include <stdexcept>
+
+#ifdef OPEN_ATMOS_USE_ZLIB
+  #include <zlib.h>
+#endif
+#ifdef OPEN_ATMOS_USE_ZSTD
+  #include <zstd.h>
+#endif
+
+namespace open_atmos
+{
+  namespace mechanism_configuration
+  {
+    namespace
+    {
+      /// @brief The size of the decompressed blocks handed to the reader
+      constexpr std::size_t block_size = 1 << 16;
+
+      constexpr unsigned char gzip_magic[] = { 0x1f, 0x8b };
+      constexpr unsigned char zstd_magic[] = { 0x28, 0xb5, 0x2f, 0xfd };
+
+      template<std::size_t N>
+      bool StartsWith(std::string_view contents, const unsigned char (&magic)[N])
+      {
+        return contents.size() >= N && std::memcmp(contents.data(), magic, N) == 0;
+      }
+    }  // namespace
+
+    std::optional<InputFormat> FormatFromExtension(const std::filesystem::path& extension)
+    {
+      if (extension == ".json")
+      {
+        return InputFormat::Json;
+      }
+      if (extension == ".yaml" || extension == ".yml")
+      {
+        return InputFormat::Yaml;
+      }
+      return std::nullopt;
+    }
+
+    InputFormat DetectFormat(std::string_view contents, const std::filesystem::path& extension)
+    {
+      if (std::optional<InputFormat> format = FormatFromExtension(extension))
+      {
+        return *format;
+      }
+      for (char c : contents)
+      {
+        if (!IsLeadingFiller(c))
+        {
+          return c == '{' || c == '[' ? InputFormat::Json : InputFormat::Yaml;
+        }
+      }
+      return InputFormat::Yaml;
+    }
+
+    bool IsLeadingFiller(char c)
+    {
+      // the bytes of a UTF-8 byte order mark are 0xEF 0xBB 0xBF
+      unsigned char byte = static_cast<unsigned char>(c);
+      return c == ' ' || c == '\t' || c == '\n' || c == '\r' || byte == 0xef || byte == 0xbb || byte == 0xbf;
+    }
+
+    MemoryStreamBuffer::MemoryStreamBuffer(std::string_view contents)
+    {
+      // the get area is never written to, so the const_cast does not allow the text to be modified
+      char* begin = const_cast<char*>(contents.data());
+      setg(begin, begin, begin + contents.size());
+    }
+
+    MemoryStreamBuffer::pos_type MemoryStreamBuffer::seekoff(off_type offset, std::ios_base::seekdir direction, std::ios_base::openmode which)
+    {
+      if (!(which & std::ios_base::in))
+      {
+        return pos_type(off_type(-1));
+      }
+      off_type base = direction == std::ios_base::beg ? 0 : direction == std::ios_base::cur ? gptr() - eback() : egptr() - eback();
+      off_type position = base + offset;
+      if (position < 0 || position > egptr() - eback())
+      {
+        return pos_type(off_type(-1));
+      }
+      setg(eback(), eback() + position, egptr());
+      return pos_type(position);
+    }
+
+    MemoryStreamBuffer::pos_type MemoryStreamBuffer::seekpos(pos_type position, std::ios_base::openmode which)
+    {
+      return seekoff(off_type(position), std::ios_base::beg, which);
+    }
+
+    Compression DetectCompression(std::string_view contents)
+    {
+      if (StartsWith(contents, gzip_magic))
+      {
+        return Compression::Gzip;
+      }
+      if (StartsWith(contents, zstd_magic))
+      {
+        return Compression::Zstd;
+      }
+      return Compression::None;
+    }
+
+    bool IsCompressionSupported(Compression compression)
+    {
+      switch (compression)
+      {
+        case Compression::None: return true;
+#ifdef OPEN_ATMOS_USE_ZLIB
+        case Compression::Gzip: return true;
+#endif
+#ifdef OPEN_ATMOS_USE_ZSTD
+        case Compression::Zstd: return true;
+#endif
+        default: return false;
+      }
+    }
+
+    class DecompressingStreamBuffer::Decoder
+    {
+     public:
+      virtual ~Decoder() = default;
+
+      /// @brief Starts again from the beginning of the compressed data
+      virtual void Reset() = 0;
+
+      /// @brief Decompresses up to size bytes
+      /// @return The number of bytes written, which is 0 at the end of the data
+      /// @throws std::runtime_error if the data is damaged or ends in the middle of a frame
+      virtual std::size_t Read(char* output, std::size_t size) = 0;
+    };
+
+    namespace
+    {
+#ifdef OPEN_ATMOS_USE_ZLIB
+      /// @brief Reads gzip data, including files made of several concatenated gzip members
+      class GzipDecoder : public DecompressingStreamBuffer::Decoder
+      {
+       public:
+        explicit GzipDecoder(std::string_view compressed)
+            : compressed_(compressed)
+        {
+          // 32 added to the window size detects gzip and zlib headers
+          if (inflateInit2(&stream_, 15 + 32) != Z_OK)
+          {
+            throw std::runtime_error("zlib could not be initialized");
+          }
+          Reset();
+        }
+
+        ~GzipDecoder() override
+        {
+          inflateEnd(&stream_);
+        }
+
+        void Reset() override
+        {
+          inflateReset(&stream_);
+          consumed_ = 0;
+          member_complete_ = compressed_.empty();
+        }
+
+        std::size_t Read(char* output, std::size_t size) override
+        {
+          uInt requested = static_cast<uInt>(std::min<std::size_t>(size, UINT_MAX));
+          stream_.next_out = reinterpret_cast<Bytef*>(output);
+          stream_.avail_out = requested;
+          while (stream_.avail_out > 0 && !(consumed_ == compressed_.size() && member_complete_))
+          {
+            // zlib counts input in unsigned ints, so very large files are handed over in pieces
+            uInt available = static_cast<uInt>(std::min<std::size_t>(compressed_.size() - consumed_, UINT_MAX));
+            stream_.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(compressed_.data() + consumed_));
+            stream_.avail_in = available;
+            uInt space = stream_.avail_out;
+            int result = inflate(&stream_, Z_NO_FLUSH);
+            consumed_ += available - stream_.avail_in;
+            if (result == Z_STREAM_END)
+            {
+              // another member may follow
+              member_complete_ = true;
+              inflateReset(&stream_);
+              continue;
+            }
+            if (result != Z_OK && result != Z_BUF_ERROR)
+            {
+              throw std::runtime_error(stream_.msg ? stream_.msg : "the gzip data is damaged");
+            }
+            member_complete_ = false;
+            if (stream_.avail_in == available && stream_.avail_out == space)
+            {
+              // no progress, so the input ended in the middle of a member
+              break;
+            }
+          }
+          std::size_t produced = requested - stream_.avail_out;
+          if (produced == 0 && !member_complete_)
+          {
+            throw std::runtime_error("the gzip data ends in the middle of a member");
+          }
+          return produced;
+        }
+
+       private:
+        std::string_view compressed_;
+        z_stream stream_{};
+        std::size_t consumed_{ 0 };
+        bool member_complete_{ false };
+      };
+#endif
+
+#ifdef OPEN_ATMOS_USE_ZSTD
+      /// @brief Reads zstd data, including files made of several concatenated frames
+      class ZstdDecoder : public DecompressingStreamBuffer::Decoder
+      {
+       public:
+        explicit ZstdDecoder(std::string_view compressed)
+            : compressed_(compressed),
+              stream_(ZSTD_createDStream())
+        {
+          if (stream_ == nullptr)
+          {
+            throw std::runtime_error("zstd could not be initialized");
+          }
+          Reset();
+        }
+
+        ~ZstdDecoder() override
+        {
+          ZSTD_freeDStream(stream_);
+        }
+
+        void Reset() override
+        {
+          ZSTD_DCtx_reset(stream_, ZSTD_reset_session_only);
+          input_ = { compressed_.data(), compressed_.size(), 0 };
+          frame_complete_ = compressed_.empty();
+        }
+
+        std::size_t Read(char* output, std::size_t size) override
+        {
+          ZSTD_outBuffer out = { output, size, 0 };
+          while (out.pos < out.size && !(input_.pos == input_.size && frame_complete_))
+          {
+            std::size_t consumed = input_.pos;
+            std::size_t produced = out.pos;
+            std::size_t result = ZSTD_decompressStream(stream_, &out, &input_);
+            if (ZSTD_isError(result))
+            {
+              throw std::runtime_error(ZSTD_getErrorName(result));
+            }
+            // 0 means a frame has been completely decoded and flushed
+            frame_complete_ = result == 0;
+            if (input_.pos == consumed && out.pos == produced)
+            {
+              // no progress, so the input ended in the middle of a frame
+              break;
+            }
+          }
+          if (out.pos == 0 && !frame_complete_)
+          {
+            throw std::runtime_error("the zstd data ends in the middle of a frame");
+          }
+          return out.pos;
+        }
+
+       private:
+        std::string_view compressed_;
+        ZSTD_DStream* stream_;
+        ZSTD_inBuffer input_{};
+        bool frame_complete_{ true };
+      };
+#endif
+    }  // namespace
+
+    DecompressingStreamBuffer::DecompressingStreamBuffer(std::string_view compressed, Compression compression)
+        : block_(block_size)
+    {
+      switch (compression)
+      {
+#ifdef OPEN_ATMOS_USE_ZLIB
+        case Compression::Gzip: decoder_ = std::make_unique<GzipDecoder>(compressed); break;
+#endif
+#ifdef OPEN_ATMOS_USE_ZSTD
+        case Compression::Zstd: decoder_ = std::make_unique<ZstdDecoder>(compressed); break;
+#endif
+        default: throw std::invalid_argument("the compression is not supported by this build");
+      }
+      setg(block_.data(), block_.data(), block_.data());
+    }
+
+    DecompressingStreamBuffer::~DecompressingStreamBuffer() = default;
+
+    bool DecompressingStreamBuffer::Failed() const
+    {
+      return failed_;
+    }
+
+    DecompressingStreamBuffer::int_type DecompressingStreamBuffer::underflow()
+    {
+      if (gptr() < egptr())
+      {
+        return traits_type::to_int_type(*gptr());
+      }
+      if (failed_)
+      {
+        return traits_type::eof();
+      }
+      block_start_ += egptr() - eback();
+      std::size_t size = 0;
+      try
+      {
+        size = decoder_->Read(block_.data(), block_.size());
+      }
+      catch (const std::runtime_error&)
+      {
+        failed_ = true;
+      }
+      setg(block_.data(), block_.data(), block_.data() + size);
+      return size == 0 ? traits_type::eof() : traits_type::to_int_type(*gptr());
+    }
+
+    DecompressingStreamBuffer::pos_type
+    DecompressingStreamBuffer::seekoff(off_type offset, std::ios_base::seekdir direction, std::ios_base::openmode which)
+    {
+      if (!(which & std::ios_base::in))
+      {
+        return pos_type(off_type(-1));
+      }
+      off_type current = static_cast<off_type>(block_start_) + (gptr() - eback());
+      if (direction == std::ios_base::cur && offset == 0)
+      {
+        return pos_type(current);
+      }
+      if ((direction == std::ios_base::beg && offset == 0) || (direction == std::ios_base::cur && offset == -current))
+      {
+        decoder_->Reset();
+        block_start_ = 0;
+        failed_ = false;
+        setg(block_.data(), block_.data(), block_.data());
+        return pos_type(0);
+      }
+      return pos_type(off_type(-1));
+    }
+
+    DecompressingStreamBuffer::pos_type DecompressingStreamBuffer::seekpos(pos_type position, std::ios_base::openmode which)
+    {
+      return seekoff(off_type(position), std::ios_base::beg, which);
+    }
+  }  // namespace mechanism_configuration
+}  // namespace open_atmos
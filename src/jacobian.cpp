@@ -0,0 +1,147 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <open_atmos/mechanism_configuration/jacobian.hpp>
+
+namespace open_atmos
+{
+  namespace mechanism_configuration
+  {
+    namespace
+    {
+      void AppendSpecies(
+          const compiled::ComponentLists& lists,
+          std::size_t reaction,
+          std::size_t number_of_species,
+          std::vector<std::uint32_t>& species)
+      {
+        for (types::SymbolId id : lists.Species(reaction))
+        {
+          if (id < number_of_species)
+          {
+            species.push_back(id);
+          }
+        }
+      }
+    }  // namespace
+
+    void AppendRateDependencies(const CompiledMechanism& compiled, std::size_t reaction, std::vector<std::uint32_t>& species)
+    {
+      AppendSpecies(compiled.reactants, reaction, compiled.number_of_species, species);
+      switch (compiled.types[reaction])
+      {
+        case types::ReactionType::SimpolPhaseTransfer:
+        case types::ReactionType::HenrysLaw:
+        case types::ReactionType::AqueousEquilibrium:
+          // the reverse direction depends on the products
+          AppendSpecies(compiled.products, reaction, compiled.number_of_species, species);
+          break;
+        default: break;
+      }
+      types::SymbolId water = compiled.aerosol_phase_water[reaction];
+      if (water < compiled.number_of_species)
+      {
+        species.push_back(water);
+      }
+    }
+
+    SparsityPattern BuildJacobianPattern(const CompiledMechanism& compiled, const StoichiometryMatrix& stoichiometry)
+    {
+      const std::size_t number_of_species = compiled.number_of_species;
+      std::vector<std::vector<std::uint32_t>> rows(number_of_species);
+      for (std::size_t species = 0; species < number_of_species; ++species)
+      {
+        rows[species].push_back(static_cast<std::uint32_t>(species));
+      }
+
+      std::vector<std::uint32_t> dependencies;
+      for (std::size_t reaction = 0; reaction < compiled.number_of_reactions; ++reaction)
+      {
+        dependencies.clear();
+        AppendRateDependencies(compiled, reaction, dependencies);
+        if (dependencies.empty())
+        {
+          continue;
+        }
+        for (std::size_t column = stoichiometry.reaction_columns[reaction]; column < stoichiometry.reaction_columns[reaction + 1]; ++column)
+        {
+          for (std::uint32_t changed : stoichiometry.by_column.pattern.Columns(column))
+          {
+            rows[changed].insert(rows[changed].end(), dependencies.begin(), dependencies.end());
+          }
+        }
+      }
+
+      SparsityPattern pattern;
+      pattern.number_of_rows = number_of_species;
+      pattern.number_of_columns = number_of_species;
+      pattern.offsets.reserve(number_of_species + 1);
+      for (auto& row : rows)
+      {
+        std::sort(row.begin(), row.end());
+        row.erase(std::unique(row.begin(), row.end()), row.end());
+        pattern.indices.insert(pattern.indices.end(), row.begin(), row.end());
+        pattern.offsets.push_back(static_cast<std::uint32_t>(pattern.indices.size()));
+      }
+      return pattern;
+    }
+
+    JacobianPattern BuildJacobianPattern(const types::Mechanism& mechanism, const JacobianOptions& options)
+    {
+      CompiledMechanism compiled = Compile(mechanism);
+      SparsityPattern pattern = BuildJacobianPattern(compiled, BuildStoichiometry(compiled));
+      const std::size_t number_of_species = compiled.number_of_species;
+
+      JacobianPattern jacobian;
+      jacobian.block_offsets.push_back(0);
+      if (!options.block_by_phase)
+      {
+        jacobian.species_order.resize(number_of_species);
+        for (std::size_t species = 0; species < number_of_species; ++species)
+        {
+          jacobian.species_order[species] = static_cast<std::uint32_t>(species);
+        }
+        jacobian.block_offsets.push_back(static_cast<std::uint32_t>(number_of_species));
+        jacobian.block_phases.push_back(types::unknown_symbol);
+        jacobian.pattern = std::move(pattern);
+        return jacobian;
+      }
+
+      std::vector<bool> placed(number_of_species, false);
+      auto close_block = [&](types::SymbolId phase)
+      {
+        if (jacobian.species_order.size() > jacobian.block_offsets.back())
+        {
+          jacobian.block_offsets.push_back(static_cast<std::uint32_t>(jacobian.species_order.size()));
+          jacobian.block_phases.push_back(phase);
+        }
+      };
+      for (std::size_t phase = 0; phase < mechanism.phases.size(); ++phase)
+      {
+        for (const auto& name : mechanism.phases[phase].species)
+        {
+          types::SymbolId species = mechanism.species_symbols.Find(name);
+          if (species < number_of_species && !placed[species])
+          {
+            placed[species] = true;
+            jacobian.species_order.push_back(species);
+          }
+        }
+        close_block(mechanism.phase_symbols.Find(mechanism.phases[phase].name));
+      }
+      for (std::size_t species = 0; species < number_of_species; ++species)
+      {
+        if (!placed[species])
+        {
+          jacobian.species_order.push_back(static_cast<std::uint32_t>(species));
+        }
+      }
+      close_block(types::unknown_symbol);
+
+      jacobian.pattern = PermuteSymmetric(pattern, jacobian.species_order);
+      return jacobian;
+    }
+  }  // namespace mechanism_configuration
+}  // namespace open_atmos
@@ -0,0 +1,411 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <open_atmos/mechanism_configuration/json_reader.hpp>
+
+namespace open_atmos
+{
+  namespace mechanism_configuration
+  {
+    namespace
+    {
+      constexpr int end_of_input = std::char_traits<char>::eof();
+
+      void AppendUtf8(std::string& out, unsigned long code_point)
+      {
+        if (code_point < 0x80)
+        {
+          out += static_cast<char>(code_point);
+        }
+        else if (code_point < 0x800)
+        {
+          out += static_cast<char>(0xC0 | (code_point >> 6));
+          out += static_cast<char>(0x80 | (code_point & 0x3F));
+        }
+        else if (code_point < 0x10000)
+        {
+          out += static_cast<char>(0xE0 | (code_point >> 12));
+          out += static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+          out += static_cast<char>(0x80 | (code_point & 0x3F));
+        }
+        else
+        {
+          out += static_cast<char>(0xF0 | (code_point >> 18));
+          out += static_cast<char>(0x80 | ((code_point >> 12) & 0x3F));
+          out += static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+          out += static_cast<char>(0x80 | (code_point & 0x3F));
+        }
+      }
+
+      bool IsDigit(int c)
+      {
+        return c >= '0' && c <= '9';
+      }
+    }  // namespace
+
+    JsonReader::JsonReader(std::istream& input)
+        : buffer_(input.rdbuf())
+    {
+    }
+
+    void JsonReader::Read(IJsonHandler& handler)
+    {
+      SkipWhitespace();
+      ReadValue(handler);
+      SkipWhitespace();
+      if (Peek() != end_of_input)
+      {
+        Fail("unexpected content after the end of the document");
+      }
+    }
+
+    void JsonReader::ReadValue(IJsonHandler& handler)
+    {
+      switch (Peek())
+      {
+        case '{': ReadObject(handler); break;
+        case '[': ReadArray(handler); break;
+        case '"': handler.String(ReadString()); break;
+        case 't':
+          ReadLiteral("true");
+          handler.Boolean(true);
+          break;
+        case 'f':
+          ReadLiteral("false");
+          handler.Boolean(false);
+          break;
+        case 'n':
+          ReadLiteral("null");
+          handler.Null();
+          break;
+        case end_of_input: Fail("unexpected end of input");
+        default:
+          if (Peek() == '-' || IsDigit(Peek()))
+          {
+            handler.Number(ReadNumber());
+            break;
+          }
+          Fail(std::string("unexpected character '") + static_cast<char>(Peek()) + "'");
+      }
+    }
+
+    void JsonReader::ReadObject(IJsonHandler& handler)
+    {
+      Expect('{');
+      handler.StartObject();
+      SkipWhitespace();
+      if (Peek() == '}')
+      {
+        Get();
+        handler.EndObject();
+        return;
+      }
+      while (true)
+      {
+        SkipWhitespace();
+        if (Peek() != '"')
+        {
+          Fail("expected a string key");
+        }
+        handler.Key(ReadString());
+        SkipWhitespace();
+        Expect(':');
+        SkipWhitespace();
+        ReadValue(handler);
+        SkipWhitespace();
+        if (Peek() == ',')
+        {
+          Get();
+          continue;
+        }
+        Expect('}');
+        handler.EndObject();
+        return;
+      }
+    }
+
+    void JsonReader::ReadArray(IJsonHandler& handler)
+    {
+      Expect('[');
+      handler.StartArray();
+      SkipWhitespace();
+      if (Peek() == ']')
+      {
+        Get();
+        handler.EndArray();
+        return;
+      }
+      while (true)
+      {
+        SkipWhitespace();
+        ReadValue(handler);
+        SkipWhitespace();
+        if (Peek() == ',')
+        {
+          Get();
+          continue;
+        }
+        Expect(']');
+        handler.EndArray();
+        return;
+      }
+    }
+
+    std::string JsonReader::ReadString()
+    {
+      Expect('"');
+      std::string value;
+      while (true)
+      {
+        int c = Get();
+        if (c == end_of_input)
+        {
+          Fail("unterminated string");
+        }
+        if (c == '"')
+        {
+          return value;
+        }
+        if (c < 0x20 && c >= 0)
+        {
+          Fail("control character in string");
+        }
+        if (c != '\\')
+        {
+          value += static_cast<char>(c);
+          continue;
+        }
+        switch (Get())
+        {
+          case '"': value += '"'; break;
+          case '\\': value += '\\'; break;
+          case '/': value += '/'; break;
+          case 'b': value += '\b'; break;
+          case 'f': value += '\f'; break;
+          case 'n': value += '\n'; break;
+          case 'r': value += '\r'; break;
+          case 't': value += '\t'; break;
+          case 'u':
+          {
+            auto read_hex = [this]()
+            {
+              unsigned long code = 0;
+              for (int i = 0; i < 4; ++i)
+              {
+                int h = Get();
+                code <<= 4;
+                if (IsDigit(h))
+                  code |= h - '0';
+                else if (h >= 'a' && h <= 'f')
+                  code |= h - 'a' + 10;
+                else if (h >= 'A' && h <= 'F')
+                  code |= h - 'A' + 10;
+                else
+                  Fail("invalid unicode escape");
+              }
+              return code;
+            };
+            unsigned long code_point = read_hex();
+            if (code_point >= 0xD800 && code_point <= 0xDBFF)
+            {
+              if (Get() != '\\' || Get() != 'u')
+              {
+                Fail("unpaired surrogate in unicode escape");
+              }
+              unsigned long low = read_hex();
+              if (low < 0xDC00 || low > 0xDFFF)
+              {
+                Fail("unpaired surrogate in unicode escape");
+              }
+              code_point = 0x10000 + ((code_point - 0xD800) << 10) + (low - 0xDC00);
+            }
+            AppendUtf8(value, code_point);
+            break;
+          }
+          default: Fail("invalid escape sequence");
+        }
+      }
+    }
+
+    std::string JsonReader::ReadNumber()
+    {
+      std::string value;
+      auto read_digits = [this, &value]()
+      {
+        if (!IsDigit(Peek()))
+        {
+          Fail("expected a digit");
+        }
+        while (IsDigit(Peek()))
+        {
+          value += static_cast<char>(Get());
+        }
+      };
+
+      if (Peek() == '-')
+      {
+        value += static_cast<char>(Get());
+      }
+      if (Peek() == '0')
+      {
+        value += static_cast<char>(Get());
+      }
+      else
+      {
+        read_digits();
+      }
+      if (Peek() == '.')
+      {
+        value += static_cast<char>(Get());
+        read_digits();
+      }
+      if (Peek() == 'e' || Peek() == 'E')
+      {
+        value += static_cast<char>(Get());
+        if (Peek() == '+' || Peek() == '-')
+        {
+          value += static_cast<char>(Get());
+        }
+        read_digits();
+      }
+      return value;
+    }
+
+    void JsonReader::ReadLiteral(const char* literal)
+    {
+      for (const char* c = literal; *c != '\0'; ++c)
+      {
+        if (Get() != *c)
+        {
+          Fail(std::string("invalid literal, expected '") + literal + "'");
+        }
+      }
+    }
+
+    void JsonReader::SkipWhitespace()
+    {
+      while (Peek() == ' ' || Peek() == '\n' || Peek() == '\r' || Peek() == '\t')
+      {
+        Get();
+      }
+    }
+
+    void JsonReader::Expect(char expected)
+    {
+      if (Get() != expected)
+      {
+        Fail(std::string("expected '") + expected + "'");
+      }
+    }
+
+    int JsonReader::Peek()
+    {
+      return buffer_->sgetc();
+    }
+
+    int JsonReader::Get()
+    {
+      int c = buffer_->sbumpc();
+      if (c == end_of_input)
+      {
+        return c;
+      }
+      ++mark_.pos;
+      if (c == '\n')
+      {
+        ++mark_.line;
+        mark_.column = 0;
+      }
+      else
+      {
+        ++mark_.column;
+      }
+      return c;
+    }
+
+    void JsonReader::Fail(const std::string& message) const
+    {
+      throw YAML::ParserException(mark_, message);
+    }
+
+    void JsonNodeBuilder::StartObject()
+    {
+      stack_.push_back({ YAML::Node(YAML::NodeType::Map), "" });
+    }
+
+    void JsonNodeBuilder::EndObject()
+    {
+      YAML::Node node = stack_.back().node;
+      stack_.pop_back();
+      Add(node);
+    }
+
+    void JsonNodeBuilder::StartArray()
+    {
+      stack_.push_back({ YAML::Node(YAML::NodeType::Sequence), "" });
+    }
+
+    void JsonNodeBuilder::EndArray()
+    {
+      EndObject();
+    }
+
+    void JsonNodeBuilder::Key(const std::string& key)
+    {
+      stack_.back().key = key;
+    }
+
+    void JsonNodeBuilder::String(const std::string& value)
+    {
+      Add(YAML::Node(value));
+    }
+
+    void JsonNodeBuilder::Number(const std::string& value)
+    {
+      Add(YAML::Node(value));
+    }
+
+    void JsonNodeBuilder::Boolean(bool value)
+    {
+      Add(YAML::Node(value ? "true" : "false"));
+    }
+
+    void JsonNodeBuilder::Null()
+    {
+      Add(YAML::Node(YAML::NodeType::Null));
+    }
+
+    bool JsonNodeBuilder::Complete() const
+    {
+      return complete_;
+    }
+
+    YAML::Node JsonNodeBuilder::Take()
+    {
+      YAML::Node root = root_;
+      root_.reset();
+      complete_ = false;
+      return root;
+    }
+
+    void JsonNodeBuilder::Add(const YAML::Node& value)
+    {
+      if (stack_.empty())
+      {
+        root_ = value;
+        complete_ = true;
+        return;
+      }
+      Frame& parent = stack_.back();
+      if (parent.node.IsMap())
+      {
+        parent.node.force_insert(parent.key, value);
+      }
+      else
+      {
+        parent.node.push_back(value);
+      }
+    }
+  }  // namespace mechanism_configuration
+}  // namespace open_atmos
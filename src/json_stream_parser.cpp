@@ -0,0 +1,395 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <yaml-cpp/yaml.h>
+
+#include <array>
+#include <optional>
+#include <open_atmos/mechanism_configuration/json_reader.hpp>
+#include <open_atmos/mechanism_configuration/parser.hpp>
+#include <open_atmos/mechanism_configuration/parser_types.hpp>
+#include <open_atmos/mechanism_configuration/validation.hpp>
+
+namespace open_atmos
+{
+  namespace mechanism_configuration
+  {
+    namespace
+    {
+      enum Section
+      {
+        SpeciesSection,
+        PhasesSection,
+        ReactionsSection,
+        NumberOfSections,
+        NoSection = NumberOfSections
+      };
+
+      struct SectionState
+      {
+        ConfigParseStatus status = ConfigParseStatus::Success;
+        /// @brief The whole section value, when it is not an array and so cannot be streamed
+        std::optional<YAML::Node> value;
+        /// @brief Objects read before the sections they refer to
+        std::vector<YAML::Node> pending;
+        bool read = false;
+        bool done = false;
+        bool stopped = false;
+      };
+
+      /// @brief Routes the elements of the species, phases and reactions arrays to their parsers one object at a time.
+      ///        Everything else is small and is collected into a header node that is validated once the document ends.
+      class JsonMechanismHandler : public IJsonHandler
+      {
+       public:
+        explicit JsonMechanismHandler(std::size_t number_of_threads)
+            : header_(YAML::NodeType::Map),
+              index_(mechanism_.species),
+              number_of_threads_(number_of_threads)
+        {
+        }
+
+        void StartObject() override
+        {
+          if (depth_ == 0 && !building_)
+          {
+            depth_ = 1;
+            return;
+          }
+          building_ = true;
+          builder_.StartObject();
+        }
+
+        void EndObject() override
+        {
+          if (!building_)
+          {
+            depth_ = 0;
+            return;
+          }
+          builder_.EndObject();
+          TakeValue();
+        }
+
+        void StartArray() override
+        {
+          if (!building_ && depth_ == 1 && SectionForKey(key_) != NoSection)
+          {
+            section_ = SectionForKey(key_);
+            header_.force_insert(key_, YAML::Node(YAML::NodeType::Sequence));
+            depth_ = 2;
+            return;
+          }
+          building_ = true;
+          builder_.StartArray();
+        }
+
+        void EndArray() override
+        {
+          if (!building_)
+          {
+            sections_[section_].read = true;
+            section_ = NoSection;
+            depth_ = 1;
+            Flush();
+            return;
+          }
+          builder_.EndArray();
+          TakeValue();
+        }
+
+        void Key(const std::string& key) override
+        {
+          if (building_)
+          {
+            builder_.Key(key);
+            return;
+          }
+          key_ = key;
+        }
+
+        void String(const std::string& value) override
+        {
+          builder_.String(value);
+          TakeValue();
+        }
+
+        void Number(const std::string& value) override
+        {
+          builder_.Number(value);
+          TakeValue();
+        }
+
+        void Boolean(bool value) override
+        {
+          builder_.Boolean(value);
+          TakeValue();
+        }
+
+        void Null() override
+        {
+          builder_.Null();
+          TakeValue();
+        }
+
+        /// @brief The whole document, when its root is not an object and so cannot be streamed
+        const std::optional<YAML::Node>& Document() const
+        {
+          return document_;
+        }
+
+        const YAML::Node& Header() const
+        {
+          return header_;
+        }
+
+        const SectionState& State(Section section) const
+        {
+          return sections_[section];
+        }
+
+        types::Mechanism& Mechanism()
+        {
+          return mechanism_;
+        }
+
+       private:
+        static Section SectionForKey(const std::string& key)
+        {
+          if (key == validation::keys.species)
+            return SpeciesSection;
+          if (key == validation::keys.phases)
+            return PhasesSection;
+          if (key == validation::keys.reactions)
+            return ReactionsSection;
+          return NoSection;
+        }
+
+        void TakeValue()
+        {
+          if (!builder_.Complete())
+          {
+            return;
+          }
+          building_ = false;
+          YAML::Node value = builder_.Take();
+
+          if (depth_ == 0)
+          {
+            document_ = value;
+          }
+          else if (depth_ == 1)
+          {
+            header_.force_insert(key_, value);
+            Section section = SectionForKey(key_);
+            if (section != NoSection)
+            {
+              sections_[section].value = value;
+              sections_[section].read = true;
+              Flush();
+            }
+          }
+          else if (Ready(section_))
+          {
+            Parse(section_, value);
+          }
+          else
+          {
+            sections_[section_].pending.push_back(value);
+          }
+        }
+
+        /// @brief Phases can only be checked once all species are known, and reactions once all phases are known
+        bool Ready(Section section) const
+        {
+          for (int prerequisite = 0; prerequisite < section; ++prerequisite)
+          {
+            if (!sections_[prerequisite].done)
+            {
+              return false;
+            }
+          }
+          return true;
+        }
+
+        void Parse(Section section, const YAML::Node& object)
+        {
+          SectionState& state = sections_[section];
+          if (state.stopped)
+          {
+            return;
+          }
+          switch (section)
+          {
+            case SpeciesSection:
+            {
+              auto species_parse = ParseSpeciesObject(object);
+              state.status = species_parse.first;
+              if (state.status == ConfigParseStatus::Success)
+              {
+                mechanism_.species.push_back(species_parse.second);
+              }
+              break;
+            }
+            case PhasesSection:
+            {
+              auto phase_parse = ParsePhaseObject(object, index_);
+              state.status = phase_parse.first;
+              if (state.status == ConfigParseStatus::Success)
+              {
+                mechanism_.phases.push_back(phase_parse.second);
+              }
+              break;
+            }
+            default:
+              if (number_of_threads_ > 1)
+              {
+                // collected and parsed together once the array ends, so that they can be spread across threads
+                reactions_.push_back(object);
+                return;
+              }
+              state.status = ParseReaction(object, index_, mechanism_.reactions);
+              break;
+          }
+          state.stopped = state.status != ConfigParseStatus::Success;
+        }
+
+        void Finish(Section section)
+        {
+          SectionState& state = sections_[section];
+          switch (section)
+          {
+            case SpeciesSection:
+              if (state.value)
+              {
+                std::tie(state.status, mechanism_.species) = ParseSpecies(*state.value);
+              }
+              else
+              {
+                auto duplicates = FindDuplicateObjectsByName(mechanism_.species);
+                if (!duplicates.empty())
+                {
+                  ReportDuplicates("species", duplicates);
+                  state.status = ConfigParseStatus::DuplicateSpeciesDetected;
+                }
+              }
+              index_ = MechanismIndex(mechanism_.species);
+              mechanism_.species_symbols = index_.SpeciesSymbols();
+              break;
+            case PhasesSection:
+              if (state.value)
+              {
+                std::tie(state.status, mechanism_.phases) = ParsePhases(*state.value, index_);
+              }
+              else if (state.status == ConfigParseStatus::Success)
+              {
+                auto duplicates = FindDuplicateObjectsByName(mechanism_.phases);
+                if (!duplicates.empty())
+                {
+                  ReportDuplicates("phase", duplicates);
+                  state.status = ConfigParseStatus::DuplicatePhasesDetected;
+                }
+              }
+              index_.IndexPhases(mechanism_.phases);
+              mechanism_.phase_symbols = index_.PhaseSymbols();
+              break;
+            default:
+              if (state.value)
+              {
+                std::tie(state.status, mechanism_.reactions) = ParseReactions(*state.value, index_, number_of_threads_);
+              }
+              else if (!reactions_.empty())
+              {
+                std::tie(state.status, mechanism_.reactions) = ParseReactions(reactions_, index_, number_of_threads_);
+                reactions_.clear();
+              }
+              break;
+          }
+          state.done = true;
+        }
+
+        /// @brief Parses any objects that were waiting on a section that is now complete
+        void Flush()
+        {
+          for (int index = 0; index < NumberOfSections; ++index)
+          {
+            Section section = static_cast<Section>(index);
+            SectionState& state = sections_[section];
+            if (!Ready(section))
+            {
+              return;
+            }
+            for (const auto& object : state.pending)
+            {
+              Parse(section, object);
+            }
+            state.pending.clear();
+            if (state.read && !state.done)
+            {
+              Finish(section);
+            }
+          }
+        }
+
+        int depth_{ 0 };
+        bool building_{ false };
+        std::string key_;
+        Section section_{ NoSection };
+        JsonNodeBuilder builder_;
+        std::optional<YAML::Node> document_;
+        YAML::Node header_;
+        std::array<SectionState, NumberOfSections> sections_;
+        types::Mechanism mechanism_;
+        MechanismIndex index_;
+        std::size_t number_of_threads_;
+        /// @brief The reaction objects waiting to be parsed in parallel
+        std::vector<YAML::Node> reactions_;
+      };
+    }  // namespace
+
+    std::pair<ConfigParseStatus, types::Mechanism> Parser::ParseJson(std::istream& stream)
+    {
+      JsonMechanismHandler handler(number_of_threads_);
+      JsonReader reader(stream);
+      reader.Read(handler);
+
+      if (handler.Document())
+      {
+        return Parse(*handler.Document());
+      }
+
+      ConfigParseStatus status;
+      types::Mechanism mechanism;
+      const YAML::Node& header = handler.Header();
+
+      status = ValidateSchema(header, validation::mechanism.required_keys, validation::mechanism.optional_keys);
+
+      if (status != ConfigParseStatus::Success)
+      {
+        std::string msg = configParseStatusToString(status);
+        std::cerr << "[" << msg << "] Invalid top level configuration." << std::endl;
+        return { status, mechanism };
+      }
+
+      status = ValidateVersion(header);
+
+      mechanism = std::move(handler.Mechanism());
+      mechanism.name = header[validation::keys.name].as<std::string>();
+
+      const std::array<std::string, NumberOfSections> descriptions{ "species", "phases", "reactions" };
+      for (int section = 0; section < NumberOfSections; ++section)
+      {
+        const SectionState& state = handler.State(static_cast<Section>(section));
+        if (state.status != ConfigParseStatus::Success)
+        {
+          status = state.status;
+          std::string msg = configParseStatusToString(status);
+          std::cerr << "[" << msg << "] Failed to parse the " << descriptions[section] << "." << std::endl;
+        }
+      }
+
+      return { status, mechanism };
+    }
+  }  // namespace mechanism_configuration
+}  // namespace open_atmos
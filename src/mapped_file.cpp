@@ -0,0 +1,150 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <open_atmos/mechanism_configuration/mapped_file.hpp>
+
+#ifdef _WIN32
+  #ifndef NOMINMAX
+    #define NOMINMAX
+  #endif
+  #ifndef WIN32_LEAN_AND_MEAN
+    #define WIN32_LEAN_AND_MEAN
+  #endif
+  #include <windows.h>
+#else
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+namespace open_atmos
+{
+  namespace mechanism_configuration
+  {
+    MappedFile::MappedFile(MappedFile&& other) noexcept
+    {
+      *this = std::move(other);
+    }
+
+    MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+    {
+      if (this != &other)
+      {
+        Unmap();
+        address_ = std::exchange(other.address_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+#ifdef _WIN32
+        handle_ = std::exchange(other.handle_, nullptr);
+#endif
+      }
+      return *this;
+    }
+
+    MappedFile::~MappedFile()
+    {
+      Unmap();
+    }
+
+    void MappedFile::Unmap()
+    {
+      if (address_ != nullptr)
+      {
+#ifdef _WIN32
+        UnmapViewOfFile(address_);
+        CloseHandle(handle_);
+        handle_ = nullptr;
+#else
+        munmap(address_, size_);
+#endif
+      }
+      address_ = nullptr;
+      size_ = 0;
+    }
+
+    std::pair<ConfigParseStatus, MappedFile> MappedFile::Open(const std::filesystem::path& file_path)
+    {
+      MappedFile mapped;
+#ifdef _WIN32
+      HANDLE file = CreateFileW(file_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+      if (file == INVALID_HANDLE_VALUE)
+      {
+        return { ConfigParseStatus::InvalidFilePath, MappedFile() };
+      }
+      LARGE_INTEGER file_size;
+      if (GetFileType(file) != FILE_TYPE_DISK || !GetFileSizeEx(file, &file_size))
+      {
+        CloseHandle(file);
+        return { ConfigParseStatus::InvalidFilePath, MappedFile() };
+      }
+      if (file_size.QuadPart == 0)
+      {
+        // there is nothing to map, and mapping zero bytes is an error
+        CloseHandle(file);
+        return { ConfigParseStatus::Success, std::move(mapped) };
+      }
+      HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+      // the mapping keeps the file open on its own
+      CloseHandle(file);
+      if (mapping == nullptr)
+      {
+        return { ConfigParseStatus::InvalidFilePath, MappedFile() };
+      }
+      void* address = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+      if (address == nullptr)
+      {
+        CloseHandle(mapping);
+        return { ConfigParseStatus::InvalidFilePath, MappedFile() };
+      }
+      mapped.handle_ = mapping;
+      mapped.address_ = address;
+      mapped.size_ = static_cast<std::size_t>(file_size.QuadPart);
+#else
+      int file = open(file_path.c_str(), O_RDONLY);
+      if (file < 0)
+      {
+        return { ConfigParseStatus::InvalidFilePath, MappedFile() };
+      }
+      struct stat file_status;
+      if (fstat(file, &file_status) != 0 || !S_ISREG(file_status.st_mode))
+      {
+        close(file);
+        return { ConfigParseStatus::InvalidFilePath, MappedFile() };
+      }
+      if (file_status.st_size == 0)
+      {
+        // there is nothing to map, and mapping zero bytes is an error
+        close(file);
+        return { ConfigParseStatus::Success, std::move(mapped) };
+      }
+      std::size_t file_size = static_cast<std::size_t>(file_status.st_size);
+      void* address = mmap(nullptr, file_size, PROT_READ, MAP_SHARED, file, 0);
+      // the mapping keeps the file open on its own
+      close(file);
+      if (address == MAP_FAILED)
+      {
+        return { ConfigParseStatus::InvalidFilePath, MappedFile() };
+      }
+      mapped.address_ = address;
+      mapped.size_ = file_size;
+#endif
+      return { ConfigParseStatus::Success, std::move(mapped) };
+    }
+
+    const std::byte* MappedFile::Data() const
+    {
+      return static_cast<const std::byte*>(address_);
+    }
+
+    std::size_t MappedFile::Size() const
+    {
+      return size_;
+    }
+
+    std::string_view MappedFile::Contents() const
+    {
+      return { static_cast<const char*>(address_), size_ };
+    }
+  }  // namespace mechanism_configuration
+}  // namespace open_atmos
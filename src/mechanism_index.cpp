@@ -0,0 +1,111 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <open_atmos/mechanism_configuration/mechanism_index.hpp>
+
+namespace open_atmos
+{
+  namespace mechanism_configuration
+  {
+    namespace
+    {
+      const std::vector<types::Phase> no_phases;
+    }
+
+    MechanismIndex::MechanismIndex(const std::vector<types::Species>& species)
+        : species_(&species),
+          phases_(&no_phases)
+    {
+      for (const auto& spec : species)
+      {
+        species_symbols_.Intern(spec.name);
+      }
+    }
+
+    void MechanismIndex::IndexPhases(const std::vector<types::Phase>& phases)
+    {
+      phases_ = &phases;
+      phase_symbols_ = types::SymbolTable();
+      phase_species_.clear();
+      for (const auto& phase : phases)
+      {
+        types::SymbolId id = phase_symbols_.Intern(phase.name);
+        if (id < phase_species_.size())
+        {
+          // a duplicated phase name; the first definition is the one that is used
+          continue;
+        }
+        std::vector<bool> members(species_symbols_.Size(), false);
+        for (const auto& spec : phase.species)
+        {
+          types::SymbolId species_id = species_symbols_.Find(spec);
+          if (species_id != types::unknown_symbol)
+          {
+            members[species_id] = true;
+          }
+        }
+        phase_species_.push_back(std::move(members));
+      }
+    }
+
+    types::SymbolId MechanismIndex::FindSpecies(std::string_view name) const
+    {
+      return species_symbols_.Find(name);
+    }
+
+    types::SymbolId MechanismIndex::FindPhase(std::string_view name) const
+    {
+      return phase_symbols_.Find(name);
+    }
+
+    bool MechanismIndex::PhaseContains(types::SymbolId phase, types::SymbolId species) const
+    {
+      return phase < phase_species_.size() && species < phase_species_[phase].size() && phase_species_[phase][species];
+    }
+
+    bool MechanismIndex::RequiresUnknownSpecies(const std::vector<types::SymbolId>& requested_species) const
+    {
+      for (const auto& spec : requested_species)
+      {
+        if (spec == types::unknown_symbol)
+        {
+          return true;
+        }
+      }
+      return false;
+    }
+
+    bool MechanismIndex::RequiresSpeciesOutsidePhase(const std::vector<types::SymbolId>& requested_species, types::SymbolId phase) const
+    {
+      for (const auto& spec : requested_species)
+      {
+        if (!PhaseContains(phase, spec))
+        {
+          return true;
+        }
+      }
+      return false;
+    }
+
+    const std::vector<types::Species>& MechanismIndex::Species() const
+    {
+      return *species_;
+    }
+
+    const std::vector<types::Phase>& MechanismIndex::Phases() const
+    {
+      return *phases_;
+    }
+
+    const types::SymbolTable& MechanismIndex::SpeciesSymbols() const
+    {
+      return species_symbols_;
+    }
+
+    const types::SymbolTable& MechanismIndex::PhaseSymbols() const
+    {
+      return phase_symbols_;
+    }
+  }  // namespace mechanism_configuration
+}  // namespace open_atmos
@@ -0,0 +1,453 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <cstring>
+#include <initializer_list>
+#include <open_atmos/mechanism_configuration/mechanism_view.hpp>
+#include <string>
+
+namespace open_atmos
+{
+  namespace mechanism_configuration
+  {
+    namespace
+    {
+      constexpr std::uint32_t magic = 0x564d414f;  // "OAMV" in little-endian files
+      constexpr std::size_t section_alignment = 8;
+
+      /// @brief Collects the contents of each section while the mechanism is walked
+      class FlatBuilder
+      {
+       public:
+        flat::StringRef AddString(const std::string& value)
+        {
+          flat::StringRef string{ static_cast<std::uint32_t>(strings.size()), static_cast<std::uint32_t>(value.size()) };
+          strings.insert(strings.end(), value.begin(), value.end());
+          return string;
+        }
+
+        flat::Range AddComponents(const std::vector<types::ReactionComponent>& list)
+        {
+          flat::Range range{ static_cast<std::uint32_t>(components.size()), static_cast<std::uint32_t>(list.size()) };
+          for (const auto& component : list)
+          {
+            components.push_back({ component.species_id, 0, component.coefficient });
+          }
+          return range;
+        }
+
+        flat::Range AddComponent(types::SymbolId species_id, double coefficient)
+        {
+          components.push_back({ species_id, 0, coefficient });
+          return { static_cast<std::uint32_t>(components.size() - 1), 1 };
+        }
+
+        flat::Reaction& AddReaction(types::ReactionType type, const std::string& name, std::initializer_list<double> parameters)
+        {
+          flat::Reaction& reaction = reactions.emplace_back();
+          reaction.type = type;
+          reaction.gas_phase = types::unknown_symbol;
+          reaction.aerosol_phase = types::unknown_symbol;
+          reaction.aerosol_phase_water = types::unknown_symbol;
+          reaction.name = AddString(name);
+          reaction.number_of_parameters = static_cast<std::uint32_t>(parameters.size());
+          std::size_t i = 0;
+          for (double parameter : parameters)
+          {
+            reaction.parameters[i++] = parameter;
+          }
+          return reaction;
+        }
+
+        std::vector<char> strings;
+        std::vector<flat::Species> species;
+        std::vector<flat::Property> properties;
+        std::vector<flat::Phase> phases;
+        std::vector<types::SymbolId> phase_species;
+        std::vector<flat::Component> components;
+        std::vector<flat::Reaction> reactions;
+      };
+
+      // Each Add lays out one kind of reaction, following the conventions documented on flat::Reaction
+
+      void Add(FlatBuilder& builder, const types::Arrhenius& reaction)
+      {
+        auto& record =
+            builder.AddReaction(types::ReactionType::Arrhenius, reaction.name, { reaction.A, reaction.B, reaction.C, reaction.D, reaction.E });
+        record.gas_phase = reaction.gas_phase;
+        record.reactants = builder.AddComponents(reaction.reactants);
+        record.products = builder.AddComponents(reaction.products);
+      }
+
+      void Add(FlatBuilder& builder, const types::Branched& reaction)
+      {
+        auto& record = builder.AddReaction(
+            types::ReactionType::Branched, reaction.name, { reaction.X, reaction.Y, reaction.a0, static_cast<double>(reaction.n) });
+        record.gas_phase = reaction.gas_phase;
+        record.reactants = builder.AddComponents(reaction.reactants);
+        record.products = builder.AddComponents(reaction.nitrate_products);
+        record.alternative_products = builder.AddComponents(reaction.alkoxy_products);
+      }
+
+      void Add(FlatBuilder& builder, const types::CondensedPhaseArrhenius& reaction)
+      {
+        auto& record = builder.AddReaction(
+            types::ReactionType::CondensedPhaseArrhenius, reaction.name, { reaction.A, reaction.B, reaction.C, reaction.D, reaction.E });
+        record.aerosol_phase = reaction.aerosol_phase;
+        record.aerosol_phase_water = reaction.aerosol_phase_water;
+        record.reactants = builder.AddComponents(reaction.reactants);
+        record.products = builder.AddComponents(reaction.products);
+      }
+
+      void Add(FlatBuilder& builder, const types::CondensedPhasePhotolysis& reaction)
+      {
+        auto& record = builder.AddReaction(types::ReactionType::CondensedPhasePhotolysis, reaction.name, { reaction.scaling_factor_ });
+        record.aerosol_phase = reaction.aerosol_phase;
+        record.aerosol_phase_water = reaction.aerosol_phase_water;
+        record.reactants = builder.AddComponents(reaction.reactants);
+        record.products = builder.AddComponents(reaction.products);
+      }
+
+      void Add(FlatBuilder& builder, const types::Emission& reaction)
+      {
+        auto& record = builder.AddReaction(types::ReactionType::Emission, reaction.name, { reaction.scaling_factor });
+        record.gas_phase = reaction.gas_phase;
+        record.products = builder.AddComponents(reaction.products);
+      }
+
+      void Add(FlatBuilder& builder, const types::FirstOrderLoss& reaction)
+      {
+        auto& record = builder.AddReaction(types::ReactionType::FirstOrderLoss, reaction.name, { reaction.scaling_factor });
+        record.gas_phase = reaction.gas_phase;
+        record.reactants = builder.AddComponents(reaction.reactants);
+      }
+
+      void Add(FlatBuilder& builder, const types::SimpolPhaseTransfer& reaction)
+      {
+        auto& record = builder.AddReaction(
+            types::ReactionType::SimpolPhaseTransfer, reaction.name, { reaction.B[0], reaction.B[1], reaction.B[2], reaction.B[3] });
+        record.gas_phase = reaction.gas_phase;
+        record.aerosol_phase = reaction.aerosol_phase;
+        record.reactants = builder.AddComponent(reaction.gas_phase_species.species_id, reaction.gas_phase_species.coefficient);
+        record.products = builder.AddComponent(reaction.aerosol_phase_species.species_id, reaction.aerosol_phase_species.coefficient);
+      }
+
+      void Add(FlatBuilder& builder, const types::AqueousEquilibrium& reaction)
+      {
+        auto& record = builder.AddReaction(types::ReactionType::AqueousEquilibrium, reaction.name, { reaction.A, reaction.C, reaction.k_reverse });
+        record.gas_phase = reaction.gas_phase;
+        record.aerosol_phase = reaction.aerosol_phase;
+        record.aerosol_phase_water = reaction.aerosol_phase_water;
+        record.reactants = builder.AddComponents(reaction.reactants);
+        record.products = builder.AddComponents(reaction.products);
+      }
+
+      void Add(FlatBuilder& builder, const types::WetDeposition& reaction)
+      {
+        auto& record = builder.AddReaction(types::ReactionType::WetDeposition, reaction.name, { reaction.scaling_factor });
+        record.aerosol_phase = reaction.aerosol_phase;
+      }
+
+      void Add(FlatBuilder& builder, const types::HenrysLaw& reaction)
+      {
+        auto& record = builder.AddReaction(types::ReactionType::HenrysLaw, reaction.name, {});
+        record.gas_phase = reaction.gas_phase;
+        record.aerosol_phase = reaction.aerosol_phase;
+        record.aerosol_phase_water = reaction.aerosol_phase_water;
+        record.reactants = builder.AddComponent(reaction.gas_phase_species, 1.0);
+        record.products = builder.AddComponent(reaction.aerosol_phase_species, 1.0);
+      }
+
+      void Add(FlatBuilder& builder, const types::Photolysis& reaction)
+      {
+        auto& record = builder.AddReaction(types::ReactionType::Photolysis, reaction.name, { reaction.scaling_factor });
+        record.gas_phase = reaction.gas_phase;
+        record.reactants = builder.AddComponents(reaction.reactants);
+        record.products = builder.AddComponents(reaction.products);
+      }
+
+      void Add(FlatBuilder& builder, const types::Surface& reaction)
+      {
+        auto& record = builder.AddReaction(types::ReactionType::Surface, reaction.name, { reaction.reaction_probability });
+        record.gas_phase = reaction.gas_phase;
+        record.aerosol_phase = reaction.aerosol_phase;
+        record.reactants = builder.AddComponent(reaction.gas_phase_species.species_id, reaction.gas_phase_species.coefficient);
+        record.products = builder.AddComponents(reaction.gas_phase_products);
+      }
+
+      void Add(FlatBuilder& builder, const types::Troe& reaction)
+      {
+        auto& record = builder.AddReaction(
+            types::ReactionType::Troe,
+            reaction.name,
+            { reaction.k0_A, reaction.k0_B, reaction.k0_C, reaction.kinf_A, reaction.kinf_B, reaction.kinf_C, reaction.Fc, reaction.N });
+        record.gas_phase = reaction.gas_phase;
+        record.reactants = builder.AddComponents(reaction.reactants);
+        record.products = builder.AddComponents(reaction.products);
+      }
+
+      void Add(FlatBuilder& builder, const types::Tunneling& reaction)
+      {
+        auto& record = builder.AddReaction(types::ReactionType::Tunneling, reaction.name, { reaction.A, reaction.B, reaction.C });
+        record.gas_phase = reaction.gas_phase;
+        record.reactants = builder.AddComponents(reaction.reactants);
+        record.products = builder.AddComponents(reaction.products);
+      }
+
+      template<typename T>
+      void AddAll(FlatBuilder& builder, const std::vector<T>& reactions)
+      {
+        for (const auto& reaction : reactions)
+        {
+          Add(builder, reaction);
+        }
+      }
+
+      std::size_t Align(std::size_t offset)
+      {
+        return (offset + section_alignment - 1) / section_alignment * section_alignment;
+      }
+
+      /// @brief Appends the contents of a section, aligned, and returns where it was placed
+      template<typename T>
+      std::pair<std::uint64_t, std::uint64_t> AppendSection(std::vector<std::byte>& bytes, const std::vector<T>& records)
+      {
+        std::size_t offset = Align(bytes.size());
+        bytes.resize(offset + records.size() * sizeof(T));
+        if (!records.empty())
+        {
+          std::memcpy(bytes.data() + offset, records.data(), records.size() * sizeof(T));
+        }
+        return { offset, records.size() };
+      }
+    }  // namespace
+
+    std::vector<std::byte> Flatten(const types::Mechanism& mechanism)
+    {
+      FlatBuilder builder;
+
+      for (const auto& species : mechanism.species)
+      {
+        flat::Species& record = builder.species.emplace_back();
+        record.name = builder.AddString(species.name);
+        record.properties = { static_cast<std::uint32_t>(builder.properties.size()),
+                              static_cast<std::uint32_t>(species.optional_numerical_properties.size()) };
+        for (const auto& [key, value] : species.optional_numerical_properties)
+        {
+          builder.properties.push_back({ builder.AddString(key), value });
+        }
+      }
+
+      for (const auto& phase : mechanism.phases)
+      {
+        flat::Phase& record = builder.phases.emplace_back();
+        record.name = builder.AddString(phase.name);
+        record.species = { static_cast<std::uint32_t>(builder.phase_species.size()), static_cast<std::uint32_t>(phase.species.size()) };
+        for (const auto& name : phase.species)
+        {
+          builder.phase_species.push_back(mechanism.species_symbols.Find(name));
+        }
+      }
+
+      const types::Reactions& reactions = mechanism.reactions;
+      AddAll(builder, reactions.arrhenius);
+      AddAll(builder, reactions.branched);
+      AddAll(builder, reactions.condensed_phase_arrhenius);
+      AddAll(builder, reactions.condensed_phase_photolysis);
+      AddAll(builder, reactions.emission);
+      AddAll(builder, reactions.first_order_loss);
+      AddAll(builder, reactions.simpol_phase_transfer);
+      AddAll(builder, reactions.aqueous_equilibrium);
+      AddAll(builder, reactions.wet_deposition);
+      AddAll(builder, reactions.henrys_law);
+      AddAll(builder, reactions.photolysis);
+      AddAll(builder, reactions.surface);
+      AddAll(builder, reactions.troe);
+      AddAll(builder, reactions.tunneling);
+
+      MechanismView::Header header{};
+      header.magic = magic;
+      header.version = flat_format_version;
+      header.name = builder.AddString(mechanism.name);
+
+      std::vector<std::byte> bytes(sizeof(header));
+      auto place = [&](MechanismView::SectionId id, auto&& section)
+      {
+        auto [offset, size] = AppendSection(bytes, section);
+        header.sections[id] = { offset, size };
+      };
+      place(MechanismView::StringSection, builder.strings);
+      place(MechanismView::SpeciesSection, builder.species);
+      place(MechanismView::PropertySection, builder.properties);
+      place(MechanismView::PhaseSection, builder.phases);
+      place(MechanismView::PhaseSpeciesSection, builder.phase_species);
+      place(MechanismView::ComponentSection, builder.components);
+      place(MechanismView::ReactionSection, builder.reactions);
+
+      header.file_size = bytes.size();
+      std::memcpy(bytes.data(), &header, sizeof(header));
+      return bytes;
+    }
+
+    MechanismView::MechanismView(MechanismView&& other) noexcept
+    {
+      *this = std::move(other);
+    }
+
+    MechanismView& MechanismView::operator=(MechanismView&& other) noexcept
+    {
+      if (this != &other)
+      {
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+        header_ = std::exchange(other.header_, nullptr);
+        mapping_ = std::move(other.mapping_);
+      }
+      return *this;
+    }
+
+    std::pair<ConfigParseStatus, MechanismView> MechanismView::Open(const std::filesystem::path& file_path)
+    {
+      auto [mapped, mapping] = MappedFile::Open(file_path);
+      if (mapped != ConfigParseStatus::Success)
+      {
+        return { mapped, MechanismView() };
+      }
+      MechanismView view;
+      view.mapping_ = std::move(mapping);
+      ConfigParseStatus status = view.Attach(view.mapping_.Data(), view.mapping_.Size());
+      if (status != ConfigParseStatus::Success)
+      {
+        return { status, MechanismView() };
+      }
+      return { status, std::move(view) };
+    }
+
+    std::pair<ConfigParseStatus, MechanismView> MechanismView::FromBuffer(const std::byte* data, std::size_t size)
+    {
+      MechanismView view;
+      ConfigParseStatus status = view.Attach(data, size);
+      if (status != ConfigParseStatus::Success)
+      {
+        return { status, MechanismView() };
+      }
+      return { status, std::move(view) };
+    }
+
+    ConfigParseStatus MechanismView::Attach(const std::byte* data, std::size_t size)
+    {
+      if (data == nullptr || size < sizeof(Header) || reinterpret_cast<std::uintptr_t>(data) % section_alignment != 0)
+      {
+        return ConfigParseStatus::InvalidBinaryFormat;
+      }
+      const Header* header = reinterpret_cast<const Header*>(data);
+      if (header->magic != magic)
+      {
+        return ConfigParseStatus::InvalidBinaryFormat;
+      }
+      if (header->version != flat_format_version)
+      {
+        return ConfigParseStatus::UnsupportedBinaryVersion;
+      }
+      if (header->file_size != size)
+      {
+        return ConfigParseStatus::InvalidBinaryFormat;
+      }
+
+      static constexpr std::size_t record_sizes[NumberOfSections] = {
+        sizeof(char),           sizeof(flat::Species),   sizeof(flat::Property), sizeof(flat::Phase),
+        sizeof(types::SymbolId), sizeof(flat::Component), sizeof(flat::Reaction)
+      };
+      for (std::size_t i = 0; i < NumberOfSections; ++i)
+      {
+        const Section& section = header->sections[i];
+        if (section.offset % section_alignment != 0 || section.offset > size || section.size > (size - section.offset) / record_sizes[i])
+        {
+          return ConfigParseStatus::InvalidBinaryFormat;
+        }
+      }
+
+      data_ = data;
+      size_ = size;
+      header_ = header;
+      return ConfigParseStatus::Success;
+    }
+
+    template<typename T>
+    Span<T> MechanismView::Records(SectionId section, flat::Range range) const
+    {
+      if (header_ == nullptr)
+      {
+        return {};
+      }
+      const Section& records = header_->sections[section];
+      if (range.offset > records.size || range.size > records.size - range.offset)
+      {
+        return {};
+      }
+      return { reinterpret_cast<const T*>(data_ + records.offset) + range.offset, range.size };
+    }
+
+    template<typename T>
+    Span<T> MechanismView::Records(SectionId section) const
+    {
+      if (header_ == nullptr)
+      {
+        return {};
+      }
+      return { reinterpret_cast<const T*>(data_ + header_->sections[section].offset), static_cast<std::size_t>(header_->sections[section].size) };
+    }
+
+    std::string_view MechanismView::Name() const
+    {
+      if (header_ == nullptr)
+      {
+        return {};
+      }
+      return String(header_->name);
+    }
+
+    Span<flat::Species> MechanismView::Species() const
+    {
+      return Records<flat::Species>(SpeciesSection);
+    }
+
+    Span<flat::Phase> MechanismView::Phases() const
+    {
+      return Records<flat::Phase>(PhaseSection);
+    }
+
+    Span<flat::Reaction> MechanismView::Reactions() const
+    {
+      return Records<flat::Reaction>(ReactionSection);
+    }
+
+    std::string_view MechanismView::String(flat::StringRef string) const
+    {
+      Span<char> characters = Records<char>(StringSection, string);
+      return { characters.data(), characters.size() };
+    }
+
+    Span<flat::Property> MechanismView::Properties(const flat::Species& species) const
+    {
+      return Records<flat::Property>(PropertySection, species.properties);
+    }
+
+    Span<types::SymbolId> MechanismView::PhaseSpecies(const flat::Phase& phase) const
+    {
+      return Records<types::SymbolId>(PhaseSpeciesSection, phase.species);
+    }
+
+    Span<flat::Component> MechanismView::Components(flat::Range components) const
+    {
+      return Records<flat::Component>(ComponentSection, components);
+    }
+
+    Span<double> MechanismView::Parameters(const flat::Reaction& reaction) const
+    {
+      return { reaction.parameters, std::min<std::size_t>(reaction.number_of_parameters, flat::max_parameters) };
+    }
+  }  // namespace mechanism_configuration
+}  // namespace open_atmos
@@ -0,0 +1,78 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <charconv>
+#include <iostream>
+#include <limits>
+#include <open_atmos/mechanism_configuration/numbers.hpp>
+
+#ifndef __cpp_lib_to_chars
+  #include <locale>
+  #include <sstream>
+  #include <string>
+#endif
+
+namespace open_atmos
+{
+  namespace mechanism_configuration
+  {
+    bool ParseNumber(std::string_view text, double& value)
+    {
+      if (text == ".nan" || text == ".NaN" || text == ".NAN")
+      {
+        value = std::numeric_limits<double>::quiet_NaN();
+        return true;
+      }
+
+      bool negative = false;
+      std::string_view magnitude = text;
+      if (!magnitude.empty() && (magnitude.front() == '+' || magnitude.front() == '-'))
+      {
+        negative = magnitude.front() == '-';
+        magnitude.remove_prefix(1);
+      }
+      if (magnitude == ".inf" || magnitude == ".Inf" || magnitude == ".INF")
+      {
+        value = negative ? -std::numeric_limits<double>::infinity() : std::numeric_limits<double>::infinity();
+        return true;
+      }
+      // rules out a second sign and the C spellings of infinity and not-a-number, which YAML does not use
+      if (magnitude.empty() || !((magnitude.front() >= '0' && magnitude.front() <= '9') || magnitude.front() == '.'))
+      {
+        return false;
+      }
+
+      double parsed;
+#ifdef __cpp_lib_to_chars
+      const char* end = magnitude.data() + magnitude.size();
+      auto [stop, error] = std::from_chars(magnitude.data(), end, parsed);
+      if (error != std::errc() || stop != end)
+      {
+        return false;
+      }
+#else
+      // without a floating point from_chars, a stream fixed to the classic locale gives the same result
+      std::istringstream stream{ std::string(magnitude) };
+      stream.imbue(std::locale::classic());
+      if (!(stream >> std::noskipws >> parsed) || stream.peek() != std::char_traits<char>::eof())
+      {
+        return false;
+      }
+#endif
+      value = negative ? -parsed : parsed;
+      return true;
+    }
+
+    ConfigParseStatus DecodeNumber(const YAML::Node& node, double& value)
+    {
+      if (node.IsScalar() && ParseNumber(node.Scalar(), value))
+      {
+        return ConfigParseStatus::Success;
+      }
+      ConfigParseStatus status = ConfigParseStatus::InvalidNumericValue;
+      std::cerr << "[" << configParseStatusToString(status) << "] '" << node << "' is not a number" << std::endl;
+      return status;
+    }
+  }  // namespace mechanism_configuration
+}  // namespace open_atmos
@@ -0,0 +1,30 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <iostream>
+#include <open_atmos/mechanism_configuration/object_schema.hpp>
+
+namespace open_atmos
+{
+  namespace mechanism_configuration
+  {
+    std::string FormatUnknownProperty(const YAML::Node& value)
+    {
+      YAML::Emitter emitter;
+      emitter << YAML::DoubleQuoted << YAML::Flow  // json style output
+              << value;
+      return emitter.c_str();
+    }
+
+    void ReportMissingKey(std::string_view key, const YAML::Node& object)
+    {
+      std::cerr << "Missing required key '" << key << "' in object: " << object << std::endl;
+    }
+
+    void ReportInvalidKey(std::string_view key, const YAML::Node& object)
+    {
+      std::cerr << "Non-standard key '" << key << "' found in object" << object << std::endl;
+    }
+  }  // namespace mechanism_configuration
+}  // namespace open_atmos
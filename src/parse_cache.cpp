@@ -0,0 +1,186 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <open_atmos/mechanism_configuration/parse_cache.hpp>
+#include <open_atmos/mechanism_configuration/serialization.hpp>
+#include <random>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace open_atmos
+{
+  namespace mechanism_configuration
+  {
+    namespace
+    {
+      constexpr const char* entry_extension = ".oamc";
+      constexpr const char* temporary_extension = ".tmp";
+
+      /// @brief How long a temporary file may go without being renamed into place before it is treated as abandoned
+      constexpr std::chrono::minutes stale_temporary_age{ 10 };
+
+      /// @brief A name for a temporary file that no other thread or process will pick
+      std::string UniqueSuffix()
+      {
+        static std::atomic<std::uint64_t> counter{ 0 };
+        static const std::uint64_t process_token = (static_cast<std::uint64_t>(std::random_device{}()) << 32) ^ std::random_device{}();
+        char suffix[40];
+        std::snprintf(
+            suffix, sizeof(suffix), ".%016llx.%llu.tmp", static_cast<unsigned long long>(process_token), static_cast<unsigned long long>(counter++));
+        return suffix;
+      }
+    }  // namespace
+
+    ParseCache::ParseCache(std::filesystem::path directory, std::uintmax_t max_size)
+        : directory_(std::move(directory)),
+          max_size_(max_size)
+    {
+    }
+
+    std::string ParseCache::Key(std::string_view contents, std::string_view salt)
+    {
+      std::uint64_t hash = Fnv1a(reinterpret_cast<const std::byte*>(salt.data()), salt.size());
+      hash = Fnv1a(reinterpret_cast<const std::byte*>(contents.data()), contents.size(), hash);
+      // the length makes two texts with colliding hashes share an entry only if they are also the same size
+      char key[40];
+      std::snprintf(key, sizeof(key), "%016llx-%llx", static_cast<unsigned long long>(hash), static_cast<unsigned long long>(contents.size()));
+      return key;
+    }
+
+    const std::filesystem::path& ParseCache::Directory() const
+    {
+      return directory_;
+    }
+
+    std::filesystem::path ParseCache::EntryPath(const std::string& key) const
+    {
+      return directory_ / (key + entry_extension);
+    }
+
+    std::optional<types::Mechanism> ParseCache::Load(const std::string& key) const
+    {
+      std::filesystem::path path = EntryPath(key);
+      std::ifstream file(path, std::ios::binary);
+      if (!file)
+      {
+        return std::nullopt;
+      }
+      std::vector<char> contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+      file.close();
+
+      auto [status, mechanism] = Deserialize(reinterpret_cast<const std::byte*>(contents.data()), contents.size());
+      std::error_code error;
+      if (status != ConfigParseStatus::Success)
+      {
+        // an entry from another format version or a damaged one is replaced by the next Store
+        std::filesystem::remove(path, error);
+        return std::nullopt;
+      }
+      // eviction removes the entries that were used longest ago
+      std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now(), error);
+      return std::move(mechanism);
+    }
+
+    void ParseCache::Store(const std::string& key, const types::Mechanism& mechanism) const
+    {
+      std::error_code error;
+      std::filesystem::create_directories(directory_, error);
+      if (error)
+      {
+        return;
+      }
+
+      std::vector<std::byte> bytes = Serialize(mechanism);
+      std::filesystem::path path = EntryPath(key);
+      std::filesystem::path temporary = directory_ / (key + UniqueSuffix());
+      {
+        std::ofstream file(temporary, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+        if (!file)
+        {
+          file.close();
+          std::filesystem::remove(temporary, error);
+          return;
+        }
+      }
+      std::filesystem::rename(temporary, path, error);
+      if (error)
+      {
+        std::filesystem::remove(temporary, error);
+        return;
+      }
+
+      Evict();
+    }
+
+    void ParseCache::Evict() const
+    {
+      std::error_code error;
+      std::vector<std::pair<std::filesystem::file_time_type, std::filesystem::directory_entry>> entries;
+      std::uintmax_t total_size = 0;
+      const auto stale_before = std::filesystem::file_time_type::clock::now() - stale_temporary_age;
+      std::filesystem::directory_iterator entry(directory_, error);
+      for (; !error && entry != std::filesystem::directory_iterator(); entry.increment(error))
+      {
+        const bool temporary = entry->path().extension() == temporary_extension;
+        if (!temporary && entry->path().extension() != entry_extension)
+        {
+          continue;
+        }
+        std::error_code entry_error;
+        std::uintmax_t size = entry->file_size(entry_error);
+        std::filesystem::file_time_type time = entry->last_write_time(entry_error);
+        if (entry_error)
+        {
+          continue;
+        }
+        // a temporary file that was not renamed long after it was written was left by a Store that did not finish
+        if (temporary && time < stale_before)
+        {
+          std::filesystem::remove(entry->path(), entry_error);
+          if (!entry_error)
+          {
+            continue;
+          }
+        }
+        total_size += size;
+        if (!temporary)
+        {
+          entries.emplace_back(time, *entry);
+        }
+      }
+      if (total_size <= max_size_)
+      {
+        return;
+      }
+
+      std::sort(entries.begin(), entries.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+      for (const auto& [time, entry] : entries)
+      {
+        if (total_size <= max_size_)
+        {
+          break;
+        }
+        std::uintmax_t size = entry.file_size(error);
+        if (error)
+        {
+          continue;
+        }
+        // another process may have evicted the entry already, which frees its space just the same
+        std::filesystem::remove(entry.path(), error);
+        if (!error)
+        {
+          total_size -= size;
+        }
+      }
+    }
+  }  // namespace mechanism_configuration
+}  // namespace open_atmos
@@ -24,6 +24,14 @@ namespace open_atmos
         case ConfigParseStatus::RequestedAerosolSpeciesNotIncludedInAerosolPhase: return "RequestedAerosolSpeciesNotIncludedInAerosolPhase";
         case ConfigParseStatus::TooManyReactionComponents: return "TooManyReactionComponents";
         case ConfigParseStatus::InvalidIonPair: return "InvalidIonPair";
+        case ConfigParseStatus::InvalidBinaryFormat: return "InvalidBinaryFormat";
+        case ConfigParseStatus::UnsupportedBinaryVersion: return "UnsupportedBinaryVersion";
+        case ConfigParseStatus::BinaryChecksumMismatch: return "BinaryChecksumMismatch";
+        case ConfigParseStatus::InvalidNumericValue: return "InvalidNumericValue";
+        case ConfigParseStatus::CompressionNotSupported: return "CompressionNotSupported";
+        case ConfigParseStatus::DecompressionFailed: return "DecompressionFailed";
+        case ConfigParseStatus::MissingSpeciesProperty: return "MissingSpeciesProperty";
+        case ConfigParseStatus::InvalidSpeciesOrder: return "InvalidSpeciesOrder";
         default: return "Unknown";
       }
     }
@@ -4,60 +4,187 @@
 
 #include <yaml-cpp/yaml.h>
 
+#include <algorithm>
+#include <exception>
+#include <functional>
+#include <iterator>
 #include <open_atmos/constants.hpp>
+#include <open_atmos/mechanism_configuration/mapped_file.hpp>
 #include <open_atmos/mechanism_configuration/parser.hpp>
+#include <open_atmos/mechanism_configuration/object_schema.hpp>
 #include <open_atmos/mechanism_configuration/parser_types.hpp>
+#include <open_atmos/mechanism_configuration/reaction_parser_registry.hpp>
 #include <open_atmos/mechanism_configuration/validation.hpp>
 #include <open_atmos/mechanism_configuration/version.hpp>
+#include <sstream>
+#include <system_error>
+#include <thread>
 
 namespace open_atmos
 {
   namespace mechanism_configuration
   {
 
-    std::pair<ConfigParseStatus, types::Reactions>
-    ParseReactions(const YAML::Node& objects, const std::vector<types::Species>& existing_species, const std::vector<types::Phase>& existing_phases)
+    ConfigParseStatus ParseReaction(const YAML::Node& object, const MechanismIndex& index, types::Reactions& reactions)
     {
-      ConfigParseStatus status = ConfigParseStatus::Success;
-      types::Reactions reactions;
-
-      std::map<std::string, std::unique_ptr<IReactionParser>> parsers;
-      parsers[validation::keys.Arrhenius_key] = std::make_unique<ArrheniusParser>();
-      parsers[validation::keys.HenrysLaw_key] = std::make_unique<HenrysLawParser>();
-      parsers[validation::keys.WetDeposition_key] = std::make_unique<WetDepositionParser>();
-      parsers[validation::keys.AqueousPhaseEquilibrium_key] = std::make_unique<AqueousEquilibriumParser>();
-      parsers[validation::keys.SimpolPhaseTransfer_key] = std::make_unique<SimpolPhaseTransferParser>();
-      parsers[validation::keys.FirstOrderLoss_key] = std::make_unique<FirstOrderLossParser>();
-      parsers[validation::keys.Emission_key] = std::make_unique<EmissionParser>();
-      parsers[validation::keys.CondensedPhasePhotolysis_key] = std::make_unique<CondensedPhasePhotolysisParser>();
-      parsers[validation::keys.Photolysis_key] = std::make_unique<PhotolysisParser>();
-      parsers[validation::keys.Surface_key] = std::make_unique<SurfaceParser>();
-      parsers[validation::keys.Tunneling_key] = std::make_unique<TunnelingParser>();
-      parsers[validation::keys.Branched_key] = std::make_unique<BranchedParser>();
-      parsers[validation::keys.Troe_key] = std::make_unique<TroeParser>();
-      parsers[validation::keys.CondensedPhaseArrhenius_key] = std::make_unique<CondensedPhaseArrheniusParser>();
+      const YAML::Node& type_node = object[validation::keys.type];
+      if (!type_node)
+      {
+        ReportMissingKey(validation::keys.type, object);
+        return ConfigParseStatus::RequiredKeyNotFound;
+      }
+      const std::string& type = type_node.Scalar();
+      IReactionParser* parser = ReactionParserRegistry::Instance().Find(type);
+      if (parser == nullptr)
+      {
+        ConfigParseStatus status = ConfigParseStatus::ObjectTypeNotFound;
+        std::cerr << "[" << configParseStatusToString(status) << "] Unknown reaction type '" << type << "' in object: " << object << std::endl;
+        return status;
+      }
+      return parser->parse(object, index, reactions);
+    }
 
-      for (const auto& object : objects)
+    namespace
+    {
+      /// @brief Threads are only worth starting when each has at least this many reactions to parse
+      constexpr std::size_t min_reactions_per_thread = 64;
+
+      /// @brief The outcome of parsing one contiguous part of the reactions
+      struct ReactionsChunk
       {
-        std::string type = object[validation::keys.type].as<std::string>();
-        auto it = parsers.find(type);
-        if (it != parsers.end())
+        ConfigParseStatus status = ConfigParseStatus::Success;
+        types::Reactions reactions;
+        std::exception_ptr exception;
+      };
+
+      template<typename T>
+      void Append(std::vector<T>& to, std::vector<T>& from)
+      {
+        to.insert(to.end(), std::make_move_iterator(from.begin()), std::make_move_iterator(from.end()));
+      }
+
+      void Append(types::Reactions& to, types::Reactions& from)
+      {
+        Append(to.arrhenius, from.arrhenius);
+        Append(to.branched, from.branched);
+        Append(to.condensed_phase_arrhenius, from.condensed_phase_arrhenius);
+        Append(to.condensed_phase_photolysis, from.condensed_phase_photolysis);
+        Append(to.emission, from.emission);
+        Append(to.first_order_loss, from.first_order_loss);
+        Append(to.simpol_phase_transfer, from.simpol_phase_transfer);
+        Append(to.aqueous_equilibrium, from.aqueous_equilibrium);
+        Append(to.wet_deposition, from.wet_deposition);
+        Append(to.henrys_law, from.henrys_law);
+        Append(to.photolysis, from.photolysis);
+        Append(to.surface, from.surface);
+        Append(to.troe, from.troe);
+        Append(to.tunneling, from.tunneling);
+      }
+
+      void ParseChunk(const YAML::Node* begin, const YAML::Node* end, const MechanismIndex& index, ReactionsChunk& chunk)
+      {
+        try
         {
-          auto parse_status = it->second->parse(object, existing_species, existing_phases, reactions);
-          status = parse_status;
+          for (const YAML::Node* object = begin; object != end; ++object)
+          {
+            chunk.status = ParseReaction(*object, index, chunk.reactions);
+            if (chunk.status != ConfigParseStatus::Success)
+            {
+              break;
+            }
+          }
+        }
+        catch (...)
+        {
+          chunk.exception = std::current_exception();
+        }
+      }
+    }  // namespace
+
+    std::pair<ConfigParseStatus, types::Reactions>
+    ParseReactions(const YAML::Node& objects, const MechanismIndex& index, std::size_t number_of_threads)
+    {
+      if (number_of_threads <= 1)
+      {
+        ConfigParseStatus status = ConfigParseStatus::Success;
+        types::Reactions reactions;
+
+        for (const auto& object : objects)
+        {
+          status = ParseReaction(object, index, reactions);
           if (status != ConfigParseStatus::Success)
           {
             break;
           }
         }
-        else
+
+        return { status, reactions };
+      }
+
+      std::vector<YAML::Node> elements;
+      elements.reserve(objects.size());
+      for (const auto& object : objects)
+      {
+        elements.push_back(object);
+      }
+      return ParseReactions(elements, index, number_of_threads);
+    }
+
+    std::pair<ConfigParseStatus, types::Reactions>
+    ParseReactions(const std::vector<YAML::Node>& objects, const MechanismIndex& index, std::size_t number_of_threads)
+    {
+      number_of_threads = std::max<std::size_t>(1, std::min(number_of_threads, objects.size() / min_reactions_per_thread));
+
+      // each thread takes a contiguous part of the objects, so joining the parts in order gives the document order
+      std::vector<ReactionsChunk> chunks(number_of_threads);
+      std::vector<std::thread> workers;
+      workers.reserve(number_of_threads - 1);
+      const YAML::Node* data = objects.data();
+      auto bound = [&](std::size_t chunk) { return data + objects.size() * chunk / number_of_threads; };
+      std::size_t started = 1;
+      for (; started < number_of_threads; ++started)
+      {
+        try
+        {
+          workers.emplace_back(ParseChunk, bound(started), bound(started + 1), std::cref(index), std::ref(chunks[started]));
+        }
+        catch (const std::system_error&)
         {
-          const std::string& msg = "Unknown type: " + type;
-          throw std::runtime_error(msg);
+          // out of threads: the chunks that did not get one are parsed here instead
+          break;
         }
       }
+      ParseChunk(bound(0), bound(1), index, chunks[0]);
+      for (std::size_t chunk = started; chunk < number_of_threads; ++chunk)
+      {
+        ParseChunk(bound(chunk), bound(chunk + 1), index, chunks[chunk]);
+      }
+      for (auto& worker : workers)
+      {
+        worker.join();
+      }
 
-      return { status, reactions };
+      // stop where the serial parse would have stopped: at the first failure or exception in document order
+      ConfigParseStatus status = ConfigParseStatus::Success;
+      types::Reactions reactions = std::move(chunks[0].reactions);
+      for (std::size_t chunk = 0; chunk < number_of_threads; ++chunk)
+      {
+        if (chunk > 0)
+        {
+          Append(reactions, chunks[chunk].reactions);
+        }
+        if (chunks[chunk].exception)
+        {
+          std::rethrow_exception(chunks[chunk].exception);
+        }
+        status = chunks[chunk].status;
+        if (status != ConfigParseStatus::Success)
+        {
+          break;
+        }
+      }
+
+      return { status, std::move(reactions) };
     }
 
     /// @brief Parse a mechanism
@@ -83,9 +210,183 @@ namespace open_atmos
         return { status, types::Mechanism() };
       }
 
-      YAML::Node config = YAML::LoadFile(file_path.string());
+      auto [mapped, mapping] = MappedFile::Open(file_path);
+      if (mapped != ConfigParseStatus::Success)
+      {
+        // pipes and other files that cannot be mapped are read as streams
+        std::ifstream stream(file_path, std::ios::binary);
+        return Parse(stream);
+      }
+      return ParseContents(mapping.Contents(), file_path);
+    }
 
-      return Parser::Parse(config);
+    std::pair<ConfigParseStatus, types::Mechanism> Parser::Parse(std::istream& stream)
+    {
+      return ParseStream(stream, std::nullopt);
+    }
+
+    std::pair<ConfigParseStatus, types::Mechanism> Parser::ParseBuffer(std::string_view contents)
+    {
+      return ParseContents(contents, {});
+    }
+
+    std::pair<ConfigParseStatus, types::Mechanism> Parser::ParseContents(std::string_view contents, const std::filesystem::path& file_path)
+    {
+      Compression compression = DetectCompression(contents);
+      if (!IsCompressionSupported(compression))
+      {
+        ConfigParseStatus status = ConfigParseStatus::CompressionNotSupported;
+        std::cerr << "[" << configParseStatusToString(status) << "] " << (compression == Compression::Gzip ? "gzip" : "zstd")
+                  << " input needs a build of the library with " << (compression == Compression::Gzip ? "zlib" : "libzstd") << std::endl;
+        return { status, types::Mechanism() };
+      }
+      // the format of mechanism.json.gz is that of mechanism.json
+      std::filesystem::path name = compression == Compression::None ? file_path : file_path.stem();
+      std::optional<InputFormat> format = FormatFromExtension(name.extension());
+
+      if (!cache_)
+      {
+        return ParseText(contents, compression, format);
+      }
+      // the same text may be read differently by another version of the parser or as another format; compressed
+      // files are keyed by their compressed bytes, so they are never decompressed when the mechanism is cached
+      std::string salt = getVersionString();
+      salt += !format ? " detected" : *format == InputFormat::Json ? " json" : " yaml";
+      std::string key = ParseCache::Key(contents, salt);
+      if (std::optional<types::Mechanism> cached = cache_->Load(key))
+      {
+        return { ConfigParseStatus::Success, std::move(*cached) };
+      }
+      auto parsed = ParseText(contents, compression, format);
+      if (parsed.first == ConfigParseStatus::Success)
+      {
+        cache_->Store(key, parsed.second);
+      }
+      return parsed;
+    }
+
+    std::pair<ConfigParseStatus, types::Mechanism>
+    Parser::ParseText(std::string_view contents, Compression compression, std::optional<InputFormat> format)
+    {
+      if (compression != Compression::None)
+      {
+        DecompressingStreamBuffer buffer(contents, compression);
+        std::istream stream(&buffer);
+        std::pair<ConfigParseStatus, types::Mechanism> parsed;
+        try
+        {
+          parsed = ParseStream(stream, format);
+        }
+        catch (const YAML::Exception&)
+        {
+          // text cut short by damaged data is reported as a decompression failure rather than a syntax error
+          if (!buffer.Failed())
+          {
+            throw;
+          }
+        }
+        if (buffer.Failed())
+        {
+          ConfigParseStatus status = ConfigParseStatus::DecompressionFailed;
+          std::cerr << "[" << configParseStatusToString(status) << "] The compressed data is damaged or incomplete" << std::endl;
+          return { status, types::Mechanism() };
+        }
+        return parsed;
+      }
+
+      if (format.value_or(DetectFormat(contents)) == InputFormat::Json)
+      {
+        MemoryStreamBuffer buffer(contents);
+        std::istream stream(&buffer);
+        try
+        {
+          return ParseJson(stream);
+        }
+        catch (const YAML::ParserException&)
+        {
+          // Not strict JSON; YAML is a superset of JSON, so let the YAML reader decide whether the file is valid
+        }
+      }
+
+      MemoryStreamBuffer buffer(contents);
+      std::istream stream(&buffer);
+      return Parser::Parse(YAML::Load(stream));
+    }
+
+    std::pair<ConfigParseStatus, types::Mechanism> Parser::ParseStream(std::istream& stream, std::optional<InputFormat> format)
+    {
+      // only the leading whitespace is read to find the format, and it is handed back to the YAML reader if the stream
+      // cannot be rewound
+      std::streampos start = stream.tellg();
+      std::string leading;
+      if (!format)
+      {
+        while (stream.peek() != std::char_traits<char>::eof() && IsLeadingFiller(static_cast<char>(stream.peek())))
+        {
+          leading.push_back(static_cast<char>(stream.get()));
+        }
+        char first = stream.peek() == std::char_traits<char>::eof() ? '\0' : static_cast<char>(stream.peek());
+        format = DetectFormat(std::string_view(&first, 1));
+      }
+      if (*format == InputFormat::Json)
+      {
+        try
+        {
+          return ParseJson(stream);
+        }
+        catch (const YAML::ParserException&)
+        {
+          // Not strict JSON; give the YAML reader the whole stream if it can be read again
+          if (start == std::streampos(-1))
+          {
+            throw;
+          }
+        }
+        stream.clear();
+        stream.seekg(start);
+        return Parser::Parse(YAML::Load(stream));
+      }
+      if (leading.empty() || (start != std::streampos(-1) && stream.seekg(start)))
+      {
+        return Parser::Parse(YAML::Load(stream));
+      }
+      stream.clear();
+      return Parser::Parse(YAML::Load(leading + std::string(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>())));
+    }
+
+    void Parser::EnableCache(const std::filesystem::path& directory, std::uintmax_t max_size)
+    {
+      cache_.emplace(directory, max_size);
+    }
+
+    void Parser::DisableCache()
+    {
+      cache_.reset();
+    }
+
+    void Parser::SetNumberOfThreads(std::size_t number_of_threads)
+    {
+      if (number_of_threads == 0)
+      {
+        number_of_threads = std::max(1u, std::thread::hardware_concurrency());
+      }
+      number_of_threads_ = number_of_threads;
+    }
+
+    ConfigParseStatus Parser::ValidateVersion(const YAML::Node& object)
+    {
+      std::string version = object[validation::keys.version].as<std::string>();
+
+      if (version != getVersionString())
+      {
+        ConfigParseStatus status = ConfigParseStatus::InvalidVersion;
+        std::string msg = configParseStatusToString(status);
+        std::cerr << "[" << msg << "] This parser supports version " << getVersionString() << " and you requested version " << version
+                  << ". Please download the appropriate version of the parser or switch to the supported format's version." << std::endl;
+        return status;
+      }
+
+      return ConfigParseStatus::Success;
     }
 
     /// @brief Parse a mechanism
@@ -105,15 +406,7 @@ namespace open_atmos
         return { status, mechanism };
       }
 
-      std::string version = object[validation::keys.version].as<std::string>();
-
-      if (version != getVersionString())
-      {
-        status = ConfigParseStatus::InvalidVersion;
-        std::string msg = configParseStatusToString(status);
-        std::cerr << "[" << msg << "] This parser supports version " << getVersionString() << " and you requested version " << version
-                  << ". Please download the appropriate version of the parser or switch to the supported format's version." << std::endl;
-      }
+      status = ValidateVersion(object);
 
       std::string name = object[validation::keys.name].as<std::string>();
       mechanism.name = name;
@@ -127,7 +420,8 @@ namespace open_atmos
         std::cerr << "[" << msg << "] Failed to parse the species." << std::endl;
       }
 
-      auto phases_parsing = ParsePhases(object[validation::keys.phases], species_parsing.second);
+      MechanismIndex index(species_parsing.second);
+      auto phases_parsing = ParsePhases(object[validation::keys.phases], index);
 
       if (phases_parsing.first != ConfigParseStatus::Success)
       {
@@ -136,7 +430,8 @@ namespace open_atmos
         std::cerr << "[" << msg << "] Failed to parse the phases." << std::endl;
       }
 
-      auto reactions_parsing = ParseReactions(object[validation::keys.reactions], species_parsing.second, phases_parsing.second);
+      index.IndexPhases(phases_parsing.second);
+      auto reactions_parsing = ParseReactions(object[validation::keys.reactions], index, number_of_threads_);
 
       if (reactions_parsing.first != ConfigParseStatus::Success)
       {
@@ -145,9 +440,11 @@ namespace open_atmos
         std::cerr << "[" << msg << "] Failed to parse the reactions." << std::endl;
       }
 
-      mechanism.species = species_parsing.second;
-      mechanism.phases = phases_parsing.second;
-      mechanism.reactions = reactions_parsing.second;
+      mechanism.species = std::move(species_parsing.second);
+      mechanism.phases = std::move(phases_parsing.second);
+      mechanism.reactions = std::move(reactions_parsing.second);
+      mechanism.species_symbols = index.SpeciesSymbols();
+      mechanism.phase_symbols = index.PhaseSymbols();
 
       return { status, mechanism };
     }
@@ -7,49 +7,63 @@ namespace open_atmos
 {
   namespace mechanism_configuration
   {
+    namespace
+    {
+      enum Field
+      {
+        Reactants,
+        Products,
+        Type,
+        GasPhase,
+        Name,
+        ScalingFactor,
+        NumberOfFields
+      };
+
+      const ObjectSchema<types::Photolysis, NumberOfFields>& Schema()
+      {
+        static const ObjectSchema<types::Photolysis, NumberOfFields> schema{ { {
+            { validation::keys.reactants, FieldPresence::Required },
+            { validation::keys.products, FieldPresence::Required },
+            { validation::keys.type, FieldPresence::Required },
+            { validation::keys.gas_phase, FieldPresence::Required },
+            { validation::keys.name, FieldPresence::Optional, DecodeMember<&types::Photolysis::name> },
+            { validation::keys.scaling_factor, FieldPresence::Optional, DecodeMember<&types::Photolysis::scaling_factor> } } } };
+        return schema;
+      }
+    }  // namespace
+
     ConfigParseStatus PhotolysisParser::parse(
         const YAML::Node& object,
-        const std::vector<types::Species>& existing_species,
-        const std::vector<types::Phase>& existing_phases,
+        const MechanismIndex& index,
         open_atmos::types::Reactions& reactions)
     {
-      ConfigParseStatus status = ConfigParseStatus::Success;
       types::Photolysis photolysis;
+      ObjectFields<NumberOfFields> fields;
 
-      status = ValidateSchema(object, validation::photolysis.required_keys, validation::photolysis.optional_keys);
+      ConfigParseStatus status = DecodeObject(object, Schema(), photolysis, fields);
       if (status == ConfigParseStatus::Success)
       {
-        auto products = ParseReactantsOrProducts(validation::keys.products, object, status);
-        auto reactants = ParseReactantsOrProducts(validation::keys.reactants, object, status);
-
-        if (object[validation::keys.scaling_factor])
-        {
-          photolysis.scaling_factor = object[validation::keys.scaling_factor].as<double>();
-        }
-
-        if (object[validation::keys.name])
-        {
-          photolysis.name = object[validation::keys.name].as<std::string>();
-        }
+        auto products = ParseReactantsOrProducts(fields[Products], index, status);
+        auto reactants = ParseReactantsOrProducts(fields[Reactants], index, status);
 
-        std::vector<std::string> requested_species;
+        std::vector<types::SymbolId> requested_species;
         for (const auto& spec : products)
         {
-          requested_species.push_back(spec.species_name);
+          requested_species.push_back(spec.species_id);
         }
         for (const auto& spec : reactants)
         {
-          requested_species.push_back(spec.species_name);
+          requested_species.push_back(spec.species_id);
         }
 
-        if (status == ConfigParseStatus::Success && RequiresUnknownSpecies(requested_species, existing_species))
+        if (status == ConfigParseStatus::Success && index.RequiresUnknownSpecies(requested_species))
         {
           status = ConfigParseStatus::ReactionRequiresUnknownSpecies;
         }
 
-        std::string gas_phase = object[validation::keys.gas_phase].as<std::string>();
-        auto it = std::find_if(existing_phases.begin(), existing_phases.end(), [&gas_phase](const auto& phase) { return phase.name == gas_phase; });
-        if (status == ConfigParseStatus::Success && it == existing_phases.end())
+        types::SymbolId gas_phase = index.FindPhase(fields[GasPhase].as<std::string>());
+        if (status == ConfigParseStatus::Success && gas_phase == types::unknown_symbol)
         {
           status = ConfigParseStatus::UnknownPhase;
         }
@@ -62,7 +76,6 @@ namespace open_atmos
         photolysis.gas_phase = gas_phase;
         photolysis.products = products;
         photolysis.reactants = reactants;
-        photolysis.unknown_properties = GetComments(object, validation::photolysis.required_keys, validation::photolysis.optional_keys);
         reactions.photolysis.push_back(photolysis);
       }
 
@@ -0,0 +1,623 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <open_atmos/constants.hpp>
+#include <open_atmos/mechanism_configuration/conversions.hpp>
+#include <open_atmos/mechanism_configuration/rate_constants.hpp>
+#include <open_atmos/mechanism_configuration/validation.hpp>
+
+namespace open_atmos
+{
+  namespace mechanism_configuration
+  {
+    namespace rate_constants
+    {
+      namespace
+      {
+        constexpr double pi = 3.14159265358979323846;
+
+        /// @brief ln(0.43·(T/298)^-8), the high-pressure limit of the Branched structure term
+        double LogBranchedHighPressureLimit(double log_temperature)
+        {
+          return std::log(0.43) - 8.0 * (log_temperature - std::log(298.0));
+        }
+
+        /// @brief The Branched structure term A(T, [M], n) from ln(2e-22·e^n·[M]) and ln(0.43·(T/298)^-8)
+        double BranchedStructureTerm(double log_k0_M, double log_kinf)
+        {
+          const double log_ratio = log_k0_M - log_kinf;
+          const double log10_ratio = log_ratio / std::log(10.0);
+          return std::exp(log_k0_M) / (1.0 + std::exp(log_ratio)) * std::exp(std::log(0.41) / (1.0 + log10_ratio * log10_ratio));
+        }
+
+        /// @brief Looks up a numerical property of a species, reporting it if the species does not have it
+        ConfigParseStatus FindProperty(const types::Mechanism& mechanism, types::SymbolId species, const std::string& property, double& value)
+        {
+          if (species < mechanism.species.size())
+          {
+            const auto& properties = mechanism.species[species].optional_numerical_properties;
+            auto found = properties.find(property);
+            if (found != properties.end())
+            {
+              value = found->second;
+              return ConfigParseStatus::Success;
+            }
+          }
+          ConfigParseStatus status = ConfigParseStatus::MissingSpeciesProperty;
+          std::string name = species < mechanism.species.size() ? mechanism.species[species].name : std::to_string(species);
+          std::cerr << "[" << configParseStatusToString(status) << "] Species '" << name << "' does not have '" << property << "'"
+                    << std::endl;
+          return status;
+        }
+
+        /// @brief Finds 1 / D and 8·R / (π·MW) for a gas species, from which uptake by particles is calculated
+        ConfigParseStatus FindTransportProperties(
+            const types::Mechanism& mechanism,
+            types::SymbolId species,
+            double& inverse_diffusion_coefficient,
+            double& speed_factor)
+        {
+          double diffusion_coefficient = 0;
+          double molecular_weight = 0;
+          ConfigParseStatus status = FindProperty(mechanism, species, validation::keys.diffusion_coefficient, diffusion_coefficient);
+          if (status == ConfigParseStatus::Success)
+          {
+            status = FindProperty(mechanism, species, validation::keys.molecular_weight, molecular_weight);
+          }
+          inverse_diffusion_coefficient = 1.0 / diffusion_coefficient;
+          speed_factor = 8.0 * constants::R / (pi * molecular_weight);
+          return status;
+        }
+
+        /// @brief Finds MW / ρ of an aerosol water species, which converts its concentration to a volume of water
+        ConfigParseStatus FindMolarVolume(const types::Mechanism& mechanism, types::SymbolId water, double& molar_volume)
+        {
+          double molecular_weight = 0;
+          double density = 0;
+          ConfigParseStatus status = FindProperty(mechanism, water, validation::keys.molecular_weight, molecular_weight);
+          if (status == ConfigParseStatus::Success)
+          {
+            status = FindProperty(mechanism, water, validation::keys.density, density);
+          }
+          molar_volume = molecular_weight / density;
+          return status;
+        }
+
+        double SumOfCoefficients(Span<double> coefficients)
+        {
+          double sum = 0;
+          for (double coefficient : coefficients)
+          {
+            sum += coefficient;
+          }
+          return sum;
+        }
+      }  // namespace
+
+      Arrhenius PrepareArrhenius(const compiled::ArrheniusParameters& parameters)
+      {
+        Arrhenius reactions;
+        reactions.B = parameters.B;
+        reactions.C = parameters.C;
+        reactions.E = parameters.E;
+        reactions.A.reserve(parameters.A.size());
+        for (std::size_t i = 0; i < parameters.A.size(); ++i)
+        {
+          reactions.A.push_back(parameters.A[i] * std::pow(parameters.D[i], -parameters.B[i]));
+        }
+        return reactions;
+      }
+
+      void Evaluate(const Arrhenius& reactions, Span<double> temperature, Span<double> pressure, std::vector<double>& rate_constants)
+      {
+        const std::size_t number_of_cells = temperature.size();
+        rate_constants.resize(reactions.Size() * number_of_cells);
+
+        double inverse_temperature[cell_block_size];
+        double log_temperature[cell_block_size];
+        for (std::size_t first = 0; first < number_of_cells; first += cell_block_size)
+        {
+          const std::size_t size = std::min(cell_block_size, number_of_cells - first);
+          const double* T = temperature.data() + first;
+          const double* P = pressure.data() + first;
+          for (std::size_t c = 0; c < size; ++c)
+          {
+            inverse_temperature[c] = 1.0 / T[c];
+            log_temperature[c] = std::log(T[c]);
+          }
+          for (std::size_t i = 0; i < reactions.Size(); ++i)
+          {
+            const double A = reactions.A[i];
+            const double B = reactions.B[i];
+            const double C = reactions.C[i];
+            const double E = reactions.E[i];
+            double* k = rate_constants.data() + i * number_of_cells + first;
+            for (std::size_t c = 0; c < size; ++c)
+            {
+              k[c] = A * std::exp(C * inverse_temperature[c] + B * log_temperature[c]) * (1.0 + E * P[c]);
+            }
+          }
+        }
+      }
+
+      Troe PrepareTroe(const compiled::TroeParameters& parameters)
+      {
+        Troe reactions;
+        reactions.k0_B = parameters.k0_B;
+        reactions.k0_C = parameters.k0_C;
+        reactions.kinf_B = parameters.kinf_B;
+        reactions.kinf_C = parameters.kinf_C;
+        for (std::size_t i = 0; i < parameters.k0_A.size(); ++i)
+        {
+          reactions.log_k0_A.push_back(std::log(parameters.k0_A[i]) - parameters.k0_B[i] * std::log(300.0));
+          reactions.log_kinf_A.push_back(std::log(parameters.kinf_A[i]) - parameters.kinf_B[i] * std::log(300.0));
+          reactions.log_Fc.push_back(std::log(parameters.Fc[i]));
+          reactions.inverse_N.push_back(1.0 / parameters.N[i]);
+        }
+        return reactions;
+      }
+
+      void Evaluate(const Troe& reactions, Span<double> temperature, Span<double> air_density, std::vector<double>& rate_constants)
+      {
+        const std::size_t number_of_cells = temperature.size();
+        rate_constants.resize(reactions.Size() * number_of_cells);
+        const double inverse_log_10 = 1.0 / std::log(10.0);
+
+        double inverse_temperature[cell_block_size];
+        double log_temperature[cell_block_size];
+        double log_air_density[cell_block_size];
+        for (std::size_t first = 0; first < number_of_cells; first += cell_block_size)
+        {
+          const std::size_t size = std::min(cell_block_size, number_of_cells - first);
+          const double* T = temperature.data() + first;
+          const double* M = air_density.data() + first;
+          for (std::size_t c = 0; c < size; ++c)
+          {
+            inverse_temperature[c] = 1.0 / T[c];
+            log_temperature[c] = std::log(T[c]);
+            log_air_density[c] = std::log(M[c] * MolesM3ToMoleculesCm3);
+          }
+          for (std::size_t i = 0; i < reactions.Size(); ++i)
+          {
+            const double log_k0_A = reactions.log_k0_A[i];
+            const double k0_B = reactions.k0_B[i];
+            const double k0_C = reactions.k0_C[i];
+            const double log_kinf_A = reactions.log_kinf_A[i];
+            const double kinf_B = reactions.kinf_B[i];
+            const double kinf_C = reactions.kinf_C[i];
+            const double log_Fc = reactions.log_Fc[i];
+            const double inverse_N = reactions.inverse_N[i];
+            double* k = rate_constants.data() + i * number_of_cells + first;
+            for (std::size_t c = 0; c < size; ++c)
+            {
+              // ln(k0·[M]) and ln(k0·[M] / kinf)
+              const double log_k0_M = log_k0_A + k0_C * inverse_temperature[c] + k0_B * log_temperature[c] + log_air_density[c];
+              const double log_ratio = log_k0_M - (log_kinf_A + kinf_C * inverse_temperature[c] + kinf_B * log_temperature[c]);
+              const double log10_ratio = log_ratio * inverse_log_10;
+              k[c] = std::exp(log_k0_M) / (1.0 + std::exp(log_ratio)) *
+                     std::exp(log_Fc / (1.0 + log10_ratio * log10_ratio * inverse_N));
+            }
+          }
+        }
+      }
+
+      Branched PrepareBranched(const compiled::BranchedParameters& parameters)
+      {
+        Branched reactions;
+        reactions.X = parameters.X;
+        reactions.Y = parameters.Y;
+        for (std::size_t i = 0; i < parameters.X.size(); ++i)
+        {
+          const double log_k0 = std::log(2.0e-22) + parameters.n[i];
+          const double A = BranchedStructureTerm(log_k0 + std::log(2.45e19), LogBranchedHighPressureLimit(std::log(293.0)));
+          reactions.log_k0.push_back(log_k0);
+          reactions.Z.push_back(A * (1.0 - parameters.a0[i]) / parameters.a0[i]);
+        }
+        return reactions;
+      }
+
+      void Evaluate(
+          const Branched& reactions,
+          Span<double> temperature,
+          Span<double> air_density,
+          std::vector<double>& nitrate_rate_constants,
+          std::vector<double>& alkoxy_rate_constants)
+      {
+        const std::size_t number_of_cells = temperature.size();
+        nitrate_rate_constants.resize(reactions.Size() * number_of_cells);
+        alkoxy_rate_constants.resize(reactions.Size() * number_of_cells);
+        const double log_10 = std::log(10.0);
+        const double log_0_41 = std::log(0.41);
+
+        double inverse_temperature[cell_block_size];
+        double log_kinf[cell_block_size];
+        double log_air_density[cell_block_size];
+        for (std::size_t first = 0; first < number_of_cells; first += cell_block_size)
+        {
+          const std::size_t size = std::min(cell_block_size, number_of_cells - first);
+          const double* T = temperature.data() + first;
+          const double* M = air_density.data() + first;
+          for (std::size_t c = 0; c < size; ++c)
+          {
+            inverse_temperature[c] = 1.0 / T[c];
+            log_kinf[c] = LogBranchedHighPressureLimit(std::log(T[c]));
+            log_air_density[c] = std::log(M[c] * MolesM3ToMoleculesCm3);
+          }
+          for (std::size_t i = 0; i < reactions.Size(); ++i)
+          {
+            const double X = reactions.X[i];
+            const double Y = reactions.Y[i];
+            const double log_k0 = reactions.log_k0[i];
+            const double Z = reactions.Z[i];
+            double* nitrate = nitrate_rate_constants.data() + i * number_of_cells + first;
+            double* alkoxy = alkoxy_rate_constants.data() + i * number_of_cells + first;
+            for (std::size_t c = 0; c < size; ++c)
+            {
+              // the structure term, written out so the loop has no calls other than exp
+              const double log_k0_M = log_k0 + log_air_density[c];
+              const double log_ratio = log_k0_M - log_kinf[c];
+              const double log10_ratio = log_ratio / log_10;
+              const double A = std::exp(log_k0_M) / (1.0 + std::exp(log_ratio)) * std::exp(log_0_41 / (1.0 + log10_ratio * log10_ratio));
+              const double k = X * std::exp(-Y * inverse_temperature[c]) / (A + Z);
+              nitrate[c] = k * A;
+              alkoxy[c] = k * Z;
+            }
+          }
+        }
+      }
+
+      Tunneling PrepareTunneling(const compiled::TunnelingParameters& parameters)
+      {
+        return { parameters.A, parameters.B, parameters.C };
+      }
+
+      void Evaluate(const Tunneling& reactions, Span<double> temperature, std::vector<double>& rate_constants)
+      {
+        const std::size_t number_of_cells = temperature.size();
+        rate_constants.resize(reactions.Size() * number_of_cells);
+
+        double inverse_temperature[cell_block_size];
+        double inverse_temperature_cubed[cell_block_size];
+        for (std::size_t first = 0; first < number_of_cells; first += cell_block_size)
+        {
+          const std::size_t size = std::min(cell_block_size, number_of_cells - first);
+          const double* T = temperature.data() + first;
+          for (std::size_t c = 0; c < size; ++c)
+          {
+            inverse_temperature[c] = 1.0 / T[c];
+            inverse_temperature_cubed[c] = inverse_temperature[c] * inverse_temperature[c] * inverse_temperature[c];
+          }
+          for (std::size_t i = 0; i < reactions.Size(); ++i)
+          {
+            const double A = reactions.A[i];
+            const double B = reactions.B[i];
+            const double C = reactions.C[i];
+            double* k = rate_constants.data() + i * number_of_cells + first;
+            for (std::size_t c = 0; c < size; ++c)
+            {
+              k[c] = A * std::exp(C * inverse_temperature_cubed[c] - B * inverse_temperature[c]);
+            }
+          }
+        }
+      }
+
+      std::pair<ConfigParseStatus, Surface> PrepareSurface(const types::Mechanism& mechanism, const CompiledMechanism& compiled)
+      {
+        Surface reactions;
+        const compiled::ReactionRange range = compiled.Range(types::ReactionType::Surface);
+        for (std::size_t i = 0; i < range.size(); ++i)
+        {
+          double inverse_diffusion_coefficient = 0;
+          double speed_factor = 0;
+          ConfigParseStatus status = FindTransportProperties(
+              mechanism, compiled.reactants.Species(range.begin + i)[0], inverse_diffusion_coefficient, speed_factor);
+          if (status != ConfigParseStatus::Success)
+          {
+            return { status, Surface() };
+          }
+          reactions.inverse_diffusion_coefficient.push_back(inverse_diffusion_coefficient);
+          reactions.speed_factor.push_back(speed_factor);
+          reactions.four_over_probability.push_back(4.0 / compiled.surface[i]);
+        }
+        return { ConfigParseStatus::Success, reactions };
+      }
+
+      void Evaluate(
+          const Surface& reactions,
+          Span<double> temperature,
+          Span<double> radius,
+          Span<double> number_concentration,
+          std::vector<double>& rate_constants)
+      {
+        const std::size_t number_of_cells = temperature.size();
+        rate_constants.resize(reactions.Size() * number_of_cells);
+
+        double surface_area[cell_block_size];
+        for (std::size_t first = 0; first < number_of_cells; first += cell_block_size)
+        {
+          const std::size_t size = std::min(cell_block_size, number_of_cells - first);
+          const double* T = temperature.data() + first;
+          const double* r = radius.data() + first;
+          const double* N = number_concentration.data() + first;
+          for (std::size_t c = 0; c < size; ++c)
+          {
+            surface_area[c] = 4.0 * pi * N[c] * r[c] * r[c];
+          }
+          for (std::size_t i = 0; i < reactions.Size(); ++i)
+          {
+            const double inverse_diffusion_coefficient = reactions.inverse_diffusion_coefficient[i];
+            const double speed_factor = reactions.speed_factor[i];
+            const double four_over_probability = reactions.four_over_probability[i];
+            double* k = rate_constants.data() + i * number_of_cells + first;
+            for (std::size_t c = 0; c < size; ++c)
+            {
+              // the diffusion and free-molecular resistances of uptake, added
+              const double mean_speed = std::sqrt(speed_factor * T[c]);
+              k[c] = surface_area[c] / (r[c] * inverse_diffusion_coefficient + four_over_probability / mean_speed);
+            }
+          }
+        }
+      }
+
+      std::pair<ConfigParseStatus, Simpol> PrepareSimpol(const types::Mechanism& mechanism, const CompiledMechanism& compiled)
+      {
+        // log10 to ln, and atm to Pa
+        const double log_10 = std::log(10.0);
+        const double log_atm = std::log(101325.0);
+
+        Simpol reactions;
+        const compiled::SimpolParameters& parameters = compiled.simpol_phase_transfer;
+        const compiled::ReactionRange range = compiled.Range(types::ReactionType::SimpolPhaseTransfer);
+        for (std::size_t i = 0; i < range.size(); ++i)
+        {
+          double inverse_diffusion_coefficient = 0;
+          double speed_factor = 0;
+          ConfigParseStatus status = FindTransportProperties(
+              mechanism, compiled.reactants.Species(range.begin + i)[0], inverse_diffusion_coefficient, speed_factor);
+          if (status != ConfigParseStatus::Success)
+          {
+            return { status, Simpol() };
+          }
+          reactions.B0.push_back(parameters.B0[i] * log_10);
+          reactions.B1.push_back(parameters.B1[i] * log_10 + log_atm);
+          reactions.B2.push_back(parameters.B2[i] * log_10);
+          reactions.B3.push_back(parameters.B3[i] * log_10);
+          reactions.inverse_diffusion_coefficient.push_back(inverse_diffusion_coefficient);
+          reactions.speed_factor.push_back(speed_factor);
+        }
+        return { ConfigParseStatus::Success, reactions };
+      }
+
+      void Evaluate(
+          const Simpol& reactions,
+          Span<double> temperature,
+          Span<double> radius,
+          Span<double> number_concentration,
+          std::vector<double>& saturation_concentration,
+          std::vector<double>& condensation_rate_constants)
+      {
+        const std::size_t number_of_cells = temperature.size();
+        const std::size_t number_of_bins = number_of_cells == 0 ? 0 : radius.size() / number_of_cells;
+        saturation_concentration.resize(reactions.Size() * number_of_cells);
+        condensation_rate_constants.resize(reactions.Size() * number_of_bins * number_of_cells);
+
+        double inverse_temperature[cell_block_size];
+        double log_temperature[cell_block_size];
+        double inverse_RT[cell_block_size];
+        double mean_speed[cell_block_size];
+        // the surface area of each bin in the block, bin by bin
+        std::vector<double> surface_area(number_of_bins * cell_block_size);
+        for (std::size_t first = 0; first < number_of_cells; first += cell_block_size)
+        {
+          const std::size_t size = std::min(cell_block_size, number_of_cells - first);
+          const double* T = temperature.data() + first;
+          for (std::size_t c = 0; c < size; ++c)
+          {
+            inverse_temperature[c] = 1.0 / T[c];
+            log_temperature[c] = std::log(T[c]);
+            inverse_RT[c] = inverse_temperature[c] / constants::R;
+          }
+          for (std::size_t b = 0; b < number_of_bins; ++b)
+          {
+            const double* r = radius.data() + b * number_of_cells + first;
+            const double* N = number_concentration.data() + b * number_of_cells + first;
+            double* area = surface_area.data() + b * cell_block_size;
+            for (std::size_t c = 0; c < size; ++c)
+            {
+              area[c] = 4.0 * pi * N[c] * r[c] * r[c];
+            }
+          }
+          for (std::size_t i = 0; i < reactions.Size(); ++i)
+          {
+            const double B0 = reactions.B0[i];
+            const double B1 = reactions.B1[i];
+            const double B2 = reactions.B2[i];
+            const double B3 = reactions.B3[i];
+            const double speed_factor = reactions.speed_factor[i];
+            const double inverse_diffusion_coefficient = reactions.inverse_diffusion_coefficient[i];
+            double* saturation = saturation_concentration.data() + i * number_of_cells + first;
+            for (std::size_t c = 0; c < size; ++c)
+            {
+              saturation[c] = std::exp(B0 * inverse_temperature[c] + B1 + B2 * T[c] + B3 * log_temperature[c]) * inverse_RT[c];
+              mean_speed[c] = std::sqrt(speed_factor * T[c]);
+            }
+            for (std::size_t b = 0; b < number_of_bins; ++b)
+            {
+              const double* r = radius.data() + b * number_of_cells + first;
+              const double* area = surface_area.data() + b * cell_block_size;
+              double* k = condensation_rate_constants.data() + (i * number_of_bins + b) * number_of_cells + first;
+              for (std::size_t c = 0; c < size; ++c)
+              {
+                k[c] = area[c] / (r[c] * inverse_diffusion_coefficient + 4.0 / mean_speed[c]);
+              }
+            }
+          }
+        }
+      }
+
+      std::pair<ConfigParseStatus, HenrysLaw> PrepareHenrysLaw(const types::Mechanism& mechanism, const CompiledMechanism& compiled)
+      {
+        HenrysLaw reactions;
+        const compiled::ReactionRange range = compiled.Range(types::ReactionType::HenrysLaw);
+        for (std::size_t reaction = range.begin; reaction < range.end; ++reaction)
+        {
+          const types::SymbolId gas = compiled.reactants.Species(reaction)[0];
+          const types::SymbolId water = compiled.aerosol_phase_water[reaction];
+          double HLC_298 = 0;
+          double C = 0;
+          double inverse_diffusion_coefficient = 0;
+          double speed_factor = 0;
+          double water_molar_volume = 0;
+          ConfigParseStatus status = FindProperty(mechanism, gas, validation::keys.henrys_law_constant_298, HLC_298);
+          if (status == ConfigParseStatus::Success)
+          {
+            status = FindProperty(mechanism, gas, validation::keys.henrys_law_constant_exponential_factor, C);
+          }
+          if (status == ConfigParseStatus::Success)
+          {
+            status = FindTransportProperties(mechanism, gas, inverse_diffusion_coefficient, speed_factor);
+          }
+          if (status == ConfigParseStatus::Success)
+          {
+            status = FindMolarVolume(mechanism, water, water_molar_volume);
+          }
+          if (status != ConfigParseStatus::Success)
+          {
+            return { status, HenrysLaw() };
+          }
+          reactions.HLC_298.push_back(HLC_298);
+          reactions.C.push_back(C);
+          reactions.inverse_diffusion_coefficient.push_back(inverse_diffusion_coefficient);
+          reactions.speed_factor.push_back(speed_factor);
+          reactions.water.push_back(water);
+          reactions.water_molar_volume.push_back(water_molar_volume);
+        }
+        return { ConfigParseStatus::Success, reactions };
+      }
+
+      void Evaluate(
+          const HenrysLaw& reactions,
+          Span<double> temperature,
+          Span<double> radius,
+          Span<double> number_concentration,
+          Span<double> concentrations,
+          std::vector<double>& forward_rate_constants,
+          std::vector<double>& reverse_rate_constants)
+      {
+        const std::size_t number_of_cells = temperature.size();
+        forward_rate_constants.resize(reactions.Size() * number_of_cells);
+        reverse_rate_constants.resize(reactions.Size() * number_of_cells);
+
+        double temperature_difference[cell_block_size];
+        double surface_area[cell_block_size];
+        for (std::size_t first = 0; first < number_of_cells; first += cell_block_size)
+        {
+          const std::size_t size = std::min(cell_block_size, number_of_cells - first);
+          const double* T = temperature.data() + first;
+          const double* r = radius.data() + first;
+          const double* N = number_concentration.data() + first;
+          for (std::size_t c = 0; c < size; ++c)
+          {
+            temperature_difference[c] = 1.0 / T[c] - 1.0 / 298.0;
+            surface_area[c] = 4.0 * pi * N[c] * r[c] * r[c];
+          }
+          for (std::size_t i = 0; i < reactions.Size(); ++i)
+          {
+            const double HLC_298 = reactions.HLC_298[i];
+            const double C = reactions.C[i];
+            const double inverse_diffusion_coefficient = reactions.inverse_diffusion_coefficient[i];
+            const double speed_factor = reactions.speed_factor[i];
+            const double water_molar_volume = reactions.water_molar_volume[i];
+            const double* W = concentrations.data() + reactions.water[i] * number_of_cells + first;
+            double* forward = forward_rate_constants.data() + i * number_of_cells + first;
+            double* reverse = reverse_rate_constants.data() + i * number_of_cells + first;
+            for (std::size_t c = 0; c < size; ++c)
+            {
+              const double mean_speed = std::sqrt(speed_factor * T[c]);
+              const double HLC = HLC_298 * std::exp(C * temperature_difference[c]);
+              const double capacity = HLC * constants::R * T[c] * W[c] * water_molar_volume;
+              // cells without aerosol water or particles exchange nothing, rather than dividing by zero
+              forward[c] = capacity > 0.0 ? surface_area[c] / (r[c] * inverse_diffusion_coefficient + 4.0 / mean_speed) : 0.0;
+              reverse[c] = forward[c] > 0.0 ? forward[c] / capacity : 0.0;
+            }
+          }
+        }
+      }
+
+      std::pair<ConfigParseStatus, AqueousEquilibrium> PrepareAqueousEquilibrium(
+          const types::Mechanism& mechanism,
+          const CompiledMechanism& compiled)
+      {
+        AqueousEquilibrium reactions;
+        const compiled::AqueousEquilibriumParameters& parameters = compiled.aqueous_equilibrium;
+        const compiled::ReactionRange range = compiled.Range(types::ReactionType::AqueousEquilibrium);
+        for (std::size_t i = 0; i < range.size(); ++i)
+        {
+          const types::SymbolId water = compiled.aerosol_phase_water[range.begin + i];
+          double water_molar_volume = 0;
+          ConfigParseStatus status = FindMolarVolume(mechanism, water, water_molar_volume);
+          if (status != ConfigParseStatus::Success)
+          {
+            return { status, AqueousEquilibrium() };
+          }
+          reactions.forward_A.push_back(parameters.A[i] * parameters.k_reverse[i]);
+          reactions.C.push_back(parameters.C[i]);
+          reactions.k_reverse.push_back(parameters.k_reverse[i]);
+          reactions.forward_water_exponent.push_back(1.0 - SumOfCoefficients(compiled.reactants.Coefficients(range.begin + i)));
+          reactions.reverse_water_exponent.push_back(1.0 - SumOfCoefficients(compiled.products.Coefficients(range.begin + i)));
+          reactions.water.push_back(water);
+          reactions.water_molar_volume.push_back(water_molar_volume);
+        }
+        return { ConfigParseStatus::Success, reactions };
+      }
+
+      void Evaluate(
+          const AqueousEquilibrium& reactions,
+          Span<double> temperature,
+          Span<double> concentrations,
+          std::vector<double>& forward_rate_constants,
+          std::vector<double>& reverse_rate_constants)
+      {
+        const std::size_t number_of_cells = temperature.size();
+        forward_rate_constants.resize(reactions.Size() * number_of_cells);
+        reverse_rate_constants.resize(reactions.Size() * number_of_cells);
+
+        double temperature_difference[cell_block_size];
+        for (std::size_t first = 0; first < number_of_cells; first += cell_block_size)
+        {
+          const std::size_t size = std::min(cell_block_size, number_of_cells - first);
+          const double* T = temperature.data() + first;
+          for (std::size_t c = 0; c < size; ++c)
+          {
+            temperature_difference[c] = 1.0 / T[c] - 1.0 / 298.0;
+          }
+          for (std::size_t i = 0; i < reactions.Size(); ++i)
+          {
+            const double forward_A = reactions.forward_A[i];
+            const double C = reactions.C[i];
+            const double k_reverse = reactions.k_reverse[i];
+            const double forward_water_exponent = reactions.forward_water_exponent[i];
+            const double reverse_water_exponent = reactions.reverse_water_exponent[i];
+            const double water_molar_volume = reactions.water_molar_volume[i];
+            const double* W = concentrations.data() + reactions.water[i] * number_of_cells + first;
+            double* forward = forward_rate_constants.data() + i * number_of_cells + first;
+            double* reverse = reverse_rate_constants.data() + i * number_of_cells + first;
+            for (std::size_t c = 0; c < size; ++c)
+            {
+              // cells without aerosol water react nothing, rather than raising zero to a negative power
+              const double water_volume = W[c] * water_molar_volume;
+              forward[c] = water_volume > 0.0
+                               ? forward_A * std::exp(C * temperature_difference[c]) * std::pow(water_volume, forward_water_exponent)
+                               : 0.0;
+              reverse[c] = water_volume > 0.0 ? k_reverse * std::pow(water_volume, reverse_water_exponent) : 0.0;
+            }
+          }
+        }
+      }
+    }  // namespace rate_constants
+  }  // namespace mechanism_configuration
+}  // namespace open_atmos
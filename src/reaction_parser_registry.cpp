@@ -0,0 +1,114 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <open_atmos/mechanism_configuration/parser_types.hpp>
+#include <open_atmos/mechanism_configuration/reaction_parser_registry.hpp>
+#include <open_atmos/mechanism_configuration/serialization.hpp>
+#include <open_atmos/mechanism_configuration/validation.hpp>
+
+namespace open_atmos
+{
+  namespace mechanism_configuration
+  {
+    namespace
+    {
+      /// @brief Seeds to try for each table size before the table is made larger
+      constexpr std::size_t seeds_per_size = 1024;
+    }  // namespace
+
+    ReactionParserRegistry& ReactionParserRegistry::Instance()
+    {
+      static ReactionParserRegistry registry;
+      return registry;
+    }
+
+    ReactionParserRegistry::ReactionParserRegistry()
+    {
+      Register(validation::keys.Arrhenius_key, std::make_unique<ArrheniusParser>());
+      Register(validation::keys.HenrysLaw_key, std::make_unique<HenrysLawParser>());
+      Register(validation::keys.WetDeposition_key, std::make_unique<WetDepositionParser>());
+      Register(validation::keys.AqueousPhaseEquilibrium_key, std::make_unique<AqueousEquilibriumParser>());
+      Register(validation::keys.SimpolPhaseTransfer_key, std::make_unique<SimpolPhaseTransferParser>());
+      Register(validation::keys.FirstOrderLoss_key, std::make_unique<FirstOrderLossParser>());
+      Register(validation::keys.Emission_key, std::make_unique<EmissionParser>());
+      Register(validation::keys.CondensedPhasePhotolysis_key, std::make_unique<CondensedPhasePhotolysisParser>());
+      Register(validation::keys.Photolysis_key, std::make_unique<PhotolysisParser>());
+      Register(validation::keys.Surface_key, std::make_unique<SurfaceParser>());
+      Register(validation::keys.Tunneling_key, std::make_unique<TunnelingParser>());
+      Register(validation::keys.Branched_key, std::make_unique<BranchedParser>());
+      Register(validation::keys.Troe_key, std::make_unique<TroeParser>());
+      Register(validation::keys.CondensedPhaseArrhenius_key, std::make_unique<CondensedPhaseArrheniusParser>());
+    }
+
+    void ReactionParserRegistry::Register(const std::string& type, std::unique_ptr<IReactionParser> parser)
+    {
+      std::lock_guard<std::mutex> lock(registration_);
+      for (auto& [registered_type, registered_parser] : parsers_)
+      {
+        if (registered_type == type)
+        {
+          registered_parser = std::move(parser);
+          return;
+        }
+      }
+      parsers_.emplace_back(type, std::move(parser));
+      Rebuild();
+    }
+
+    IReactionParser* ReactionParserRegistry::Find(std::string_view type) const
+    {
+      if (slots_.empty())
+      {
+        return nullptr;
+      }
+      std::uint32_t position = slots_[Slot(type)];
+      // the hash only separates the registered types, so anything else has to be ruled out by comparing
+      if (position == empty_slot || parsers_[position].first != type)
+      {
+        return nullptr;
+      }
+      return parsers_[position].second.get();
+    }
+
+    std::size_t ReactionParserRegistry::Size() const
+    {
+      return parsers_.size();
+    }
+
+    std::size_t ReactionParserRegistry::Slot(std::string_view type) const
+    {
+      return Fnv1a(reinterpret_cast<const std::byte*>(type.data()), type.size(), seed_) & (slots_.size() - 1);
+    }
+
+    void ReactionParserRegistry::Rebuild()
+    {
+      std::size_t size = 1;
+      while (size < 2 * parsers_.size())
+      {
+        size *= 2;
+      }
+      for (;; size *= 2)
+      {
+        slots_.assign(size, empty_slot);
+        for (std::size_t attempt = 0; attempt < seeds_per_size; ++attempt)
+        {
+          seed_ = 0xcbf29ce484222325ull + attempt * 0x9e3779b97f4a7c15ull;
+          std::fill(slots_.begin(), slots_.end(), empty_slot);
+          bool collision = false;
+          for (std::size_t i = 0; i < parsers_.size() && !collision; ++i)
+          {
+            std::uint32_t& slot = slots_[Slot(parsers_[i].first)];
+            collision = slot != empty_slot;
+            slot = static_cast<std::uint32_t>(i);
+          }
+          if (!collision)
+          {
+            return;
+          }
+        }
+      }
+    }
+  }  // namespace mechanism_configuration
+}  // namespace open_atmos
@@ -0,0 +1,417 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <open_atmos/mechanism_configuration/jacobian.hpp>
+#include <open_atmos/mechanism_configuration/reordering.hpp>
+#include <queue>
+#include <utility>
+
+namespace open_atmos
+{
+  namespace mechanism_configuration
+  {
+    namespace
+    {
+      using Graph = std::vector<std::vector<std::uint32_t>>;
+
+      /// @brief The neighbours of each index in the graph of A + Aᵀ, without self loops, in increasing order
+      Graph SymmetricGraph(const SparsityPattern& pattern)
+      {
+        Graph graph(pattern.number_of_rows);
+        for (std::size_t row = 0; row < pattern.number_of_rows; ++row)
+        {
+          for (std::uint32_t column : pattern.Columns(row))
+          {
+            if (column != row)
+            {
+              graph[row].push_back(column);
+              graph[column].push_back(static_cast<std::uint32_t>(row));
+            }
+          }
+        }
+        for (auto& neighbours : graph)
+        {
+          std::sort(neighbours.begin(), neighbours.end());
+          neighbours.erase(std::unique(neighbours.begin(), neighbours.end()), neighbours.end());
+        }
+        return graph;
+      }
+
+      /// @brief A breadth-first search that records the level of each node it reaches
+      /// @return The nodes in the last level
+      std::vector<std::uint32_t> LastLevel(const Graph& graph, std::uint32_t start, std::vector<int>& level, int& depth)
+      {
+        std::fill(level.begin(), level.end(), -1);
+        std::vector<std::uint32_t> current = { start };
+        level[start] = 0;
+        depth = 0;
+        while (true)
+        {
+          std::vector<std::uint32_t> next;
+          for (std::uint32_t node : current)
+          {
+            for (std::uint32_t neighbour : graph[node])
+            {
+              if (level[neighbour] < 0)
+              {
+                level[neighbour] = depth + 1;
+                next.push_back(neighbour);
+              }
+            }
+          }
+          if (next.empty())
+          {
+            return current;
+          }
+          current = std::move(next);
+          ++depth;
+        }
+      }
+
+      /// @brief Finds a node that is far from the rest of its component, by repeatedly moving to the lowest-degree node
+      ///        of the last level until the depth of the search stops growing (George and Liu)
+      std::uint32_t PseudoPeripheralNode(const Graph& graph, std::uint32_t start)
+      {
+        std::vector<int> level(graph.size());
+        int depth = 0;
+        std::vector<std::uint32_t> last = LastLevel(graph, start, level, depth);
+        while (true)
+        {
+          std::uint32_t candidate = *std::min_element(
+              last.begin(),
+              last.end(),
+              [&](std::uint32_t left, std::uint32_t right)
+              { return std::make_pair(graph[left].size(), left) < std::make_pair(graph[right].size(), right); });
+          int candidate_depth = 0;
+          std::vector<std::uint32_t> candidate_last = LastLevel(graph, candidate, level, candidate_depth);
+          if (candidate_depth <= depth)
+          {
+            return start;
+          }
+          start = candidate;
+          depth = candidate_depth;
+          last = std::move(candidate_last);
+        }
+      }
+
+      std::vector<std::uint32_t> ReverseCuthillMcKee(const Graph& graph)
+      {
+        const std::size_t size = graph.size();
+        std::vector<std::uint32_t> order;
+        order.reserve(size);
+        std::vector<bool> visited(size, false);
+        auto by_degree = [&](std::uint32_t left, std::uint32_t right)
+        { return std::make_pair(graph[left].size(), left) < std::make_pair(graph[right].size(), right); };
+
+        while (order.size() < size)
+        {
+          // each component starts from a peripheral node near its lowest-degree node
+          std::uint32_t start = 0;
+          bool found = false;
+          for (std::uint32_t node = 0; node < size; ++node)
+          {
+            if (!visited[node] && (!found || by_degree(node, start)))
+            {
+              start = node;
+              found = true;
+            }
+          }
+          start = PseudoPeripheralNode(graph, start);
+
+          std::size_t next = order.size();
+          order.push_back(start);
+          visited[start] = true;
+          std::vector<std::uint32_t> neighbours;
+          for (; next < order.size(); ++next)
+          {
+            neighbours.clear();
+            for (std::uint32_t neighbour : graph[order[next]])
+            {
+              if (!visited[neighbour])
+              {
+                visited[neighbour] = true;
+                neighbours.push_back(neighbour);
+              }
+            }
+            std::sort(neighbours.begin(), neighbours.end(), by_degree);
+            order.insert(order.end(), neighbours.begin(), neighbours.end());
+          }
+        }
+        std::reverse(order.begin(), order.end());
+        return order;
+      }
+
+      /// @brief Eliminates the node with the fewest neighbours in the elimination graph, joins its neighbours into a
+      ///        clique, and repeats. The elimination graph is kept explicitly, which suits the size of chemical
+      ///        Jacobians better than the quotient graph of approximate minimum degree.
+      std::vector<std::uint32_t> MinimumDegree(Graph graph)
+      {
+        const std::size_t size = graph.size();
+        std::vector<std::uint32_t> order;
+        order.reserve(size);
+        std::vector<bool> eliminated(size, false);
+
+        using Entry = std::pair<std::size_t, std::uint32_t>;
+        std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> queue;
+        for (std::uint32_t node = 0; node < size; ++node)
+        {
+          queue.emplace(graph[node].size(), node);
+        }
+
+        std::vector<std::uint32_t> merged;
+        while (!queue.empty())
+        {
+          auto [degree, node] = queue.top();
+          queue.pop();
+          // entries are not removed when a degree changes, so skip the stale ones
+          if (eliminated[node] || degree != graph[node].size())
+          {
+            continue;
+          }
+          eliminated[node] = true;
+          order.push_back(node);
+
+          const std::vector<std::uint32_t> neighbours = std::move(graph[node]);
+          graph[node].clear();
+          for (std::uint32_t neighbour : neighbours)
+          {
+            std::vector<std::uint32_t>& adjacent = graph[neighbour];
+            merged.clear();
+            std::set_union(adjacent.begin(), adjacent.end(), neighbours.begin(), neighbours.end(), std::back_inserter(merged));
+            merged.erase(
+                std::remove_if(merged.begin(), merged.end(), [&](std::uint32_t other) { return other == neighbour || other == node; }),
+                merged.end());
+            adjacent.swap(merged);
+            queue.emplace(adjacent.size(), neighbour);
+          }
+        }
+        return order;
+      }
+
+      void Renumber(types::SymbolId& species, const std::vector<std::uint32_t>& position)
+      {
+        if (species < position.size())
+        {
+          species = position[species];
+        }
+      }
+
+      void Renumber(std::vector<types::ReactionComponent>& components, const std::vector<std::uint32_t>& position)
+      {
+        for (auto& component : components)
+        {
+          Renumber(component.species_id, position);
+        }
+      }
+
+      // Each Renumber overload updates the species identifiers one kind of reaction holds
+
+      template<typename T>
+      void RenumberReactantsAndProducts(T& reaction, const std::vector<std::uint32_t>& position)
+      {
+        Renumber(reaction.reactants, position);
+        Renumber(reaction.products, position);
+      }
+
+      void Renumber(types::Arrhenius& reaction, const std::vector<std::uint32_t>& position)
+      {
+        RenumberReactantsAndProducts(reaction, position);
+      }
+
+      void Renumber(types::Branched& reaction, const std::vector<std::uint32_t>& position)
+      {
+        Renumber(reaction.reactants, position);
+        Renumber(reaction.nitrate_products, position);
+        Renumber(reaction.alkoxy_products, position);
+      }
+
+      void Renumber(types::CondensedPhaseArrhenius& reaction, const std::vector<std::uint32_t>& position)
+      {
+        RenumberReactantsAndProducts(reaction, position);
+        Renumber(reaction.aerosol_phase_water, position);
+      }
+
+      void Renumber(types::CondensedPhasePhotolysis& reaction, const std::vector<std::uint32_t>& position)
+      {
+        RenumberReactantsAndProducts(reaction, position);
+        Renumber(reaction.aerosol_phase_water, position);
+      }
+
+      void Renumber(types::Emission& reaction, const std::vector<std::uint32_t>& position)
+      {
+        Renumber(reaction.products, position);
+      }
+
+      void Renumber(types::FirstOrderLoss& reaction, const std::vector<std::uint32_t>& position)
+      {
+        Renumber(reaction.reactants, position);
+      }
+
+      void Renumber(types::SimpolPhaseTransfer& reaction, const std::vector<std::uint32_t>& position)
+      {
+        Renumber(reaction.gas_phase_species.species_id, position);
+        Renumber(reaction.aerosol_phase_species.species_id, position);
+      }
+
+      void Renumber(types::AqueousEquilibrium& reaction, const std::vector<std::uint32_t>& position)
+      {
+        RenumberReactantsAndProducts(reaction, position);
+        Renumber(reaction.aerosol_phase_water, position);
+      }
+
+      void Renumber(types::WetDeposition&, const std::vector<std::uint32_t>&)
+      {
+      }
+
+      void Renumber(types::HenrysLaw& reaction, const std::vector<std::uint32_t>& position)
+      {
+        Renumber(reaction.gas_phase_species, position);
+        Renumber(reaction.aerosol_phase_species, position);
+        Renumber(reaction.aerosol_phase_water, position);
+      }
+
+      void Renumber(types::Photolysis& reaction, const std::vector<std::uint32_t>& position)
+      {
+        RenumberReactantsAndProducts(reaction, position);
+      }
+
+      void Renumber(types::Surface& reaction, const std::vector<std::uint32_t>& position)
+      {
+        Renumber(reaction.gas_phase_species.species_id, position);
+        Renumber(reaction.gas_phase_products, position);
+      }
+
+      void Renumber(types::Troe& reaction, const std::vector<std::uint32_t>& position)
+      {
+        RenumberReactantsAndProducts(reaction, position);
+      }
+
+      void Renumber(types::Tunneling& reaction, const std::vector<std::uint32_t>& position)
+      {
+        RenumberReactantsAndProducts(reaction, position);
+      }
+
+      template<typename T>
+      void RenumberAll(std::vector<T>& reactions, const std::vector<std::uint32_t>& position)
+      {
+        for (auto& reaction : reactions)
+        {
+          Renumber(reaction, position);
+        }
+      }
+
+      void Renumber(compiled::ComponentLists& lists, const std::vector<std::uint32_t>& position)
+      {
+        for (auto& species : lists.species)
+        {
+          Renumber(species, position);
+        }
+      }
+
+      /// @brief The new position of each current index
+      /// @return InvalidSpeciesOrder if the order is not a permutation of [0, number_of_species)
+      ConfigParseStatus Positions(const std::vector<std::uint32_t>& order, std::size_t number_of_species, std::vector<std::uint32_t>& position)
+      {
+        ConfigParseStatus status = ConfigParseStatus::InvalidSpeciesOrder;
+        if (order.size() != number_of_species)
+        {
+          std::cerr << "[" << configParseStatusToString(status) << "] The order has " << order.size() << " entries for "
+                    << number_of_species << " species" << std::endl;
+          return status;
+        }
+        position.assign(order.size(), types::unknown_symbol);
+        for (std::size_t i = 0; i < order.size(); ++i)
+        {
+          if (order[i] >= number_of_species || position[order[i]] != types::unknown_symbol)
+          {
+            std::cerr << "[" << configParseStatusToString(status) << "] Species " << order[i] << " at position " << i
+                      << (order[i] >= number_of_species ? " does not exist" : " appears more than once") << std::endl;
+            return status;
+          }
+          position[order[i]] = static_cast<std::uint32_t>(i);
+        }
+        return ConfigParseStatus::Success;
+      }
+    }  // namespace
+
+    std::vector<std::uint32_t> ComputeOrdering(const SparsityPattern& pattern, SpeciesOrdering method)
+    {
+      Graph graph = SymmetricGraph(pattern);
+      switch (method)
+      {
+        case SpeciesOrdering::ReverseCuthillMcKee: return ReverseCuthillMcKee(graph);
+        case SpeciesOrdering::MinimumDegree: return MinimumDegree(std::move(graph));
+      }
+      return {};
+    }
+
+    std::vector<std::uint32_t> ComputeSpeciesOrdering(const types::Mechanism& mechanism, SpeciesOrdering method)
+    {
+      return ComputeOrdering(BuildJacobianPattern(mechanism).pattern, method);
+    }
+
+    std::pair<ConfigParseStatus, types::Mechanism> RenumberSpecies(const types::Mechanism& mechanism, const std::vector<std::uint32_t>& order)
+    {
+      std::vector<std::uint32_t> position;
+      ConfigParseStatus status = Positions(order, mechanism.species.size(), position);
+      if (status != ConfigParseStatus::Success)
+      {
+        return { status, types::Mechanism() };
+      }
+      types::Mechanism renumbered = mechanism;
+
+      renumbered.species.clear();
+      renumbered.species_symbols = types::SymbolTable();
+      for (std::uint32_t species : order)
+      {
+        renumbered.species.push_back(mechanism.species[species]);
+        renumbered.species_symbols.Intern(mechanism.species_symbols.Name(species));
+      }
+      // any names beyond the species keep their identifiers
+      for (std::size_t id = order.size(); id < mechanism.species_symbols.Size(); ++id)
+      {
+        renumbered.species_symbols.Intern(mechanism.species_symbols.Name(static_cast<types::SymbolId>(id)));
+      }
+
+      types::Reactions& reactions = renumbered.reactions;
+      RenumberAll(reactions.arrhenius, position);
+      RenumberAll(reactions.branched, position);
+      RenumberAll(reactions.condensed_phase_arrhenius, position);
+      RenumberAll(reactions.condensed_phase_photolysis, position);
+      RenumberAll(reactions.emission, position);
+      RenumberAll(reactions.first_order_loss, position);
+      RenumberAll(reactions.simpol_phase_transfer, position);
+      RenumberAll(reactions.aqueous_equilibrium, position);
+      RenumberAll(reactions.wet_deposition, position);
+      RenumberAll(reactions.henrys_law, position);
+      RenumberAll(reactions.photolysis, position);
+      RenumberAll(reactions.surface, position);
+      RenumberAll(reactions.troe, position);
+      RenumberAll(reactions.tunneling, position);
+      return { ConfigParseStatus::Success, std::move(renumbered) };
+    }
+
+    ConfigParseStatus RenumberSpecies(CompiledMechanism& compiled, const std::vector<std::uint32_t>& order)
+    {
+      std::vector<std::uint32_t> position;
+      ConfigParseStatus status = Positions(order, compiled.number_of_species, position);
+      if (status != ConfigParseStatus::Success)
+      {
+        return status;
+      }
+      Renumber(compiled.reactants, position);
+      Renumber(compiled.products, position);
+      Renumber(compiled.alternative_products, position);
+      for (auto& water : compiled.aerosol_phase_water)
+      {
+        Renumber(water, position);
+      }
+      return ConfigParseStatus::Success;
+    }
+  }  // namespace mechanism_configuration
+}  // namespace open_atmos
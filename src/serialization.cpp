@@ -0,0 +1,587 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <open_atmos/mechanism_configuration/serialization.hpp>
+#include <string>
+
+namespace open_atmos
+{
+  namespace mechanism_configuration
+  {
+    namespace
+    {
+      constexpr std::uint32_t magic = 0x434d414f;  // "OAMC"
+      // magic, version, payload size and checksum
+      constexpr std::size_t header_size = 4 + 4 + 8 + 8;
+
+      /// @brief Appends values to a buffer
+      class Writer
+      {
+       public:
+        template<typename... T>
+        void operator()(const T&... values)
+        {
+          (Put(values), ...);
+        }
+
+        void PutInteger(std::uint64_t value, std::size_t width)
+        {
+          for (std::size_t i = 0; i < width; ++i)
+          {
+            bytes_.push_back(static_cast<std::byte>(value >> (8 * i)));
+          }
+        }
+
+        std::vector<std::byte>& Bytes()
+        {
+          return bytes_;
+        }
+
+       private:
+        void Put(std::uint32_t value)
+        {
+          PutInteger(value, 4);
+        }
+
+        void Put(int value)
+        {
+          PutInteger(static_cast<std::uint32_t>(value), 4);
+        }
+
+        void Put(double value)
+        {
+          std::uint64_t bits;
+          std::memcpy(&bits, &value, sizeof(bits));
+          PutInteger(bits, 8);
+        }
+
+        void Put(const std::string& value)
+        {
+          PutCount(value.size());
+          const std::byte* data = reinterpret_cast<const std::byte*>(value.data());
+          bytes_.insert(bytes_.end(), data, data + value.size());
+        }
+
+        void Put(const types::SymbolTable& table)
+        {
+          PutCount(table.Size());
+          for (std::size_t i = 0; i < table.Size(); ++i)
+          {
+            Put(table.Name(static_cast<types::SymbolId>(i)));
+          }
+        }
+
+        void Put(const std::map<std::string, double>& values)
+        {
+          PutCount(values.size());
+          for (const auto& [key, value] : values)
+          {
+            Put(key);
+            Put(value);
+          }
+        }
+
+        void Put(const std::unordered_map<std::string, std::string>& values)
+        {
+          // written in key order so that the bytes do not depend on the layout of the hash table
+          std::vector<const std::pair<const std::string, std::string>*> sorted;
+          sorted.reserve(values.size());
+          for (const auto& entry : values)
+          {
+            sorted.push_back(&entry);
+          }
+          std::sort(sorted.begin(), sorted.end(), [](const auto* a, const auto* b) { return a->first < b->first; });
+          PutCount(sorted.size());
+          for (const auto* entry : sorted)
+          {
+            Put(entry->first);
+            Put(entry->second);
+          }
+        }
+
+        template<std::size_t N>
+        void Put(const std::array<double, N>& values)
+        {
+          for (double value : values)
+          {
+            Put(value);
+          }
+        }
+
+        template<typename T>
+        void Put(const std::vector<T>& values)
+        {
+          PutCount(values.size());
+          for (const auto& value : values)
+          {
+            Put(value);
+          }
+        }
+
+        /// @brief Writes a structure through the Transfer function that lists its members
+        template<typename T>
+        void Put(const T& object)
+        {
+          // Transfer is shared with the reader, so it takes a mutable reference, but the writer only reads through it
+          Transfer(*this, const_cast<T&>(object));
+        }
+
+        void PutCount(std::size_t count)
+        {
+          PutInteger(static_cast<std::uint32_t>(count), 4);
+        }
+
+        std::vector<std::byte> bytes_;
+      };
+
+      /// @brief Reads values back from a buffer. Reading past the end marks the reader as failed and yields zeros, so a
+      ///        truncated or malformed buffer is detected once at the end instead of after every value.
+      class Reader
+      {
+       public:
+        Reader(const std::byte* data, std::size_t size)
+            : data_(data),
+              end_(data + size)
+        {
+        }
+
+        template<typename... T>
+        void operator()(T&... values)
+        {
+          (Get(values), ...);
+        }
+
+        std::uint64_t GetInteger(std::size_t width)
+        {
+          if (static_cast<std::size_t>(end_ - data_) < width)
+          {
+            failed_ = true;
+            data_ = end_;
+            return 0;
+          }
+          std::uint64_t value = 0;
+          for (std::size_t i = 0; i < width; ++i)
+          {
+            value |= static_cast<std::uint64_t>(data_[i]) << (8 * i);
+          }
+          data_ += width;
+          return value;
+        }
+
+        /// @brief Whether every value was read and the whole buffer was used
+        bool Complete() const
+        {
+          return !failed_ && data_ == end_;
+        }
+
+       private:
+        void Get(std::uint32_t& value)
+        {
+          value = static_cast<std::uint32_t>(GetInteger(4));
+        }
+
+        void Get(int& value)
+        {
+          value = static_cast<int>(static_cast<std::uint32_t>(GetInteger(4)));
+        }
+
+        void Get(double& value)
+        {
+          std::uint64_t bits = GetInteger(8);
+          std::memcpy(&value, &bits, sizeof(value));
+        }
+
+        void Get(std::string& value)
+        {
+          std::size_t size = GetCount();
+          value.assign(reinterpret_cast<const char*>(data_), size);
+          data_ += size;
+        }
+
+        void Get(types::SymbolTable& table)
+        {
+          table = types::SymbolTable();
+          std::size_t count = GetCount();
+          std::string name;
+          for (std::size_t i = 0; i < count; ++i)
+          {
+            Get(name);
+            if (table.Intern(name) != i)
+            {
+              // a name that appears twice cannot have been written by Serialize
+              failed_ = true;
+            }
+          }
+        }
+
+        void Get(std::map<std::string, double>& values)
+        {
+          values.clear();
+          std::size_t count = GetCount();
+          std::string key;
+          for (std::size_t i = 0; i < count; ++i)
+          {
+            Get(key);
+            Get(values[key]);
+          }
+        }
+
+        void Get(std::unordered_map<std::string, std::string>& values)
+        {
+          values.clear();
+          std::size_t count = GetCount();
+          values.reserve(count);
+          std::string key;
+          for (std::size_t i = 0; i < count; ++i)
+          {
+            Get(key);
+            Get(values[key]);
+          }
+        }
+
+        template<std::size_t N>
+        void Get(std::array<double, N>& values)
+        {
+          for (double& value : values)
+          {
+            Get(value);
+          }
+        }
+
+        template<typename T>
+        void Get(std::vector<T>& values)
+        {
+          std::size_t count = GetCount();
+          values.clear();
+          values.resize(count);
+          for (auto& value : values)
+          {
+            Get(value);
+          }
+        }
+
+        template<typename T>
+        void Get(T& object)
+        {
+          Transfer(*this, object);
+        }
+
+        /// @brief Reads the size of a string or container. Every element takes at least one byte, so a count larger than
+        ///        the rest of the buffer is rejected before anything is allocated for it.
+        std::size_t GetCount()
+        {
+          std::size_t count = static_cast<std::size_t>(GetInteger(4));
+          if (count > static_cast<std::size_t>(end_ - data_))
+          {
+            failed_ = true;
+            data_ = end_;
+            return 0;
+          }
+          return count;
+        }
+
+        const std::byte* data_;
+        const std::byte* end_;
+        bool failed_{ false };
+      };
+
+      // Each Transfer lists the members of a type in the order they are stored. It is used for both writing and reading,
+      // so the two can never disagree about the layout.
+
+      template<typename Archive>
+      void Transfer(Archive& archive, types::Species& species)
+      {
+        archive(species.name, species.optional_numerical_properties, species.unknown_properties);
+      }
+
+      template<typename Archive>
+      void Transfer(Archive& archive, types::Phase& phase)
+      {
+        archive(phase.name, phase.species, phase.unknown_properties);
+      }
+
+      template<typename Archive>
+      void Transfer(Archive& archive, types::ReactionComponent& component)
+      {
+        archive(component.species_id, component.coefficient, component.unknown_properties);
+      }
+
+      template<typename Archive>
+      void Transfer(Archive& archive, types::Arrhenius& reaction)
+      {
+        archive(
+            reaction.A,
+            reaction.B,
+            reaction.C,
+            reaction.D,
+            reaction.E,
+            reaction.reactants,
+            reaction.products,
+            reaction.name,
+            reaction.gas_phase,
+            reaction.unknown_properties);
+      }
+
+      template<typename Archive>
+      void Transfer(Archive& archive, types::CondensedPhaseArrhenius& reaction)
+      {
+        archive(
+            reaction.A,
+            reaction.B,
+            reaction.C,
+            reaction.D,
+            reaction.E,
+            reaction.reactants,
+            reaction.products,
+            reaction.name,
+            reaction.aerosol_phase,
+            reaction.aerosol_phase_water,
+            reaction.unknown_properties);
+      }
+
+      template<typename Archive>
+      void Transfer(Archive& archive, types::Troe& reaction)
+      {
+        archive(
+            reaction.k0_A,
+            reaction.k0_B,
+            reaction.k0_C,
+            reaction.kinf_A,
+            reaction.kinf_B,
+            reaction.kinf_C,
+            reaction.Fc,
+            reaction.N,
+            reaction.reactants,
+            reaction.products,
+            reaction.name,
+            reaction.gas_phase,
+            reaction.unknown_properties);
+      }
+
+      template<typename Archive>
+      void Transfer(Archive& archive, types::Branched& reaction)
+      {
+        archive(
+            reaction.X,
+            reaction.Y,
+            reaction.a0,
+            reaction.n,
+            reaction.reactants,
+            reaction.nitrate_products,
+            reaction.alkoxy_products,
+            reaction.name,
+            reaction.gas_phase,
+            reaction.unknown_properties);
+      }
+
+      template<typename Archive>
+      void Transfer(Archive& archive, types::Tunneling& reaction)
+      {
+        archive(
+            reaction.A,
+            reaction.B,
+            reaction.C,
+            reaction.reactants,
+            reaction.products,
+            reaction.name,
+            reaction.gas_phase,
+            reaction.unknown_properties);
+      }
+
+      template<typename Archive>
+      void Transfer(Archive& archive, types::Surface& reaction)
+      {
+        archive(
+            reaction.reaction_probability,
+            reaction.gas_phase_species,
+            reaction.gas_phase_products,
+            reaction.name,
+            reaction.gas_phase,
+            reaction.aerosol_phase,
+            reaction.unknown_properties);
+      }
+
+      template<typename Archive>
+      void Transfer(Archive& archive, types::Photolysis& reaction)
+      {
+        archive(reaction.scaling_factor, reaction.reactants, reaction.products, reaction.name, reaction.gas_phase, reaction.unknown_properties);
+      }
+
+      template<typename Archive>
+      void Transfer(Archive& archive, types::CondensedPhasePhotolysis& reaction)
+      {
+        archive(
+            reaction.scaling_factor_,
+            reaction.reactants,
+            reaction.products,
+            reaction.name,
+            reaction.aerosol_phase,
+            reaction.aerosol_phase_water,
+            reaction.unknown_properties);
+      }
+
+      template<typename Archive>
+      void Transfer(Archive& archive, types::Emission& reaction)
+      {
+        archive(reaction.scaling_factor, reaction.products, reaction.name, reaction.gas_phase, reaction.unknown_properties);
+      }
+
+      template<typename Archive>
+      void Transfer(Archive& archive, types::FirstOrderLoss& reaction)
+      {
+        archive(reaction.scaling_factor, reaction.reactants, reaction.name, reaction.gas_phase, reaction.unknown_properties);
+      }
+
+      template<typename Archive>
+      void Transfer(Archive& archive, types::AqueousEquilibrium& reaction)
+      {
+        archive(
+            reaction.name,
+            reaction.gas_phase,
+            reaction.aerosol_phase,
+            reaction.aerosol_phase_water,
+            reaction.reactants,
+            reaction.products,
+            reaction.A,
+            reaction.C,
+            reaction.k_reverse,
+            reaction.unknown_properties);
+      }
+
+      template<typename Archive>
+      void Transfer(Archive& archive, types::WetDeposition& reaction)
+      {
+        archive(reaction.scaling_factor, reaction.name, reaction.aerosol_phase, reaction.unknown_properties);
+      }
+
+      template<typename Archive>
+      void Transfer(Archive& archive, types::HenrysLaw& reaction)
+      {
+        archive(
+            reaction.name,
+            reaction.gas_phase,
+            reaction.gas_phase_species,
+            reaction.aerosol_phase,
+            reaction.aerosol_phase_water,
+            reaction.aerosol_phase_species,
+            reaction.unknown_properties);
+      }
+
+      template<typename Archive>
+      void Transfer(Archive& archive, types::SimpolPhaseTransfer& reaction)
+      {
+        archive(
+            reaction.gas_phase,
+            reaction.gas_phase_species,
+            reaction.aerosol_phase,
+            reaction.aerosol_phase_species,
+            reaction.name,
+            reaction.B,
+            reaction.unknown_properties);
+      }
+
+      template<typename Archive>
+      void Transfer(Archive& archive, types::Reactions& reactions)
+      {
+        archive(
+            reactions.arrhenius,
+            reactions.branched,
+            reactions.condensed_phase_arrhenius,
+            reactions.condensed_phase_photolysis,
+            reactions.emission,
+            reactions.first_order_loss,
+            reactions.simpol_phase_transfer,
+            reactions.aqueous_equilibrium,
+            reactions.wet_deposition,
+            reactions.henrys_law,
+            reactions.photolysis,
+            reactions.surface,
+            reactions.troe,
+            reactions.tunneling);
+      }
+
+      template<typename Archive>
+      void Transfer(Archive& archive, types::Mechanism& mechanism)
+      {
+        archive(mechanism.name, mechanism.species, mechanism.phases, mechanism.reactions, mechanism.species_symbols, mechanism.phase_symbols);
+      }
+    }  // namespace
+
+    std::uint64_t Fnv1a(const std::byte* data, std::size_t size, std::uint64_t hash)
+    {
+      for (std::size_t i = 0; i < size; ++i)
+      {
+        hash ^= static_cast<std::uint64_t>(data[i]);
+        hash *= 0x100000001b3ull;
+      }
+      return hash;
+    }
+
+    std::vector<std::byte> Serialize(const types::Mechanism& mechanism)
+    {
+      Writer writer;
+      writer.PutInteger(magic, 4);
+      writer.PutInteger(binary_format_version, 4);
+      // the payload size and checksum are filled in once the payload has been written
+      writer.PutInteger(0, 8);
+      writer.PutInteger(0, 8);
+      writer(mechanism);
+
+      std::vector<std::byte>& bytes = writer.Bytes();
+      std::uint64_t payload_size = bytes.size() - header_size;
+      std::uint64_t checksum = Fnv1a(bytes.data() + header_size, payload_size);
+      for (std::size_t i = 0; i < 8; ++i)
+      {
+        bytes[8 + i] = static_cast<std::byte>(payload_size >> (8 * i));
+        bytes[16 + i] = static_cast<std::byte>(checksum >> (8 * i));
+      }
+      return std::move(bytes);
+    }
+
+    std::pair<ConfigParseStatus, types::Mechanism> Deserialize(const std::byte* data, std::size_t size)
+    {
+      types::Mechanism mechanism;
+      if (data == nullptr || size < header_size)
+      {
+        return { ConfigParseStatus::InvalidBinaryFormat, mechanism };
+      }
+
+      Reader header(data, header_size);
+      if (header.GetInteger(4) != magic)
+      {
+        return { ConfigParseStatus::InvalidBinaryFormat, mechanism };
+      }
+      if (header.GetInteger(4) != binary_format_version)
+      {
+        return { ConfigParseStatus::UnsupportedBinaryVersion, mechanism };
+      }
+      std::uint64_t payload_size = header.GetInteger(8);
+      std::uint64_t checksum = header.GetInteger(8);
+      if (payload_size != size - header_size)
+      {
+        return { ConfigParseStatus::InvalidBinaryFormat, mechanism };
+      }
+      if (Fnv1a(data + header_size, payload_size) != checksum)
+      {
+        return { ConfigParseStatus::BinaryChecksumMismatch, mechanism };
+      }
+
+      Reader reader(data + header_size, payload_size);
+      reader(mechanism);
+      if (!reader.Complete())
+      {
+        return { ConfigParseStatus::InvalidBinaryFormat, types::Mechanism() };
+      }
+      return { ConfigParseStatus::Success, std::move(mechanism) };
+    }
+
+    std::pair<ConfigParseStatus, types::Mechanism> Deserialize(const std::vector<std::byte>& buffer)
+    {
+      return Deserialize(buffer.data(), buffer.size());
+    }
+  }  // namespace mechanism_configuration
+}  // namespace open_atmos
@@ -7,88 +7,95 @@ namespace open_atmos
 {
   namespace mechanism_configuration
   {
+    namespace
+    {
+      enum Field
+      {
+        Type,
+        GasPhase,
+        GasPhaseSpecies,
+        AerosolPhase,
+        AerosolPhaseSpecies,
+        B,
+        Name,
+        NumberOfFields
+      };
+
+      const ObjectSchema<types::SimpolPhaseTransfer, NumberOfFields>& Schema()
+      {
+        static const ObjectSchema<types::SimpolPhaseTransfer, NumberOfFields> schema{ { {
+            { validation::keys.type, FieldPresence::Required },
+            { validation::keys.gas_phase, FieldPresence::Required },
+            { validation::keys.gas_phase_species, FieldPresence::Required },
+            { validation::keys.aerosol_phase, FieldPresence::Required },
+            { validation::keys.aerosol_phase_species, FieldPresence::Required },
+            { validation::keys.B, FieldPresence::Required },
+            { validation::keys.name, FieldPresence::Optional, DecodeMember<&types::SimpolPhaseTransfer::name> } } } };
+        return schema;
+      }
+    }  // namespace
+
     ConfigParseStatus SimpolPhaseTransferParser::parse(
         const YAML::Node& object,
-        const std::vector<types::Species>& existing_species,
-        const std::vector<types::Phase>& existing_phases,
+        const MechanismIndex& index,
         open_atmos::types::Reactions& reactions)
     {
-      ConfigParseStatus status = ConfigParseStatus::Success;
       types::SimpolPhaseTransfer simpol_phase_transfer;
+      ObjectFields<NumberOfFields> fields;
 
-      status = ValidateSchema(object, validation::simpol_phase_transfer.required_keys, validation::simpol_phase_transfer.optional_keys);
+      ConfigParseStatus status = DecodeObject(object, Schema(), simpol_phase_transfer, fields);
       if (status == ConfigParseStatus::Success)
       {
-        std::string gas_phase_species = object[validation::keys.gas_phase_species].as<std::string>();
-        std::string aerosol_phase_species = object[validation::keys.aerosol_phase_species].as<std::string>();
+        types::SymbolId gas_phase_species = index.FindSpecies(fields[GasPhaseSpecies].as<std::string>());
+        types::SymbolId aerosol_phase_species = index.FindSpecies(fields[AerosolPhaseSpecies].as<std::string>());
 
-        if (object[validation::keys.name])
-        {
-          simpol_phase_transfer.name = object[validation::keys.name].as<std::string>();
-        }
-
-        std::vector<std::string> requested_species{ gas_phase_species, aerosol_phase_species };
-        if (status == ConfigParseStatus::Success && RequiresUnknownSpecies(requested_species, existing_species))
+        std::vector<types::SymbolId> requested_species{ gas_phase_species, aerosol_phase_species };
+        if (status == ConfigParseStatus::Success && index.RequiresUnknownSpecies(requested_species))
         {
           status = ConfigParseStatus::ReactionRequiresUnknownSpecies;
         }
 
-        std::string aerosol_phase = object[validation::keys.aerosol_phase].as<std::string>();
-        auto aerosol_it =
-            std::find_if(existing_phases.begin(), existing_phases.end(), [&aerosol_phase](const auto& phase) { return phase.name == aerosol_phase; });
-        if (status == ConfigParseStatus::Success && aerosol_it == existing_phases.end())
+        types::SymbolId aerosol_phase = index.FindPhase(fields[AerosolPhase].as<std::string>());
+        if (status == ConfigParseStatus::Success && aerosol_phase == types::unknown_symbol)
         {
           status = ConfigParseStatus::UnknownPhase;
         }
-        else
+        else if (aerosol_phase != types::unknown_symbol && !index.PhaseContains(aerosol_phase, aerosol_phase_species))
         {
-          auto phase = *aerosol_it;
-          auto spec_it = std::find_if(
-              phase.species.begin(),
-              phase.species.end(),
-              [&aerosol_phase_species](const std::string& species) { return species == aerosol_phase_species; });
-          if (spec_it == phase.species.end())
-          {
-            status = ConfigParseStatus::ReactionRequiresUnknownSpecies;
-          }
+          status = ConfigParseStatus::ReactionRequiresUnknownSpecies;
         }
 
-        std::string gas_phase = object[validation::keys.gas_phase].as<std::string>();
-        auto gas_it =
-            std::find_if(existing_phases.begin(), existing_phases.end(), [&gas_phase](const auto& phase) { return phase.name == gas_phase; });
-        if (status == ConfigParseStatus::Success && gas_it == existing_phases.end())
+        types::SymbolId gas_phase = index.FindPhase(fields[GasPhase].as<std::string>());
+        if (status == ConfigParseStatus::Success && gas_phase == types::unknown_symbol)
         {
           status = ConfigParseStatus::UnknownPhase;
         }
-        else
+        else if (gas_phase != types::unknown_symbol && !index.PhaseContains(gas_phase, gas_phase_species))
         {
-          auto phase = *gas_it;
-          auto spec_it = std::find_if(
-              phase.species.begin(), phase.species.end(), [&gas_phase_species](const std::string& species) { return species == gas_phase_species; });
-          if (spec_it == phase.species.end())
-          {
-            status = ConfigParseStatus::ReactionRequiresUnknownSpecies;
-          }
+          status = ConfigParseStatus::ReactionRequiresUnknownSpecies;
         }
 
-        if (object[validation::keys.B] && object[validation::keys.B].IsSequence() && object[validation::keys.B].size() == 4)
+        const YAML::Node& b = fields[B];
+        if (b.IsSequence() && b.size() == 4)
         {
           for (size_t i = 0; i < 4; ++i)
           {
-            simpol_phase_transfer.B[i] = object[validation::keys.B][i].as<double>();
+            ConfigParseStatus number_status = DecodeNumber(b[i], simpol_phase_transfer.B[i]);
+            if (status == ConfigParseStatus::Success)
+            {
+              status = number_status;
+            }
           }
         }
 
         simpol_phase_transfer.gas_phase = gas_phase;
         types::ReactionComponent gas_component;
-        gas_component.species_name = gas_phase_species;
+        gas_component.species_id = gas_phase_species;
         simpol_phase_transfer.gas_phase_species = gas_component;
         simpol_phase_transfer.aerosol_phase = aerosol_phase;
         types::ReactionComponent aerosol_component;
-        aerosol_component.species_name = aerosol_phase_species;
+        aerosol_component.species_id = aerosol_phase_species;
         simpol_phase_transfer.aerosol_phase_species = aerosol_component;
-        simpol_phase_transfer.unknown_properties =
-            GetComments(object, validation::simpol_phase_transfer.required_keys, validation::simpol_phase_transfer.optional_keys);
         reactions.simpol_phase_transfer.push_back(simpol_phase_transfer);
       }
 
@@ -0,0 +1,116 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <open_atmos/mechanism_configuration/sparse_matrix.hpp>
+
+namespace open_atmos
+{
+  namespace mechanism_configuration
+  {
+    namespace
+    {
+      /// @brief Transposes a pattern, and the values along with it when there are any. Walking the rows in order fills
+      ///        each transposed row in increasing column order, so no sort is needed.
+      SparsityPattern Transpose(const SparsityPattern& pattern, const std::vector<double>& values, std::vector<double>& transposed_values)
+      {
+        SparsityPattern transposed;
+        transposed.number_of_rows = pattern.number_of_columns;
+        transposed.number_of_columns = pattern.number_of_rows;
+        transposed.offsets.assign(pattern.number_of_columns + 1, 0);
+        for (std::uint32_t column : pattern.indices)
+        {
+          ++transposed.offsets[column + 1];
+        }
+        for (std::size_t column = 0; column < pattern.number_of_columns; ++column)
+        {
+          transposed.offsets[column + 1] += transposed.offsets[column];
+        }
+        transposed.indices.resize(pattern.indices.size());
+        transposed_values.resize(values.size());
+        std::vector<std::uint32_t> next(transposed.offsets.begin(), transposed.offsets.end() - 1);
+        for (std::size_t row = 0; row < pattern.number_of_rows; ++row)
+        {
+          for (std::size_t position = pattern.offsets[row]; position < pattern.offsets[row + 1]; ++position)
+          {
+            std::uint32_t target = next[pattern.indices[position]]++;
+            transposed.indices[target] = static_cast<std::uint32_t>(row);
+            if (!values.empty())
+            {
+              transposed_values[target] = values[position];
+            }
+          }
+        }
+        return transposed;
+      }
+    }  // namespace
+
+    std::size_t SparsityPattern::Find(std::size_t row, std::size_t column) const
+    {
+      auto begin = indices.begin() + offsets[row];
+      auto end = indices.begin() + offsets[row + 1];
+      auto found = std::lower_bound(begin, end, column);
+      if (found == end || *found != column)
+      {
+        return npos;
+      }
+      return static_cast<std::size_t>(found - indices.begin());
+    }
+
+    SparsityPattern SparsityPattern::Transpose() const
+    {
+      std::vector<double> no_values;
+      return mechanism_configuration::Transpose(*this, {}, no_values);
+    }
+
+    SparsityPattern PermuteSymmetric(const SparsityPattern& pattern, const std::vector<std::uint32_t>& order)
+    {
+      std::vector<std::uint32_t> position(order.size());
+      for (std::size_t i = 0; i < order.size(); ++i)
+      {
+        position[order[i]] = static_cast<std::uint32_t>(i);
+      }
+      SparsityPattern permuted;
+      permuted.number_of_rows = pattern.number_of_rows;
+      permuted.number_of_columns = pattern.number_of_columns;
+      permuted.offsets.reserve(pattern.number_of_rows + 1);
+      permuted.indices.reserve(pattern.indices.size());
+      for (std::uint32_t old_row : order)
+      {
+        std::size_t begin = permuted.indices.size();
+        for (std::uint32_t old_column : pattern.Columns(old_row))
+        {
+          permuted.indices.push_back(position[old_column]);
+        }
+        std::sort(permuted.indices.begin() + begin, permuted.indices.end());
+        permuted.offsets.push_back(static_cast<std::uint32_t>(permuted.indices.size()));
+      }
+      return permuted;
+    }
+
+    bool operator==(const SparsityPattern& left, const SparsityPattern& right)
+    {
+      return left.number_of_rows == right.number_of_rows && left.number_of_columns == right.number_of_columns &&
+             left.offsets == right.offsets && left.indices == right.indices;
+    }
+
+    bool operator!=(const SparsityPattern& left, const SparsityPattern& right)
+    {
+      return !(left == right);
+    }
+
+    double SparseMatrix::At(std::size_t row, std::size_t column) const
+    {
+      std::size_t position = pattern.Find(row, column);
+      return position == SparsityPattern::npos ? 0.0 : values[position];
+    }
+
+    SparseMatrix SparseMatrix::Transpose() const
+    {
+      SparseMatrix transposed;
+      transposed.pattern = mechanism_configuration::Transpose(pattern, values, transposed.values);
+      return transposed;
+    }
+  }  // namespace mechanism_configuration
+}  // namespace open_atmos
@@ -0,0 +1,88 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <open_atmos/mechanism_configuration/stoichiometry.hpp>
+#include <utility>
+
+namespace open_atmos
+{
+  namespace mechanism_configuration
+  {
+    namespace
+    {
+      using Entries = std::vector<std::pair<std::uint32_t, double>>;
+
+      void Collect(Entries& entries, const compiled::ComponentLists& lists, std::size_t reaction, double sign, std::size_t number_of_species)
+      {
+        Span<types::SymbolId> species = lists.Species(reaction);
+        Span<double> coefficients = lists.Coefficients(reaction);
+        for (std::size_t i = 0; i < species.size(); ++i)
+        {
+          if (species[i] < number_of_species)
+          {
+            entries.emplace_back(species[i], sign * coefficients[i]);
+          }
+        }
+      }
+
+      /// @brief Appends one column to the column-major matrix, combining repeated species and leaving out zeros
+      void AddColumn(SparseMatrix& by_column, Entries& entries)
+      {
+        std::sort(entries.begin(), entries.end(), [](const auto& left, const auto& right) { return left.first < right.first; });
+        for (std::size_t i = 0; i < entries.size();)
+        {
+          std::uint32_t species = entries[i].first;
+          double net = 0.0;
+          for (; i < entries.size() && entries[i].first == species; ++i)
+          {
+            net += entries[i].second;
+          }
+          if (net != 0.0)
+          {
+            by_column.pattern.indices.push_back(species);
+            by_column.values.push_back(net);
+          }
+        }
+        by_column.pattern.offsets.push_back(static_cast<std::uint32_t>(by_column.pattern.indices.size()));
+        ++by_column.pattern.number_of_rows;
+        entries.clear();
+      }
+    }  // namespace
+
+    StoichiometryMatrix BuildStoichiometry(const CompiledMechanism& compiled)
+    {
+      StoichiometryMatrix stoichiometry;
+      SparseMatrix& by_column = stoichiometry.by_column;
+      by_column.pattern.number_of_columns = compiled.number_of_species;
+      stoichiometry.reaction_columns.reserve(compiled.number_of_reactions + 1);
+
+      Entries entries;
+      for (std::size_t reaction = 0; reaction < compiled.number_of_reactions; ++reaction)
+      {
+        stoichiometry.reaction_columns.push_back(static_cast<std::uint32_t>(by_column.pattern.number_of_rows));
+        Collect(entries, compiled.reactants, reaction, -1.0, compiled.number_of_species);
+        Collect(entries, compiled.products, reaction, 1.0, compiled.number_of_species);
+        AddColumn(by_column, entries);
+        stoichiometry.column_reactions.push_back(static_cast<std::uint32_t>(reaction));
+        if (compiled.types[reaction] == types::ReactionType::Branched)
+        {
+          Collect(entries, compiled.reactants, reaction, -1.0, compiled.number_of_species);
+          Collect(entries, compiled.alternative_products, reaction, 1.0, compiled.number_of_species);
+          AddColumn(by_column, entries);
+          stoichiometry.column_reactions.push_back(static_cast<std::uint32_t>(reaction));
+        }
+      }
+      stoichiometry.reaction_columns.push_back(static_cast<std::uint32_t>(by_column.pattern.number_of_rows));
+
+      stoichiometry.by_species = by_column.Transpose();
+      return stoichiometry;
+    }
+
+    StoichiometryMatrix BuildStoichiometry(const types::Mechanism& mechanism)
+    {
+      return BuildStoichiometry(Compile(mechanism));
+    }
+  }  // namespace mechanism_configuration
+}  // namespace open_atmos
@@ -7,59 +7,73 @@ namespace open_atmos
 {
   namespace mechanism_configuration
   {
+    namespace
+    {
+      enum Field
+      {
+        GasPhaseProducts,
+        GasPhaseSpecies,
+        Type,
+        GasPhase,
+        AerosolPhase,
+        Name,
+        ReactionProbability,
+        NumberOfFields
+      };
+
+      const ObjectSchema<types::Surface, NumberOfFields>& Schema()
+      {
+        static const ObjectSchema<types::Surface, NumberOfFields> schema{ { {
+            { validation::keys.gas_phase_products, FieldPresence::Required },
+            { validation::keys.gas_phase_species, FieldPresence::Required },
+            { validation::keys.type, FieldPresence::Required },
+            { validation::keys.gas_phase, FieldPresence::Required },
+            { validation::keys.aerosol_phase, FieldPresence::Required },
+            { validation::keys.name, FieldPresence::Optional, DecodeMember<&types::Surface::name> },
+            { validation::keys.reaction_probability, FieldPresence::Optional, DecodeMember<&types::Surface::reaction_probability> } } } };
+        return schema;
+      }
+    }  // namespace
+
     ConfigParseStatus SurfaceParser::parse(
         const YAML::Node& object,
-        const std::vector<types::Species>& existing_species,
-        const std::vector<types::Phase>& existing_phases,
+        const MechanismIndex& index,
         open_atmos::types::Reactions& reactions)
     {
-      ConfigParseStatus status = ConfigParseStatus::Success;
       types::Surface surface;
+      ObjectFields<NumberOfFields> fields;
 
-      status = ValidateSchema(object, validation::surface.required_keys, validation::surface.optional_keys);
+      ConfigParseStatus status = DecodeObject(object, Schema(), surface, fields);
       if (status == ConfigParseStatus::Success)
       {
-        std::string gas_phase_species = object[validation::keys.gas_phase_species].as<std::string>();
+        types::SymbolId gas_phase_species = index.FindSpecies(fields[GasPhaseSpecies].as<std::string>());
 
-        auto products = ParseReactantsOrProducts(validation::keys.gas_phase_products, object, status);
-
-        if (object[validation::keys.reaction_probability])
-        {
-          surface.reaction_probability = object[validation::keys.reaction_probability].as<double>();
-        }
-
-        if (object[validation::keys.name])
-        {
-          surface.name = object[validation::keys.name].as<std::string>();
-        }
+        auto products = ParseReactantsOrProducts(fields[GasPhaseProducts], index, status);
 
-        std::vector<std::string> requested_species;
+        std::vector<types::SymbolId> requested_species;
         for (const auto& spec : products)
         {
-          requested_species.push_back(spec.species_name);
+          requested_species.push_back(spec.species_id);
         }
         requested_species.push_back(gas_phase_species);
 
-        if (status == ConfigParseStatus::Success && RequiresUnknownSpecies(requested_species, existing_species))
+        if (status == ConfigParseStatus::Success && index.RequiresUnknownSpecies(requested_species))
         {
           status = ConfigParseStatus::ReactionRequiresUnknownSpecies;
         }
 
-        std::string aerosol_phase = object[validation::keys.aerosol_phase].as<std::string>();
-        auto it =
-            std::find_if(existing_phases.begin(), existing_phases.end(), [&aerosol_phase](const auto& phase) { return phase.name == aerosol_phase; });
-        if (status == ConfigParseStatus::Success && it == existing_phases.end())
+        types::SymbolId aerosol_phase = index.FindPhase(fields[AerosolPhase].as<std::string>());
+        if (status == ConfigParseStatus::Success && aerosol_phase == types::unknown_symbol)
         {
           status = ConfigParseStatus::UnknownPhase;
         }
 
-        surface.gas_phase = object[validation::keys.gas_phase].as<std::string>();
+        surface.gas_phase = index.FindPhase(fields[GasPhase].as<std::string>());
         surface.aerosol_phase = aerosol_phase;
         surface.gas_phase_products = products;
         types::ReactionComponent component;
-        component.species_name = gas_phase_species;
+        component.species_id = gas_phase_species;
         surface.gas_phase_species = component;
-        surface.unknown_properties = GetComments(object, validation::surface.required_keys, validation::surface.optional_keys);
         reactions.surface.push_back(surface);
       }
 
@@ -0,0 +1,66 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <open_atmos/symbol_table.hpp>
+
+namespace open_atmos
+{
+  namespace types
+  {
+    SymbolTable::SymbolTable(const SymbolTable& other)
+    {
+      *this = other;
+    }
+
+    SymbolTable& SymbolTable::operator=(const SymbolTable& other)
+    {
+      if (this == &other)
+      {
+        return *this;
+      }
+      // the lookup views the names it indexes, so it is rebuilt over the copies rather than copied
+      names_.clear();
+      ids_.clear();
+      ids_.reserve(other.names_.size());
+      for (const auto& name : other.names_)
+      {
+        Intern(name);
+      }
+      return *this;
+    }
+
+    SymbolId SymbolTable::Intern(std::string_view name)
+    {
+      auto it = ids_.find(name);
+      if (it != ids_.end())
+      {
+        return it->second;
+      }
+      SymbolId id = static_cast<SymbolId>(names_.size());
+      const std::string& stored = names_.emplace_back(name);
+      ids_.emplace(stored, id);
+      return id;
+    }
+
+    SymbolId SymbolTable::Find(std::string_view name) const
+    {
+      auto it = ids_.find(name);
+      if (it == ids_.end())
+      {
+        return unknown_symbol;
+      }
+      return it->second;
+    }
+
+    const std::string& SymbolTable::Name(SymbolId id) const
+    {
+      return names_.at(id);
+    }
+
+    std::size_t SymbolTable::Size() const
+    {
+      return names_.size();
+    }
+  }  // namespace types
+}  // namespace open_atmos
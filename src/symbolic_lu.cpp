@@ -0,0 +1,148 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <open_atmos/mechanism_configuration/jacobian.hpp>
+#include <open_atmos/mechanism_configuration/symbolic_lu.hpp>
+
+namespace open_atmos
+{
+  namespace mechanism_configuration
+  {
+    SymbolicLU BuildSymbolicLU(const SparsityPattern& pattern)
+    {
+      const std::size_t size = pattern.number_of_rows;
+      SymbolicLU lu;
+      lu.pattern.number_of_rows = size;
+      lu.pattern.number_of_columns = size;
+      lu.diagonal.reserve(size);
+
+      // Row i of L + U is row i of the matrix joined with the upper part of every row k < i that it has an entry in,
+      // including entries that are themselves fill-in. Earlier rows are complete by then, so one pass over k suffices.
+      std::vector<bool> present(size, false);
+      std::vector<std::uint32_t> columns;
+      for (std::size_t row = 0; row < size; ++row)
+      {
+        columns.assign(pattern.Columns(row).begin(), pattern.Columns(row).end());
+        columns.push_back(static_cast<std::uint32_t>(row));
+        for (std::uint32_t column : columns)
+        {
+          present[column] = true;
+        }
+        for (std::size_t pivot = 0; pivot < row; ++pivot)
+        {
+          if (!present[pivot])
+          {
+            continue;
+          }
+          for (std::size_t position = lu.diagonal[pivot] + 1; position < lu.pattern.offsets[pivot + 1]; ++position)
+          {
+            std::uint32_t column = lu.pattern.indices[position];
+            if (!present[column])
+            {
+              present[column] = true;
+              columns.push_back(column);
+            }
+          }
+        }
+        std::sort(columns.begin(), columns.end());
+        columns.erase(std::unique(columns.begin(), columns.end()), columns.end());
+        for (std::uint32_t column : columns)
+        {
+          present[column] = false;
+          if (column == row)
+          {
+            lu.diagonal.push_back(static_cast<std::uint32_t>(lu.pattern.indices.size()));
+          }
+          lu.pattern.indices.push_back(column);
+        }
+        lu.pattern.offsets.push_back(static_cast<std::uint32_t>(lu.pattern.indices.size()));
+      }
+
+      // the elimination steps, with the positions of the current row looked up through a dense map
+      std::vector<std::uint32_t> position_of(size);
+      for (std::size_t row = 0; row < size; ++row)
+      {
+        for (std::uint32_t position = lu.pattern.offsets[row]; position < lu.pattern.offsets[row + 1]; ++position)
+        {
+          position_of[lu.pattern.indices[position]] = position;
+        }
+        for (std::uint32_t position = lu.pattern.offsets[row]; position < lu.diagonal[row]; ++position)
+        {
+          std::uint32_t pivot = lu.pattern.indices[position];
+          lu.lower.push_back(position);
+          lu.lower_pivots.push_back(pivot);
+          for (std::uint32_t source = lu.diagonal[pivot] + 1; source < lu.pattern.offsets[pivot + 1]; ++source)
+          {
+            lu.update_targets.push_back(position_of[lu.pattern.indices[source]]);
+            lu.update_sources.push_back(source);
+          }
+          lu.update_offsets.push_back(static_cast<std::uint32_t>(lu.update_targets.size()));
+        }
+        for (std::uint32_t column : pattern.Columns(row))
+        {
+          lu.matrix_positions.push_back(position_of[column]);
+        }
+      }
+      return lu;
+    }
+
+    MechanismLU BuildSymbolicLU(const types::Mechanism& mechanism, SpeciesOrdering ordering)
+    {
+      JacobianPattern jacobian = BuildJacobianPattern(mechanism);
+      std::vector<std::uint32_t> order = ComputeOrdering(jacobian.pattern, ordering);
+
+      MechanismLU result;
+      result.lu = BuildSymbolicLU(PermuteSymmetric(jacobian.pattern, order));
+      result.species_order.reserve(order.size());
+      for (std::uint32_t position : order)
+      {
+        result.species_order.push_back(jacobian.species_order[position]);
+      }
+      return result;
+    }
+
+    std::vector<double> ScatterToLU(const SymbolicLU& lu, const std::vector<double>& matrix_values)
+    {
+      std::vector<double> values(lu.pattern.Size(), 0.0);
+      for (std::size_t i = 0; i < lu.matrix_positions.size(); ++i)
+      {
+        values[lu.matrix_positions[i]] = matrix_values[i];
+      }
+      return values;
+    }
+
+    void Factorize(const SymbolicLU& lu, std::vector<double>& values)
+    {
+      for (std::size_t l = 0; l < lu.lower.size(); ++l)
+      {
+        const double multiplier = values[lu.lower[l]] /= values[lu.diagonal[lu.lower_pivots[l]]];
+        for (std::uint32_t update = lu.update_offsets[l]; update < lu.update_offsets[l + 1]; ++update)
+        {
+          values[lu.update_targets[update]] -= multiplier * values[lu.update_sources[update]];
+        }
+      }
+    }
+
+    void Solve(const SymbolicLU& lu, const std::vector<double>& values, std::vector<double>& b)
+    {
+      const SparsityPattern& pattern = lu.pattern;
+      for (std::size_t row = 0; row < pattern.number_of_rows; ++row)
+      {
+        for (std::uint32_t position = pattern.offsets[row]; position < lu.diagonal[row]; ++position)
+        {
+          b[row] -= values[position] * b[pattern.indices[position]];
+        }
+      }
+      for (std::size_t row = pattern.number_of_rows; row-- > 0;)
+      {
+        for (std::uint32_t position = lu.diagonal[row] + 1; position < pattern.offsets[row + 1]; ++position)
+        {
+          b[row] -= values[position] * b[pattern.indices[position]];
+        }
+        b[row] /= values[lu.diagonal[row]];
+      }
+    }
+  }  // namespace mechanism_configuration
+}  // namespace open_atmos
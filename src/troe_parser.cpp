@@ -7,77 +7,77 @@ namespace open_atmos
 {
   namespace mechanism_configuration
   {
+    namespace
+    {
+      enum Field
+      {
+        Products,
+        Reactants,
+        Type,
+        GasPhase,
+        Name,
+        K0A,
+        K0B,
+        K0C,
+        KinfA,
+        KinfB,
+        KinfC,
+        Fc,
+        N,
+        NumberOfFields
+      };
+
+      const ObjectSchema<types::Troe, NumberOfFields>& Schema()
+      {
+        static const ObjectSchema<types::Troe, NumberOfFields> schema{ { {
+            { validation::keys.products, FieldPresence::Required },
+            { validation::keys.reactants, FieldPresence::Required },
+            { validation::keys.type, FieldPresence::Required },
+            { validation::keys.gas_phase, FieldPresence::Required },
+            { validation::keys.name, FieldPresence::Optional, DecodeMember<&types::Troe::name> },
+            { validation::keys.k0_A, FieldPresence::Optional, DecodeMember<&types::Troe::k0_A> },
+            { validation::keys.k0_B, FieldPresence::Optional, DecodeMember<&types::Troe::k0_B> },
+            { validation::keys.k0_C, FieldPresence::Optional, DecodeMember<&types::Troe::k0_C> },
+            { validation::keys.kinf_A, FieldPresence::Optional, DecodeMember<&types::Troe::kinf_A> },
+            { validation::keys.kinf_B, FieldPresence::Optional, DecodeMember<&types::Troe::kinf_B> },
+            { validation::keys.kinf_C, FieldPresence::Optional, DecodeMember<&types::Troe::kinf_C> },
+            { validation::keys.Fc, FieldPresence::Optional, DecodeMember<&types::Troe::Fc> },
+            { validation::keys.N, FieldPresence::Optional, DecodeMember<&types::Troe::N> } } } };
+        return schema;
+      }
+    }  // namespace
+
     ConfigParseStatus TroeParser::parse(
         const YAML::Node& object,
-        const std::vector<types::Species>& existing_species,
-        const std::vector<types::Phase>& existing_phases,
+        const MechanismIndex& index,
         open_atmos::types::Reactions& reactions)
     {
-      ConfigParseStatus status = ConfigParseStatus::Success;
       types::Troe troe;
+      ObjectFields<NumberOfFields> fields;
 
-      status = ValidateSchema(object, validation::troe.required_keys, validation::troe.optional_keys);
+      ConfigParseStatus status = DecodeObject(object, Schema(), troe, fields);
       if (status == ConfigParseStatus::Success)
       {
-        auto products = ParseReactantsOrProducts(validation::keys.products, object, status);
-        auto reactants = ParseReactantsOrProducts(validation::keys.reactants, object, status);
-
-        if (object[validation::keys.k0_A])
-        {
-          troe.k0_A = object[validation::keys.k0_A].as<double>();
-        }
-        if (object[validation::keys.k0_B])
-        {
-          troe.k0_B = object[validation::keys.k0_B].as<double>();
-        }
-        if (object[validation::keys.k0_C])
-        {
-          troe.k0_C = object[validation::keys.k0_C].as<double>();
-        }
-        if (object[validation::keys.kinf_A])
-        {
-          troe.kinf_A = object[validation::keys.kinf_A].as<double>();
-        }
-        if (object[validation::keys.kinf_B])
-        {
-          troe.kinf_B = object[validation::keys.kinf_B].as<double>();
-        }
-        if (object[validation::keys.kinf_C])
-        {
-          troe.kinf_C = object[validation::keys.kinf_C].as<double>();
-        }
-        if (object[validation::keys.Fc])
-        {
-          troe.Fc = object[validation::keys.Fc].as<double>();
-        }
-        if (object[validation::keys.N])
-        {
-          troe.N = object[validation::keys.N].as<double>();
-        }
-
-        if (object[validation::keys.name])
-        {
-          troe.name = object[validation::keys.name].as<std::string>();
-        }
+        auto products = ParseReactantsOrProducts(fields[Products], index, status);
+        auto reactants = ParseReactantsOrProducts(fields[Reactants], index, status);
 
-        std::vector<std::string> requested_species;
+        std::vector<types::SymbolId> requested_species;
         for (const auto& spec : products)
         {
-          requested_species.push_back(spec.species_name);
+          requested_species.push_back(spec.species_id);
         }
         for (const auto& spec : reactants)
         {
-          requested_species.push_back(spec.species_name);
+          requested_species.push_back(spec.species_id);
         }
 
-        if (status == ConfigParseStatus::Success && RequiresUnknownSpecies(requested_species, existing_species))
+        if (status == ConfigParseStatus::Success && index.RequiresUnknownSpecies(requested_species))
         {
           status = ConfigParseStatus::ReactionRequiresUnknownSpecies;
         }
 
-        std::string gas_phase = object[validation::keys.gas_phase].as<std::string>();
-        auto it = std::find_if(existing_phases.begin(), existing_phases.end(), [&gas_phase](const auto& phase) { return phase.name == gas_phase; });
-        if (status == ConfigParseStatus::Success && it == existing_phases.end())
+        types::SymbolId gas_phase = index.FindPhase(fields[GasPhase].as<std::string>());
+        if (status == ConfigParseStatus::Success && gas_phase == types::unknown_symbol)
         {
           status = ConfigParseStatus::UnknownPhase;
         }
@@ -85,7 +85,6 @@ namespace open_atmos
         troe.gas_phase = gas_phase;
         troe.products = products;
         troe.reactants = reactants;
-        troe.unknown_properties = GetComments(object, validation::troe.required_keys, validation::troe.optional_keys);
         reactions.troe.push_back(troe);
       }
 
@@ -7,57 +7,67 @@ namespace open_atmos
 {
   namespace mechanism_configuration
   {
+    namespace
+    {
+      enum Field
+      {
+        Products,
+        Reactants,
+        Type,
+        GasPhase,
+        Name,
+        A,
+        B,
+        C,
+        NumberOfFields
+      };
+
+      const ObjectSchema<types::Tunneling, NumberOfFields>& Schema()
+      {
+        static const ObjectSchema<types::Tunneling, NumberOfFields> schema{ { {
+            { validation::keys.products, FieldPresence::Required },
+            { validation::keys.reactants, FieldPresence::Required },
+            { validation::keys.type, FieldPresence::Required },
+            { validation::keys.gas_phase, FieldPresence::Required },
+            { validation::keys.name, FieldPresence::Optional, DecodeMember<&types::Tunneling::name> },
+            { validation::keys.A, FieldPresence::Optional, DecodeMember<&types::Tunneling::A> },
+            { validation::keys.B, FieldPresence::Optional, DecodeMember<&types::Tunneling::B> },
+            { validation::keys.C, FieldPresence::Optional, DecodeMember<&types::Tunneling::C> } } } };
+        return schema;
+      }
+    }  // namespace
+
     ConfigParseStatus TunnelingParser::parse(
         const YAML::Node& object,
-        const std::vector<types::Species>& existing_species,
-        const std::vector<types::Phase>& existing_phases,
+        const MechanismIndex& index,
         open_atmos::types::Reactions& reactions)
     {
-      ConfigParseStatus status = ConfigParseStatus::Success;
       types::Tunneling tunneling;
+      ObjectFields<NumberOfFields> fields;
 
-      status = ValidateSchema(object, validation::tunneling.required_keys, validation::tunneling.optional_keys);
+      ConfigParseStatus status = DecodeObject(object, Schema(), tunneling, fields);
       if (status == ConfigParseStatus::Success)
       {
-        auto products = ParseReactantsOrProducts(validation::keys.products, object, status);
-        auto reactants = ParseReactantsOrProducts(validation::keys.reactants, object, status);
-
-        if (object[validation::keys.A])
-        {
-          tunneling.A = object[validation::keys.A].as<double>();
-        }
-        if (object[validation::keys.B])
-        {
-          tunneling.B = object[validation::keys.B].as<double>();
-        }
-        if (object[validation::keys.C])
-        {
-          tunneling.C = object[validation::keys.C].as<double>();
-        }
-
-        if (object[validation::keys.name])
-        {
-          tunneling.name = object[validation::keys.name].as<std::string>();
-        }
+        auto products = ParseReactantsOrProducts(fields[Products], index, status);
+        auto reactants = ParseReactantsOrProducts(fields[Reactants], index, status);
 
-        std::vector<std::string> requested_species;
+        std::vector<types::SymbolId> requested_species;
         for (const auto& spec : products)
         {
-          requested_species.push_back(spec.species_name);
+          requested_species.push_back(spec.species_id);
         }
         for (const auto& spec : reactants)
         {
-          requested_species.push_back(spec.species_name);
+          requested_species.push_back(spec.species_id);
         }
 
-        if (status == ConfigParseStatus::Success && RequiresUnknownSpecies(requested_species, existing_species))
+        if (status == ConfigParseStatus::Success && index.RequiresUnknownSpecies(requested_species))
         {
           status = ConfigParseStatus::ReactionRequiresUnknownSpecies;
         }
 
-        std::string gas_phase = object[validation::keys.gas_phase].as<std::string>();
-        auto it = std::find_if(existing_phases.begin(), existing_phases.end(), [&gas_phase](const auto& phase) { return phase.name == gas_phase; });
-        if (status == ConfigParseStatus::Success && it == existing_phases.end())
+        types::SymbolId gas_phase = index.FindPhase(fields[GasPhase].as<std::string>());
+        if (status == ConfigParseStatus::Success && gas_phase == types::unknown_symbol)
         {
           status = ConfigParseStatus::UnknownPhase;
         }
@@ -65,7 +75,6 @@ namespace open_atmos
         tunneling.gas_phase = gas_phase;
         tunneling.products = products;
         tunneling.reactants = reactants;
-        tunneling.unknown_properties = GetComments(object, validation::tunneling.required_keys, validation::tunneling.optional_keys);
         reactions.tunneling.push_back(tunneling);
       }
 
@@ -15,10 +15,7 @@ namespace open_atmos
         std::string key_str = key.first.as<std::string>();
         if (key_str.compare(0, comment_start.size(), comment_start) == 0)
         {
-          YAML::Emitter emitter;
-          emitter << YAML::DoubleQuoted << YAML::Flow  // json style output
-                  << key.second;
-          unknown_properties[key_str] = emitter.c_str();
+          unknown_properties[key_str] = FormatUnknownProperty(key.second);
         }
       }
       return unknown_properties;
@@ -83,6 +80,51 @@ namespace open_atmos
       return ConfigParseStatus::Success;
     }
 
+    void ReportDuplicates(const std::string& object_type, const std::vector<DuplicateName>& duplicates)
+    {
+      for (const auto& duplicate : duplicates)
+      {
+        std::cerr << "Duplicate " << object_type << " name '" << duplicate.name << "' found at positions";
+        for (std::size_t i = 0; i < duplicate.positions.size(); ++i)
+        {
+          std::cerr << (i == 0 ? " " : ", ") << duplicate.positions[i];
+        }
+        std::cerr << std::endl;
+      }
+    }
+
+    std::pair<ConfigParseStatus, types::Species> ParseSpeciesObject(const YAML::Node& object)
+    {
+      types::Species species;
+      ConfigParseStatus status = ValidateSchema(object, validation::species.required_keys, validation::species.optional_keys);
+      if (status != ConfigParseStatus::Success)
+      {
+        return { status, species };
+      }
+
+      std::string name = object[validation::keys.name].as<std::string>();
+
+      std::map<std::string, double> numerical_properties{};
+      for (const auto& key : validation::species.optional_keys)
+      {
+        if (object[key])
+        {
+          double val = 0;
+          if (DecodeNumber(object[key], val) != ConfigParseStatus::Success)
+          {
+            status = ConfigParseStatus::InvalidNumericValue;
+          }
+          numerical_properties[key] = val;
+        }
+      }
+
+      species.name = name;
+      species.optional_numerical_properties = numerical_properties;
+      species.unknown_properties = GetComments(object, validation::species.required_keys, validation::species.optional_keys);
+
+      return { status, species };
+    }
+
     std::pair<ConfigParseStatus, std::vector<types::Species>> ParseSpecies(const YAML::Node& objects)
     {
       ConfigParseStatus status = ConfigParseStatus::Success;
@@ -90,109 +132,130 @@ namespace open_atmos
 
       for (const auto& object : objects)
       {
-        types::Species species;
-        status = ValidateSchema(object, validation::species.required_keys, validation::species.optional_keys);
+        auto species_parse = ParseSpeciesObject(object);
+        status = species_parse.first;
         if (status != ConfigParseStatus::Success)
         {
           break;
         }
 
-        std::string name = object[validation::keys.name].as<std::string>();
+        all_species.push_back(species_parse.second);
+      }
 
-        std::map<std::string, double> numerical_properties{};
-        for (const auto& key : validation::species.optional_keys)
-        {
-          if (object[key])
-          {
-            double val = object[key].as<double>();
-            numerical_properties[key] = val;
-          }
-        }
+      auto duplicates = FindDuplicateObjectsByName(all_species);
+      if (!duplicates.empty())
+      {
+        ReportDuplicates("species", duplicates);
+        status = ConfigParseStatus::DuplicateSpeciesDetected;
+      }
 
-        species.name = name;
-        species.optional_numerical_properties = numerical_properties;
-        species.unknown_properties = GetComments(object, validation::species.required_keys, validation::species.optional_keys);
+      return { status, all_species };
+    }
 
-        all_species.push_back(species);
+    std::pair<ConfigParseStatus, types::Phase> ParsePhaseObject(const YAML::Node& object, const MechanismIndex& index)
+    {
+      types::Phase phase;
+      ConfigParseStatus status = ValidateSchema(object, validation::phase.required_keys, validation::phase.optional_keys);
+      if (status != ConfigParseStatus::Success)
+      {
+        return { status, phase };
       }
 
-      if (!ContainsUniqueObjectsByName<types::Species>(all_species))
-        status = ConfigParseStatus::DuplicateSpeciesDetected;
+      std::string name = object[validation::keys.name].as<std::string>();
 
-      return { status, all_species };
+      std::vector<std::string> species{};
+      for (const auto& spec : object[validation::keys.species])
+      {
+        species.push_back(spec.as<std::string>());
+      }
+
+      phase.name = name;
+      phase.species = species;
+      phase.unknown_properties = GetComments(object, validation::phase.required_keys, validation::phase.optional_keys);
+
+      std::vector<types::SymbolId> species_ids;
+      for (const auto& spec : species)
+      {
+        species_ids.push_back(index.FindSpecies(spec));
+      }
+
+      if (index.RequiresUnknownSpecies(species_ids))
+      {
+        status = ConfigParseStatus::PhaseRequiresUnknownSpecies;
+      }
+
+      return { status, phase };
     }
 
-    std::pair<ConfigParseStatus, std::vector<types::Phase>> ParsePhases(const YAML::Node& objects, const std::vector<types::Species> existing_species)
+    std::pair<ConfigParseStatus, std::vector<types::Phase>> ParsePhases(const YAML::Node& objects, const MechanismIndex& index)
     {
       ConfigParseStatus status = ConfigParseStatus::Success;
       std::vector<types::Phase> all_phases;
 
       for (const auto& object : objects)
       {
-        types::Phase phase;
-        status = ValidateSchema(object, validation::phase.required_keys, validation::phase.optional_keys);
+        auto phase_parse = ParsePhaseObject(object, index);
+        status = phase_parse.first;
         if (status != ConfigParseStatus::Success)
         {
           break;
         }
 
-        std::string name = object[validation::keys.name].as<std::string>();
-
-        std::vector<std::string> species{};
-        for (const auto& spec : object[validation::keys.species])
-        {
-          species.push_back(spec.as<std::string>());
-        }
-
-        phase.name = name;
-        phase.species = species;
-        phase.unknown_properties = GetComments(object, validation::phase.required_keys, validation::phase.optional_keys);
+        all_phases.push_back(phase_parse.second);
+      }
 
-        if (RequiresUnknownSpecies(species, existing_species))
+      if (status == ConfigParseStatus::Success)
+      {
+        auto duplicates = FindDuplicateObjectsByName(all_phases);
+        if (!duplicates.empty())
         {
-          status = ConfigParseStatus::PhaseRequiresUnknownSpecies;
-          break;
+          ReportDuplicates("phase", duplicates);
+          status = ConfigParseStatus::DuplicatePhasesDetected;
         }
-
-        all_phases.push_back(phase);
       }
 
-      if (status == ConfigParseStatus::Success && !ContainsUniqueObjectsByName<types::Phase>(all_phases))
-        status = ConfigParseStatus::DuplicatePhasesDetected;
-
       return { status, all_phases };
     }
 
-    std::pair<ConfigParseStatus, types::ReactionComponent> ParseReactionComponent(const YAML::Node& object)
+    namespace
+    {
+      enum ReactionComponentField
+      {
+        SpeciesName,
+        Coefficient,
+        NumberOfReactionComponentFields
+      };
+
+      const ObjectSchema<types::ReactionComponent, NumberOfReactionComponentFields>& ReactionComponentSchema()
+      {
+        static const ObjectSchema<types::ReactionComponent, NumberOfReactionComponentFields> schema{ { {
+            { validation::keys.species_name, FieldPresence::Required },
+            { validation::keys.coefficient, FieldPresence::Optional, DecodeMember<&types::ReactionComponent::coefficient> } } } };
+        return schema;
+      }
+    }  // namespace
+
+    std::pair<ConfigParseStatus, types::ReactionComponent> ParseReactionComponent(const YAML::Node& object, const MechanismIndex& index)
     {
-      ConfigParseStatus status = ConfigParseStatus::Success;
       types::ReactionComponent component;
+      ObjectFields<NumberOfReactionComponentFields> fields;
 
-      status = ValidateSchema(object, validation::reaction_component.required_keys, validation::reaction_component.optional_keys);
+      ConfigParseStatus status = DecodeObject(object, ReactionComponentSchema(), component, fields);
       if (status == ConfigParseStatus::Success)
       {
-        std::string species_name = object[validation::keys.species_name].as<std::string>();
-        double coefficient = 1;
-        if (object[validation::keys.coefficient])
-        {
-          coefficient = object[validation::keys.coefficient].as<double>();
-        }
-
-        component.species_name = species_name;
-        component.coefficient = coefficient;
-        component.unknown_properties =
-            GetComments(object, validation::reaction_component.required_keys, validation::reaction_component.optional_keys);
+        component.species_id = index.FindSpecies(fields[SpeciesName].Scalar());
       }
 
       return { status, component };
     }
 
-    std::vector<types::ReactionComponent> ParseReactantsOrProducts(const std::string& key, const YAML::Node& object, ConfigParseStatus& status)
+    std::vector<types::ReactionComponent> ParseReactantsOrProducts(const YAML::Node& objects, const MechanismIndex& index, ConfigParseStatus& status)
     {
       std::vector<types::ReactionComponent> result{};
-      for (const auto& product : object[key])
+      result.reserve(objects.size());
+      for (const auto& object : objects)
       {
-        auto component_parse = ParseReactionComponent(product);
+        auto component_parse = ParseReactionComponent(object, index);
         status = component_parse.first;
         if (status != ConfigParseStatus::Success)
         {
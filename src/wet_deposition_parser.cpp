@@ -7,39 +7,47 @@ namespace open_atmos
 {
   namespace mechanism_configuration
   {
+    namespace
+    {
+      enum Field
+      {
+        AerosolPhase,
+        Type,
+        Name,
+        ScalingFactor,
+        NumberOfFields
+      };
+
+      const ObjectSchema<types::WetDeposition, NumberOfFields>& Schema()
+      {
+        static const ObjectSchema<types::WetDeposition, NumberOfFields> schema{ { {
+            { validation::keys.aerosol_phase, FieldPresence::Required },
+            { validation::keys.type, FieldPresence::Required },
+            { validation::keys.name, FieldPresence::Optional, DecodeMember<&types::WetDeposition::name> },
+            { validation::keys.scaling_factor, FieldPresence::Optional, DecodeMember<&types::WetDeposition::scaling_factor> } } } };
+        return schema;
+      }
+    }  // namespace
+
     ConfigParseStatus WetDepositionParser::parse(
         const YAML::Node& object,
-        const std::vector<types::Species>& existing_species,
-        const std::vector<types::Phase>& existing_phases,
+        const MechanismIndex& index,
         open_atmos::types::Reactions& reactions)
     {
-      ConfigParseStatus status = ConfigParseStatus::Success;
       types::WetDeposition wet_deposition;
+      ObjectFields<NumberOfFields> fields;
 
-      status = ValidateSchema(object, validation::wet_deposition.required_keys, validation::wet_deposition.optional_keys);
+      ConfigParseStatus status = DecodeObject(object, Schema(), wet_deposition, fields);
       if (status == ConfigParseStatus::Success)
       {
-        if (object[validation::keys.scaling_factor])
-        {
-          wet_deposition.scaling_factor = object[validation::keys.scaling_factor].as<double>();
-        }
-
-        if (object[validation::keys.name])
-        {
-          wet_deposition.name = object[validation::keys.name].as<std::string>();
-        }
-
-        std::string aerosol_phase = object[validation::keys.aerosol_phase].as<std::string>();
+        types::SymbolId aerosol_phase = index.FindPhase(fields[AerosolPhase].as<std::string>());
 
-        auto it =
-            std::find_if(existing_phases.begin(), existing_phases.end(), [&aerosol_phase](const auto& phase) { return phase.name == aerosol_phase; });
-        if (status == ConfigParseStatus::Success && it == existing_phases.end())
+        if (status == ConfigParseStatus::Success && aerosol_phase == types::unknown_symbol)
         {
           status = ConfigParseStatus::UnknownPhase;
         }
 
         wet_deposition.aerosol_phase = aerosol_phase;
-        wet_deposition.unknown_properties = GetComments(object, validation::wet_deposition.required_keys, validation::wet_deposition.optional_keys);
         reactions.wet_deposition.push_back(wet_deposition);
       }
 
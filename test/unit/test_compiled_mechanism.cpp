@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+
+#include <open_atmos/mechanism_configuration/compiled_mechanism.hpp>
+#include <open_atmos/mechanism_configuration/parser.hpp>
+
+using namespace open_atmos::mechanism_configuration;
+using namespace open_atmos;
+
+namespace
+{
+  void ExpectComponents(const compiled::ComponentLists& lists, std::size_t reaction, const std::vector<types::ReactionComponent>& expected)
+  {
+    ASSERT_EQ(lists.Species(reaction).size(), expected.size());
+    for (std::size_t i = 0; i < expected.size(); ++i)
+    {
+      EXPECT_EQ(lists.Species(reaction)[i], expected[i].species_id);
+      EXPECT_EQ(lists.Coefficients(reaction)[i], expected[i].coefficient);
+    }
+  }
+
+  types::Mechanism ParseFullConfiguration()
+  {
+    Parser parser;
+    auto [status, mechanism] = parser.Parse(std::string("examples/full_configuration.json"));
+    EXPECT_EQ(status, ConfigParseStatus::Success);
+    return mechanism;
+  }
+}  // namespace
+
+TEST(CompiledMechanism, NumbersReactionsInCanonicalOrder)
+{
+  types::Mechanism mechanism = ParseFullConfiguration();
+  const types::Reactions& reactions = mechanism.reactions;
+  CompiledMechanism compiled = Compile(mechanism);
+
+  EXPECT_EQ(compiled.number_of_species, mechanism.species.size());
+  const std::size_t sizes[number_of_reaction_types] = { reactions.arrhenius.size(),
+                                                         reactions.branched.size(),
+                                                         reactions.condensed_phase_arrhenius.size(),
+                                                         reactions.condensed_phase_photolysis.size(),
+                                                         reactions.emission.size(),
+                                                         reactions.first_order_loss.size(),
+                                                         reactions.simpol_phase_transfer.size(),
+                                                         reactions.aqueous_equilibrium.size(),
+                                                         reactions.wet_deposition.size(),
+                                                         reactions.henrys_law.size(),
+                                                         reactions.photolysis.size(),
+                                                         reactions.surface.size(),
+                                                         reactions.troe.size(),
+                                                         reactions.tunneling.size() };
+  std::size_t begin = 0;
+  for (std::size_t type = 0; type < number_of_reaction_types; ++type)
+  {
+    compiled::ReactionRange range = compiled.Range(static_cast<types::ReactionType>(type));
+    EXPECT_EQ(range.begin, begin);
+    EXPECT_EQ(range.size(), sizes[type]);
+    EXPECT_GT(range.size(), 0) << "the full configuration has every reaction type";
+    for (std::size_t reaction = range.begin; reaction < range.end; ++reaction)
+    {
+      EXPECT_EQ(compiled.types[reaction], static_cast<types::ReactionType>(type));
+    }
+    begin = range.end;
+  }
+  EXPECT_EQ(compiled.number_of_reactions, begin);
+  EXPECT_EQ(compiled.types.size(), begin);
+  EXPECT_EQ(compiled.gas_phase.size(), begin);
+  EXPECT_EQ(compiled.reactants.offsets.size(), begin + 1);
+  EXPECT_EQ(compiled.products.offsets.size(), begin + 1);
+  EXPECT_EQ(compiled.alternative_products.offsets.size(), begin + 1);
+  EXPECT_EQ(compiled.reactants.offsets.back(), compiled.reactants.species.size());
+}
+
+TEST(CompiledMechanism, KeepsParametersInContiguousArrays)
+{
+  types::Mechanism mechanism = ParseFullConfiguration();
+  const types::Reactions& reactions = mechanism.reactions;
+  CompiledMechanism compiled = Compile(mechanism);
+
+  ASSERT_EQ(compiled.arrhenius.A.size(), reactions.arrhenius.size());
+  for (std::size_t i = 0; i < reactions.arrhenius.size(); ++i)
+  {
+    const types::Arrhenius& reaction = reactions.arrhenius[i];
+    EXPECT_EQ(compiled.arrhenius.A[i], reaction.A);
+    EXPECT_EQ(compiled.arrhenius.B[i], reaction.B);
+    EXPECT_EQ(compiled.arrhenius.C[i], reaction.C);
+    EXPECT_EQ(compiled.arrhenius.D[i], reaction.D);
+    EXPECT_EQ(compiled.arrhenius.E[i], reaction.E);
+    std::size_t position = compiled.Range(types::ReactionType::Arrhenius).begin + i;
+    EXPECT_EQ(compiled.gas_phase[position], reaction.gas_phase);
+    ExpectComponents(compiled.reactants, position, reaction.reactants);
+    ExpectComponents(compiled.products, position, reaction.products);
+    ExpectComponents(compiled.alternative_products, position, {});
+  }
+
+  ASSERT_EQ(compiled.troe.Fc.size(), reactions.troe.size());
+  EXPECT_EQ(compiled.troe.k0_A[0], reactions.troe[0].k0_A);
+  EXPECT_EQ(compiled.troe.kinf_C[0], reactions.troe[0].kinf_C);
+  EXPECT_EQ(compiled.troe.N[0], reactions.troe[0].N);
+
+  EXPECT_EQ(compiled.tunneling.C[0], reactions.tunneling[0].C);
+  EXPECT_EQ(compiled.simpol_phase_transfer.B3[0], reactions.simpol_phase_transfer[0].B[3]);
+  EXPECT_EQ(compiled.aqueous_equilibrium.k_reverse[0], reactions.aqueous_equilibrium[0].k_reverse);
+  EXPECT_EQ(compiled.surface[0], reactions.surface[0].reaction_probability);
+  EXPECT_EQ(compiled.condensed_phase_photolysis[0], reactions.condensed_phase_photolysis[0].scaling_factor_);
+  EXPECT_EQ(compiled.wet_deposition[0], reactions.wet_deposition[0].scaling_factor);
+}
+
+TEST(CompiledMechanism, FollowsTheComponentConventionsOfEachType)
+{
+  types::Mechanism mechanism = ParseFullConfiguration();
+  const types::Reactions& reactions = mechanism.reactions;
+  CompiledMechanism compiled = Compile(mechanism);
+
+  std::size_t branched = compiled.Range(types::ReactionType::Branched).begin;
+  EXPECT_EQ(compiled.branched.n[0], reactions.branched[0].n);
+  ExpectComponents(compiled.reactants, branched, reactions.branched[0].reactants);
+  ExpectComponents(compiled.products, branched, reactions.branched[0].nitrate_products);
+  ExpectComponents(compiled.alternative_products, branched, reactions.branched[0].alkoxy_products);
+
+  std::size_t surface = compiled.Range(types::ReactionType::Surface).begin;
+  ExpectComponents(compiled.reactants, surface, { reactions.surface[0].gas_phase_species });
+  ExpectComponents(compiled.products, surface, reactions.surface[0].gas_phase_products);
+  EXPECT_EQ(compiled.aerosol_phase[surface], reactions.surface[0].aerosol_phase);
+
+  std::size_t henrys_law = compiled.Range(types::ReactionType::HenrysLaw).begin;
+  ASSERT_EQ(compiled.reactants.Species(henrys_law).size(), 1);
+  EXPECT_EQ(compiled.reactants.Species(henrys_law)[0], reactions.henrys_law[0].gas_phase_species);
+  EXPECT_EQ(compiled.products.Species(henrys_law)[0], reactions.henrys_law[0].aerosol_phase_species);
+  EXPECT_EQ(compiled.aerosol_phase_water[henrys_law], reactions.henrys_law[0].aerosol_phase_water);
+
+  std::size_t emission = compiled.Range(types::ReactionType::Emission).begin;
+  EXPECT_TRUE(compiled.reactants.Species(emission).empty());
+  ExpectComponents(compiled.products, emission, reactions.emission[0].products);
+
+  std::size_t wet_deposition = compiled.Range(types::ReactionType::WetDeposition).begin;
+  EXPECT_TRUE(compiled.reactants.Species(wet_deposition).empty());
+  EXPECT_TRUE(compiled.products.Species(wet_deposition).empty());
+  EXPECT_EQ(compiled.gas_phase[wet_deposition], types::unknown_symbol);
+}
+
+TEST(CompiledMechanism, CompilesAnEmptyMechanism)
+{
+  CompiledMechanism compiled = Compile(types::Mechanism());
+  EXPECT_EQ(compiled.number_of_reactions, 0);
+  EXPECT_EQ(compiled.reactants.offsets.size(), 1);
+  EXPECT_EQ(compiled.Range(types::ReactionType::Troe).size(), 0);
+}
@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <open_atmos/mechanism_configuration/input_source.hpp>
+#include <open_atmos/mechanism_configuration/mapped_file.hpp>
+#include <open_atmos/mechanism_configuration/parser.hpp>
+#include <open_atmos/mechanism_configuration/serialization.hpp>
+#include <string>
+
+using namespace open_atmos::mechanism_configuration;
+using namespace open_atmos;
+
+namespace
+{
+  const std::string compressed_configs = "unit_configs/compressed/";
+
+  struct Encoding
+  {
+    Compression compression;
+    std::string extension;
+  };
+
+  const Encoding encodings[] = { { Compression::Gzip, ".gz" }, { Compression::Zstd, ".zst" } };
+
+  /// @brief The text stored in lines.gz and lines.zst, each of which holds it in two members or frames
+  std::string ExpectedLines()
+  {
+    std::string lines;
+    char line[16];
+    for (int i = 0; i < 100000; ++i)
+    {
+      std::snprintf(line, sizeof(line), "line %03d\n", i % 1000);
+      lines += line;
+    }
+    return lines;
+  }
+}  // namespace
+
+TEST(CompressedInput, DetectsCompression)
+{
+  EXPECT_EQ(DetectCompression("\x1f\x8b\x08"), Compression::Gzip);
+  EXPECT_EQ(DetectCompression("\x28\xb5\x2f\xfd"), Compression::Zstd);
+  EXPECT_EQ(DetectCompression("{\"version\": \"1.0.0\"}"), Compression::None);
+  EXPECT_EQ(DetectCompression("\x1f"), Compression::None);
+  EXPECT_EQ(DetectCompression(""), Compression::None);
+  EXPECT_TRUE(IsCompressionSupported(Compression::None));
+}
+
+TEST(CompressedInput, DecompressesEveryMemberAndRewinds)
+{
+  const std::string expected = ExpectedLines();
+  for (const Encoding& encoding : encodings)
+  {
+    SCOPED_TRACE(encoding.extension);
+    if (!IsCompressionSupported(encoding.compression))
+    {
+      continue;
+    }
+    auto [status, mapping] = MappedFile::Open(compressed_configs + "lines" + encoding.extension);
+    ASSERT_EQ(status, ConfigParseStatus::Success);
+    DecompressingStreamBuffer buffer(mapping.Contents(), encoding.compression);
+    std::istream stream(&buffer);
+    std::string first(std::istreambuf_iterator<char>(stream), {});
+    EXPECT_FALSE(buffer.Failed());
+    EXPECT_EQ(first, expected);
+    EXPECT_EQ(stream.tellg(), std::streampos(expected.size()));
+
+    stream.clear();
+    ASSERT_TRUE(stream.seekg(0));
+    std::string word;
+    stream >> word;
+    EXPECT_EQ(word, "line");
+    EXPECT_EQ(stream.tellg(), std::streampos(4));
+    EXPECT_FALSE(stream.seekg(2));
+  }
+}
+
+TEST(CompressedInput, ParsesCompressedFiles)
+{
+  for (const std::string format : { ".json", ".yaml" })
+  {
+    Parser parser;
+    auto [expected_status, expected] = parser.Parse(std::string("examples/full_configuration") + format);
+    ASSERT_EQ(expected_status, ConfigParseStatus::Success);
+    for (const Encoding& encoding : encodings)
+    {
+      SCOPED_TRACE(format + encoding.extension);
+      const std::filesystem::path path = compressed_configs + "full_configuration" + format + encoding.extension;
+      auto [status, mechanism] = parser.Parse(path);
+      if (!IsCompressionSupported(encoding.compression))
+      {
+        EXPECT_EQ(status, ConfigParseStatus::CompressionNotSupported);
+        continue;
+      }
+      ASSERT_EQ(status, ConfigParseStatus::Success);
+      EXPECT_EQ(Serialize(mechanism), Serialize(expected));
+
+      // without a format extension the format comes from the decompressed text
+      const std::filesystem::path copy = std::filesystem::temp_directory_path() / ("compressed_input_configuration" + encoding.extension);
+      std::filesystem::copy_file(path, copy, std::filesystem::copy_options::overwrite_existing);
+      auto [copy_status, from_copy] = parser.Parse(copy);
+      std::filesystem::remove(copy);
+      ASSERT_EQ(copy_status, ConfigParseStatus::Success);
+      EXPECT_EQ(Serialize(from_copy), Serialize(expected));
+
+      // buffers are decompressed too
+      auto [mapped, mapping] = MappedFile::Open(path);
+      ASSERT_EQ(mapped, ConfigParseStatus::Success);
+      auto [buffer_status, from_buffer] = parser.ParseBuffer(mapping.Contents());
+      ASSERT_EQ(buffer_status, ConfigParseStatus::Success);
+      EXPECT_EQ(Serialize(from_buffer), Serialize(expected));
+    }
+  }
+}
+
+TEST(CompressedInput, ReportsTruncatedData)
+{
+  for (const Encoding& encoding : encodings)
+  {
+    SCOPED_TRACE(encoding.extension);
+    Parser parser;
+    auto [status, mechanism] = parser.Parse(std::filesystem::path(compressed_configs + "truncated.json" + encoding.extension));
+    ConfigParseStatus expected =
+        IsCompressionSupported(encoding.compression) ? ConfigParseStatus::DecompressionFailed : ConfigParseStatus::CompressionNotSupported;
+    EXPECT_EQ(status, expected);
+  }
+}
@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <open_atmos/mechanism_configuration/input_source.hpp>
+#include <open_atmos/mechanism_configuration/parser.hpp>
+#include <open_atmos/mechanism_configuration/serialization.hpp>
+#include <sstream>
+#include <string>
+
+using namespace open_atmos::mechanism_configuration;
+using namespace open_atmos;
+
+namespace
+{
+  std::string ReadFile(const std::filesystem::path& path)
+  {
+    std::ifstream file(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+  }
+
+  /// @brief A stream buffer that hands out its text one character at a time and cannot seek, like a socket or pipe
+  class UnseekableBuffer : public std::streambuf
+  {
+   public:
+    explicit UnseekableBuffer(std::string contents)
+        : contents_(std::move(contents))
+    {
+    }
+
+   protected:
+    int_type underflow() override
+    {
+      if (gptr() == egptr() && position_ < contents_.size())
+      {
+        char* next = &contents_[position_++];
+        setg(next, next, next + 1);
+      }
+      return gptr() == egptr() ? traits_type::eof() : traits_type::to_int_type(*gptr());
+    }
+
+   private:
+    std::string contents_;
+    std::size_t position_{ 0 };
+  };
+}  // namespace
+
+TEST(InputSource, DetectsTheFormat)
+{
+  EXPECT_EQ(DetectFormat("{\"version\": 1}"), InputFormat::Json);
+  EXPECT_EQ(DetectFormat(" \r\n\t[1, 2]"), InputFormat::Json);
+  EXPECT_EQ(DetectFormat("\xef\xbb\xbf{}"), InputFormat::Json);
+  EXPECT_EQ(DetectFormat("version: 1.0.0"), InputFormat::Yaml);
+  EXPECT_EQ(DetectFormat("---\n{}"), InputFormat::Yaml);
+  EXPECT_EQ(DetectFormat(""), InputFormat::Yaml);
+  EXPECT_EQ(DetectFormat("version: 1.0.0", ".json"), InputFormat::Json);
+  EXPECT_EQ(DetectFormat("{}", ".yaml"), InputFormat::Yaml);
+  EXPECT_EQ(DetectFormat("{}", ".yml"), InputFormat::Yaml);
+  EXPECT_EQ(DetectFormat("{}", ".txt"), InputFormat::Json);
+}
+
+TEST(InputSource, MemoryStreamBufferReadsAndSeeks)
+{
+  std::string text = "abcdef";
+  MemoryStreamBuffer buffer(text);
+  std::istream stream(&buffer);
+  std::string first;
+  stream >> std::setw(3) >> first;
+  EXPECT_EQ(first, "abc");
+  EXPECT_EQ(stream.tellg(), std::streampos(3));
+  stream.seekg(1);
+  EXPECT_EQ(stream.get(), 'b');
+  stream.seekg(-1, std::ios_base::end);
+  EXPECT_EQ(stream.get(), 'f');
+  EXPECT_EQ(stream.get(), std::char_traits<char>::eof());
+  stream.clear();
+  EXPECT_FALSE(stream.seekg(7));
+}
+
+TEST(InputSource, ParsesBuffersStreamsAndFilesAlike)
+{
+  for (const std::string extension : { ".json", ".yaml" })
+  {
+    SCOPED_TRACE(extension);
+    const std::filesystem::path path = std::string("examples/full_configuration") + extension;
+    Parser parser;
+    auto [expected_status, expected] = parser.Parse(path);
+    ASSERT_EQ(expected_status, ConfigParseStatus::Success);
+    const std::string contents = ReadFile(path);
+
+    auto [buffer_status, from_buffer] = parser.ParseBuffer(contents);
+    ASSERT_EQ(buffer_status, ConfigParseStatus::Success);
+    EXPECT_EQ(Serialize(from_buffer), Serialize(expected));
+
+    std::istringstream seekable(contents);
+    auto [stream_status, from_stream] = parser.Parse(seekable);
+    ASSERT_EQ(stream_status, ConfigParseStatus::Success);
+    EXPECT_EQ(Serialize(from_stream), Serialize(expected));
+
+    // leading whitespace matters to YAML, so a stream that cannot be rewound must still see it
+    UnseekableBuffer unseekable_buffer("\n\n" + contents);
+    std::istream unseekable(&unseekable_buffer);
+    auto [unseekable_status, from_unseekable] = parser.Parse(unseekable);
+    ASSERT_EQ(unseekable_status, ConfigParseStatus::Success);
+    EXPECT_EQ(Serialize(from_unseekable), Serialize(expected));
+
+    // without an extension the format comes from the contents
+    const std::filesystem::path copy = std::filesystem::temp_directory_path() / ("input_source_full_configuration" + extension.substr(1));
+    std::filesystem::copy_file(path, copy, std::filesystem::copy_options::overwrite_existing);
+    auto [copy_status, from_copy] = parser.Parse(copy);
+    std::filesystem::remove(copy);
+    ASSERT_EQ(copy_status, ConfigParseStatus::Success);
+    EXPECT_EQ(Serialize(from_copy), Serialize(expected));
+  }
+}
+
+TEST(InputSource, FallsBackToYamlForLooseJson)
+{
+  // a flow mapping with a comment is YAML but not JSON
+  const std::string contents = ReadFile("examples/full_configuration.json");
+  const std::string loose = "{ # a comment\n" + contents.substr(contents.find('{') + 1);
+  Parser parser;
+  EXPECT_EQ(parser.ParseBuffer(loose).first, ConfigParseStatus::Success);
+  std::istringstream stream(loose);
+  EXPECT_EQ(parser.Parse(stream).first, ConfigParseStatus::Success);
+}
+
+TEST(InputSource, ReportsErrorsFromBuffers)
+{
+  Parser parser;
+  const std::string contents = ReadFile("unit_configs/reactions/arrhenius/missing_phase.json");
+  EXPECT_EQ(parser.ParseBuffer(contents).first, ConfigParseStatus::UnknownPhase);
+}
@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+
+#include <open_atmos/mechanism_configuration/jacobian.hpp>
+#include <open_atmos/mechanism_configuration/parser.hpp>
+
+using namespace open_atmos::mechanism_configuration;
+using namespace open_atmos;
+
+namespace
+{
+  // the gas and aqueous species are interleaved so that blocking by phase has to reorder them
+  enum Species : types::SymbolId
+  {
+    A,
+    D,
+    B,
+    W,
+    C,
+    P,
+    NumberOfSpecies
+  };
+
+  types::ReactionComponent Component(types::SymbolId species, double coefficient = 1.0)
+  {
+    types::ReactionComponent component;
+    component.species_id = species;
+    component.coefficient = coefficient;
+    return component;
+  }
+
+  types::Mechanism BuildMechanism()
+  {
+    types::Mechanism mechanism;
+    for (const char* name : { "A", "D", "B", "W", "C", "P" })
+    {
+      mechanism.species.push_back({ name, {}, {} });
+      mechanism.species_symbols.Intern(name);
+    }
+    mechanism.phases.push_back({ "gas", { "A", "B", "C", "P" }, {} });
+    mechanism.phases.push_back({ "aqueous", { "D", "W" }, {} });
+    mechanism.phase_symbols.Intern("gas");
+    mechanism.phase_symbols.Intern("aqueous");
+
+    // A + C -> B + C
+    types::Arrhenius arrhenius;
+    arrhenius.reactants = { Component(A), Component(C) };
+    arrhenius.products = { Component(B), Component(C) };
+    mechanism.reactions.arrhenius.push_back(arrhenius);
+
+    // -> P
+    types::Emission emission;
+    emission.products = { Component(P) };
+    mechanism.reactions.emission.push_back(emission);
+
+    // B (gas) <-> D (aqueous), normalized by the aqueous water W
+    types::HenrysLaw henrys_law;
+    henrys_law.gas_phase_species = B;
+    henrys_law.aerosol_phase_species = D;
+    henrys_law.aerosol_phase_water = W;
+    mechanism.reactions.henrys_law.push_back(henrys_law);
+    return mechanism;
+  }
+
+  bool Has(const SparsityPattern& pattern, std::size_t row, std::size_t column)
+  {
+    return pattern.Find(row, column) != SparsityPattern::npos;
+  }
+}  // namespace
+
+TEST(Jacobian, FollowsRateDependencies)
+{
+  JacobianPattern jacobian = BuildJacobianPattern(BuildMechanism());
+  const SparsityPattern& pattern = jacobian.pattern;
+  ASSERT_EQ(pattern.number_of_rows, NumberOfSpecies);
+  EXPECT_EQ(jacobian.block_offsets, (std::vector<std::uint32_t>{ 0, NumberOfSpecies }));
+
+  for (std::size_t species = 0; species < NumberOfSpecies; ++species)
+  {
+    EXPECT_TRUE(Has(pattern, species, species));
+  }
+  // A + C -> B + C changes A and B, depending on A and C; C is unchanged
+  EXPECT_TRUE(Has(pattern, A, C));
+  EXPECT_TRUE(Has(pattern, B, A));
+  EXPECT_TRUE(Has(pattern, B, C));
+  EXPECT_FALSE(Has(pattern, C, A));
+  // the emission depends on nothing
+  EXPECT_EQ(pattern.Columns(P).size(), 1);
+  // the transfer runs both ways and is normalized by water
+  EXPECT_TRUE(Has(pattern, B, D));
+  EXPECT_TRUE(Has(pattern, D, B));
+  EXPECT_TRUE(Has(pattern, D, W));
+  EXPECT_TRUE(Has(pattern, B, W));
+  EXPECT_FALSE(Has(pattern, W, B));
+
+  // A: A C; D: D B W; B: A B C D W; W: W; C: C; P: P
+  EXPECT_EQ(pattern.Size(), 2 + 3 + 5 + 1 + 1 + 1);
+}
+
+TEST(Jacobian, BlocksByPhase)
+{
+  types::Mechanism mechanism = BuildMechanism();
+  JacobianPattern plain = BuildJacobianPattern(mechanism);
+  JacobianPattern blocked = BuildJacobianPattern(mechanism, { true });
+
+  EXPECT_EQ(blocked.species_order, (std::vector<std::uint32_t>{ A, B, C, P, D, W }));
+  EXPECT_EQ(blocked.block_offsets, (std::vector<std::uint32_t>{ 0, 4, 6 }));
+  EXPECT_EQ(blocked.block_phases, (std::vector<types::SymbolId>{ 0, 1 }));
+  ASSERT_EQ(blocked.pattern.Size(), plain.pattern.Size());
+  for (std::size_t row = 0; row < NumberOfSpecies; ++row)
+  {
+    for (std::size_t column = 0; column < NumberOfSpecies; ++column)
+    {
+      EXPECT_EQ(Has(blocked.pattern, row, column), Has(plain.pattern, blocked.species_order[row], blocked.species_order[column]));
+    }
+  }
+}
+
+TEST(Jacobian, PlacesSpeciesWithoutAPhaseLast)
+{
+  types::Mechanism mechanism = BuildMechanism();
+  mechanism.phases.pop_back();
+  JacobianPattern blocked = BuildJacobianPattern(mechanism, { true });
+  EXPECT_EQ(blocked.species_order, (std::vector<std::uint32_t>{ A, B, C, P, D, W }));
+  EXPECT_EQ(blocked.block_phases, (std::vector<types::SymbolId>{ 0, types::unknown_symbol }));
+}
+
+TEST(Jacobian, CoversAParsedMechanism)
+{
+  Parser parser;
+  auto [status, mechanism] = parser.Parse(std::string("examples/full_configuration.json"));
+  ASSERT_EQ(status, ConfigParseStatus::Success);
+  JacobianPattern jacobian = BuildJacobianPattern(mechanism, { true });
+  EXPECT_EQ(jacobian.pattern.number_of_rows, mechanism.species.size());
+  EXPECT_EQ(jacobian.block_offsets.back(), mechanism.species.size());
+  EXPECT_GT(jacobian.pattern.Size(), mechanism.species.size());
+}
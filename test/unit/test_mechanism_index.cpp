@@ -0,0 +1,45 @@
+#include <gtest/gtest.h>
+
+#include <open_atmos/mechanism_configuration/mechanism_index.hpp>
+
+using namespace open_atmos::mechanism_configuration;
+using namespace open_atmos;
+
+TEST(MechanismIndex, ResolvesSpeciesAndPhases)
+{
+  std::vector<types::Species> species(4);
+  species[0].name = "A";
+  species[1].name = "B";
+  species[2].name = "C";
+  species[3].name = "A";
+  std::vector<types::Phase> phases(2);
+  phases[0].name = "gas";
+  phases[0].species = { "A", "B" };
+  phases[1].name = "aqueous";
+  phases[1].species = { "C" };
+
+  MechanismIndex index(species);
+  EXPECT_EQ(index.FindSpecies("A"), 0);
+  EXPECT_EQ(index.FindSpecies("C"), 2);
+  EXPECT_EQ(index.FindSpecies("D"), types::unknown_symbol);
+  EXPECT_EQ(index.FindPhase("gas"), types::unknown_symbol);
+  EXPECT_TRUE(index.Phases().empty());
+  EXPECT_EQ(index.SpeciesSymbols().Size(), 3);
+
+  index.IndexPhases(phases);
+  EXPECT_EQ(index.FindPhase("gas"), 0);
+  EXPECT_EQ(index.FindPhase("aqueous"), 1);
+  EXPECT_EQ(index.FindPhase("solid"), types::unknown_symbol);
+  EXPECT_EQ(index.PhaseSymbols().Name(1), "aqueous");
+  EXPECT_EQ(&index.Species(), &species);
+  EXPECT_EQ(&index.Phases(), &phases);
+
+  EXPECT_TRUE(index.PhaseContains(0, 1));
+  EXPECT_FALSE(index.PhaseContains(0, 2));
+  EXPECT_FALSE(index.PhaseContains(0, types::unknown_symbol));
+  EXPECT_FALSE(index.PhaseContains(types::unknown_symbol, 0));
+  EXPECT_FALSE(index.RequiresUnknownSpecies({ 0, 1, 2 }));
+  EXPECT_TRUE(index.RequiresUnknownSpecies({ 0, types::unknown_symbol }));
+  EXPECT_FALSE(index.RequiresSpeciesOutsidePhase({ 0, 1 }, 0));
+  EXPECT_TRUE(index.RequiresSpeciesOutsidePhase({ 0, 2 }, 0));
+}
@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <open_atmos/mechanism_configuration/mechanism_view.hpp>
+#include <open_atmos/mechanism_configuration/parser.hpp>
+
+using namespace open_atmos::mechanism_configuration;
+using namespace open_atmos;
+
+namespace
+{
+  std::string ComponentNames(const MechanismView& view, flat::Range components)
+  {
+    std::string names;
+    for (const auto& component : view.Components(components))
+    {
+      names += std::string(view.String(view.Species()[component.species_id].name)) + " ";
+    }
+    return names;
+  }
+}  // namespace
+
+TEST(MechanismView, MatchesTheParsedMechanism)
+{
+  Parser parser;
+  auto [status, mechanism] = parser.Parse(std::string("examples/full_configuration.json"));
+  ASSERT_EQ(status, ConfigParseStatus::Success);
+
+  const std::filesystem::path file_path = std::filesystem::temp_directory_path() / "mechanism_view_test.oamv";
+  {
+    std::vector<std::byte> bytes = Flatten(mechanism);
+    std::ofstream file(file_path, std::ios::binary);
+    file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+  }
+
+  {
+    auto [view_status, view] = MechanismView::Open(file_path);
+    ASSERT_EQ(view_status, ConfigParseStatus::Success);
+
+    EXPECT_EQ(view.Name(), mechanism.name);
+
+    ASSERT_EQ(view.Species().size(), mechanism.species.size());
+    for (std::size_t i = 0; i < mechanism.species.size(); ++i)
+    {
+      EXPECT_EQ(view.String(view.Species()[i].name), mechanism.species[i].name);
+      auto properties = view.Properties(view.Species()[i]);
+      ASSERT_EQ(properties.size(), mechanism.species[i].optional_numerical_properties.size());
+      for (const auto& property : properties)
+      {
+        EXPECT_EQ(property.value, mechanism.species[i].optional_numerical_properties.at(std::string(view.String(property.key))));
+      }
+    }
+
+    ASSERT_EQ(view.Phases().size(), mechanism.phases.size());
+    for (std::size_t i = 0; i < mechanism.phases.size(); ++i)
+    {
+      EXPECT_EQ(view.String(view.Phases()[i].name), mechanism.phases[i].name);
+      auto species = view.PhaseSpecies(view.Phases()[i]);
+      ASSERT_EQ(species.size(), mechanism.phases[i].species.size());
+      for (std::size_t j = 0; j < species.size(); ++j)
+      {
+        EXPECT_EQ(view.String(view.Species()[species[j]].name), mechanism.phases[i].species[j]);
+      }
+    }
+
+    const auto& reactions = mechanism.reactions;
+    std::size_t total = reactions.arrhenius.size() + reactions.branched.size() + reactions.condensed_phase_arrhenius.size() +
+                        reactions.condensed_phase_photolysis.size() + reactions.emission.size() + reactions.first_order_loss.size() +
+                        reactions.simpol_phase_transfer.size() + reactions.aqueous_equilibrium.size() + reactions.wet_deposition.size() +
+                        reactions.henrys_law.size() + reactions.photolysis.size() + reactions.surface.size() + reactions.troe.size() +
+                        reactions.tunneling.size();
+    ASSERT_EQ(view.Reactions().size(), total);
+
+    // the first reaction is the first Arrhenius reaction
+    const flat::Reaction& arrhenius = view.Reactions()[0];
+    EXPECT_EQ(arrhenius.type, types::ReactionType::Arrhenius);
+    EXPECT_EQ(view.String(arrhenius.name), reactions.arrhenius[0].name);
+    EXPECT_EQ(arrhenius.gas_phase, reactions.arrhenius[0].gas_phase);
+    auto parameters = view.Parameters(arrhenius);
+    ASSERT_EQ(parameters.size(), 5);
+    EXPECT_EQ(parameters[0], reactions.arrhenius[0].A);
+    EXPECT_EQ(parameters[4], reactions.arrhenius[0].E);
+    ASSERT_EQ(view.Components(arrhenius.reactants).size(), reactions.arrhenius[0].reactants.size());
+    EXPECT_EQ(view.Components(arrhenius.reactants)[0].species_id, reactions.arrhenius[0].reactants[0].species_id);
+    EXPECT_EQ(view.Components(arrhenius.reactants)[0].coefficient, reactions.arrhenius[0].reactants[0].coefficient);
+
+    const flat::Reaction& branched = view.Reactions()[reactions.arrhenius.size()];
+    EXPECT_EQ(branched.type, types::ReactionType::Branched);
+    EXPECT_EQ(view.Parameters(branched)[3], reactions.branched[0].n);
+    EXPECT_EQ(view.Components(branched.products).size(), reactions.branched[0].nitrate_products.size());
+    EXPECT_EQ(view.Components(branched.alternative_products).size(), reactions.branched[0].alkoxy_products.size());
+
+    const flat::Reaction& tunneling = view.Reactions()[total - 1];
+    EXPECT_EQ(tunneling.type, types::ReactionType::Tunneling);
+    std::string expected_names;
+    for (const auto& reactant : reactions.tunneling.back().reactants)
+    {
+      expected_names += mechanism.species_symbols.Name(reactant.species_id) + " ";
+    }
+    EXPECT_EQ(ComponentNames(view, tunneling.reactants), expected_names);
+    EXPECT_EQ(view.Parameters(tunneling)[2], reactions.tunneling.back().C);
+  }
+
+  std::filesystem::remove(file_path);
+}
+
+TEST(MechanismView, RejectsInvalidFiles)
+{
+  EXPECT_EQ(MechanismView::Open("examples/_missing_file.oamv").first, ConfigParseStatus::InvalidFilePath);
+  EXPECT_EQ(MechanismView::Open("examples/full_configuration.json").first, ConfigParseStatus::InvalidBinaryFormat);
+  EXPECT_EQ(MechanismView::FromBuffer(nullptr, 0).first, ConfigParseStatus::InvalidBinaryFormat);
+
+  std::vector<std::byte> bytes = Flatten(types::Mechanism());
+  EXPECT_EQ(MechanismView::FromBuffer(bytes.data(), bytes.size()).first, ConfigParseStatus::Success);
+  EXPECT_EQ(MechanismView::FromBuffer(bytes.data(), bytes.size() - 1).first, ConfigParseStatus::InvalidBinaryFormat);
+
+  std::vector<std::byte> wrong_version = bytes;
+  wrong_version[4] = std::byte{ 0xff };
+  EXPECT_EQ(MechanismView::FromBuffer(wrong_version.data(), wrong_version.size()).first, ConfigParseStatus::UnsupportedBinaryVersion);
+}
+
+TEST(MechanismView, ReturnsEmptyRangesOutsideTheirSections)
+{
+  types::Mechanism mechanism;
+  mechanism.species.push_back({ "A", {}, {} });
+  std::vector<std::byte> bytes = Flatten(mechanism);
+  auto [status, view] = MechanismView::FromBuffer(bytes.data(), bytes.size());
+  ASSERT_EQ(status, ConfigParseStatus::Success);
+  EXPECT_EQ(view.String(view.Species()[0].name), "A");
+  EXPECT_TRUE(view.String({ 0, 1000 }).empty());
+  EXPECT_TRUE(view.Components({ 5, 1 }).empty());
+  EXPECT_TRUE(MechanismView().Species().empty());
+}
@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+
+#include <clocale>
+#include <cmath>
+#include <limits>
+#include <open_atmos/mechanism_configuration/numbers.hpp>
+
+using namespace open_atmos::mechanism_configuration;
+
+TEST(Numbers, ParsesDecimalAndScientificNotation)
+{
+  double value = 0;
+  EXPECT_TRUE(ParseNumber("0.5", value));
+  EXPECT_EQ(value, 0.5);
+  EXPECT_TRUE(ParseNumber("-12", value));
+  EXPECT_EQ(value, -12.0);
+  EXPECT_TRUE(ParseNumber("+3.25", value));
+  EXPECT_EQ(value, 3.25);
+  EXPECT_TRUE(ParseNumber("1.2e-10", value));
+  EXPECT_EQ(value, 1.2e-10);
+  EXPECT_TRUE(ParseNumber("4E+3", value));
+  EXPECT_EQ(value, 4.0e3);
+  EXPECT_TRUE(ParseNumber(".5", value));
+  EXPECT_EQ(value, 0.5);
+  EXPECT_TRUE(ParseNumber("2.", value));
+  EXPECT_EQ(value, 2.0);
+  EXPECT_TRUE(ParseNumber("0.1", value));
+  EXPECT_EQ(value, 0.1);
+}
+
+TEST(Numbers, ParsesYamlSpecialValues)
+{
+  double value = 0;
+  EXPECT_TRUE(ParseNumber(".inf", value));
+  EXPECT_EQ(value, std::numeric_limits<double>::infinity());
+  EXPECT_TRUE(ParseNumber("-.Inf", value));
+  EXPECT_EQ(value, -std::numeric_limits<double>::infinity());
+  EXPECT_TRUE(ParseNumber("+.INF", value));
+  EXPECT_EQ(value, std::numeric_limits<double>::infinity());
+  EXPECT_TRUE(ParseNumber(".NaN", value));
+  EXPECT_TRUE(std::isnan(value));
+}
+
+TEST(Numbers, RejectsAnythingElse)
+{
+  double value = 7;
+  for (const char* text : { "", "abc", "1.0x", "1e", "+-1", "--1", "- 1", " 1", "inf", "nan", "0x10", "1,5", "1e999", "-.nan" })
+  {
+    EXPECT_FALSE(ParseNumber(text, value)) << text;
+  }
+  EXPECT_EQ(value, 7);
+}
+
+TEST(Numbers, IgnoresTheGlobalLocale)
+{
+  // a locale with a comma as the decimal separator, where one is installed
+  const char* previous = std::setlocale(LC_NUMERIC, nullptr);
+  std::string saved = previous ? previous : "C";
+  if (std::setlocale(LC_NUMERIC, "de_DE.UTF-8") == nullptr && std::setlocale(LC_NUMERIC, "fr_FR.UTF-8") == nullptr)
+  {
+    GTEST_SKIP() << "no locale with a decimal comma is installed";
+  }
+  double value = 0;
+  EXPECT_TRUE(ParseNumber("1.5", value));
+  EXPECT_EQ(value, 1.5);
+  EXPECT_FALSE(ParseNumber("1,5", value));
+  std::setlocale(LC_NUMERIC, saved.c_str());
+}
+
+TEST(Numbers, DecodesScalarNodesOnly)
+{
+  double value = 0;
+  EXPECT_EQ(DecodeNumber(YAML::Load("2.5e3"), value), ConfigParseStatus::Success);
+  EXPECT_EQ(value, 2.5e3);
+  EXPECT_EQ(DecodeNumber(YAML::Load("[1, 2]"), value), ConfigParseStatus::InvalidNumericValue);
+  EXPECT_EQ(DecodeNumber(YAML::Load("{a: 1}"), value), ConfigParseStatus::InvalidNumericValue);
+  EXPECT_EQ(DecodeNumber(YAML::Node(), value), ConfigParseStatus::InvalidNumericValue);
+  EXPECT_EQ(DecodeNumber(YAML::Load("one"), value), ConfigParseStatus::InvalidNumericValue);
+}
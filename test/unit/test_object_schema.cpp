@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+
+#include <open_atmos/mechanism_configuration/object_schema.hpp>
+#include <string>
+#include <unordered_map>
+
+using namespace open_atmos::mechanism_configuration;
+
+struct Decoded
+{
+  double value{ 1.0 };
+  std::string label;
+  std::unordered_map<std::string, std::string> unknown_properties;
+};
+
+enum Field
+{
+  Label,
+  Value,
+  Raw,
+  NumberOfFields
+};
+
+const ObjectSchema<Decoded, NumberOfFields> schema{ { {
+    { "label", FieldPresence::Required, DecodeMember<&Decoded::label> },
+    { "value", FieldPresence::Optional, DecodeMember<&Decoded::value> },
+    { "raw", FieldPresence::Optional } } } };
+
+TEST(ObjectSchema, DecodesFieldsAndCommentsInOnePass)
+{
+  YAML::Node object = YAML::Load(R"({label: a, value: 2.5, raw: [1, 2], __note: {x: 1}, with__inside: 3})");
+  Decoded decoded;
+  ObjectFields<NumberOfFields> fields;
+
+  EXPECT_EQ(DecodeObject(object, schema, decoded, fields), ConfigParseStatus::Success);
+  EXPECT_EQ(decoded.label, "a");
+  EXPECT_EQ(decoded.value, 2.5);
+  ASSERT_TRUE(fields.Has(Raw));
+  EXPECT_EQ(fields[Raw].size(), 2);
+  EXPECT_EQ(decoded.unknown_properties.size(), 1);
+  EXPECT_EQ(decoded.unknown_properties["__note"], "{\"x\": \"1\"}");
+}
+
+TEST(ObjectSchema, LeavesAbsentOptionalFieldsUntouched)
+{
+  Decoded decoded;
+  ObjectFields<NumberOfFields> fields;
+
+  EXPECT_EQ(DecodeObject(YAML::Load("{label: b}"), schema, decoded, fields), ConfigParseStatus::Success);
+  EXPECT_EQ(decoded.value, 1.0);
+  EXPECT_FALSE(fields.Has(Value));
+  EXPECT_FALSE(fields.Has(Raw));
+}
+
+TEST(ObjectSchema, ReportsMissingKeysBeforeInvalidKeys)
+{
+  Decoded decoded;
+  ObjectFields<NumberOfFields> fields;
+  EXPECT_EQ(DecodeObject(YAML::Load("{value: x, unexpected: 1}"), schema, decoded, fields), ConfigParseStatus::RequiredKeyNotFound);
+
+  Decoded invalid;
+  ObjectFields<NumberOfFields> invalid_fields;
+  EXPECT_EQ(DecodeObject(YAML::Load("{label: c, value: x, unexpected: 1}"), schema, invalid, invalid_fields), ConfigParseStatus::InvalidKey);
+  // values are only converted once the object is known to be valid
+  EXPECT_EQ(invalid.value, 1.0);
+}
+
+TEST(ObjectSchema, AcceptsNullObjects)
+{
+  Decoded decoded;
+  ObjectFields<NumberOfFields> fields;
+  EXPECT_EQ(DecodeObject(YAML::Node(), schema, decoded, fields), ConfigParseStatus::Success);
+  EXPECT_EQ(schema.Find("raw"), Raw);
+  EXPECT_EQ(schema.Find("missing"), NumberOfFields);
+}
@@ -16,34 +16,34 @@ TEST(Parser, CanParseValidAqueousEquilibriumReaction)
     EXPECT_EQ(mechanism.reactions.aqueous_equilibrium.size(), 2);
 
     EXPECT_EQ(mechanism.reactions.aqueous_equilibrium[0].name, "my aqueous eq");
-    EXPECT_EQ(mechanism.reactions.aqueous_equilibrium[0].aerosol_phase, "aerosol");
-    EXPECT_EQ(mechanism.reactions.aqueous_equilibrium[0].aerosol_phase_water, "H2O_aq");
+    EXPECT_EQ(mechanism.phase_symbols.Name(mechanism.reactions.aqueous_equilibrium[0].aerosol_phase), "aerosol");
+    EXPECT_EQ(mechanism.species_symbols.Name(mechanism.reactions.aqueous_equilibrium[0].aerosol_phase_water), "H2O_aq");
     EXPECT_EQ(mechanism.reactions.aqueous_equilibrium[0].A, 1.14e-2);
     EXPECT_EQ(mechanism.reactions.aqueous_equilibrium[0].C, 2300.0);
     EXPECT_EQ(mechanism.reactions.aqueous_equilibrium[0].k_reverse, 0.32);
     EXPECT_EQ(mechanism.reactions.aqueous_equilibrium[0].reactants.size(), 1);
-    EXPECT_EQ(mechanism.reactions.aqueous_equilibrium[0].reactants[0].species_name, "A");
+    EXPECT_EQ(mechanism.species_symbols.Name(mechanism.reactions.aqueous_equilibrium[0].reactants[0].species_id), "A");
     EXPECT_EQ(mechanism.reactions.aqueous_equilibrium[0].reactants[0].coefficient, 2);
     EXPECT_EQ(mechanism.reactions.aqueous_equilibrium[0].products.size(), 2);
-    EXPECT_EQ(mechanism.reactions.aqueous_equilibrium[0].products[0].species_name, "B");
+    EXPECT_EQ(mechanism.species_symbols.Name(mechanism.reactions.aqueous_equilibrium[0].products[0].species_id), "B");
     EXPECT_EQ(mechanism.reactions.aqueous_equilibrium[0].products[0].coefficient, 1);
-    EXPECT_EQ(mechanism.reactions.aqueous_equilibrium[0].products[1].species_name, "C");
+    EXPECT_EQ(mechanism.species_symbols.Name(mechanism.reactions.aqueous_equilibrium[0].products[1].species_id), "C");
     EXPECT_EQ(mechanism.reactions.aqueous_equilibrium[0].products[1].coefficient, 1);
     EXPECT_EQ(mechanism.reactions.aqueous_equilibrium[0].unknown_properties.size(), 1);
     EXPECT_EQ(mechanism.reactions.aqueous_equilibrium[0].unknown_properties["__comment"], "\"GIF is pronounced with a hard g\"");
 
-    EXPECT_EQ(mechanism.reactions.aqueous_equilibrium[1].aerosol_phase, "aerosol");
-    EXPECT_EQ(mechanism.reactions.aqueous_equilibrium[1].aerosol_phase_water, "H2O_aq");
+    EXPECT_EQ(mechanism.phase_symbols.Name(mechanism.reactions.aqueous_equilibrium[1].aerosol_phase), "aerosol");
+    EXPECT_EQ(mechanism.species_symbols.Name(mechanism.reactions.aqueous_equilibrium[1].aerosol_phase_water), "H2O_aq");
     EXPECT_EQ(mechanism.reactions.aqueous_equilibrium[1].A, 1);
     EXPECT_EQ(mechanism.reactions.aqueous_equilibrium[1].C, 0);
     EXPECT_EQ(mechanism.reactions.aqueous_equilibrium[1].k_reverse, 0.32);
     EXPECT_EQ(mechanism.reactions.aqueous_equilibrium[1].reactants.size(), 1);
-    EXPECT_EQ(mechanism.reactions.aqueous_equilibrium[1].reactants[0].species_name, "A");
+    EXPECT_EQ(mechanism.species_symbols.Name(mechanism.reactions.aqueous_equilibrium[1].reactants[0].species_id), "A");
     EXPECT_EQ(mechanism.reactions.aqueous_equilibrium[1].reactants[0].coefficient, 2);
     EXPECT_EQ(mechanism.reactions.aqueous_equilibrium[1].products.size(), 2);
-    EXPECT_EQ(mechanism.reactions.aqueous_equilibrium[1].products[0].species_name, "B");
+    EXPECT_EQ(mechanism.species_symbols.Name(mechanism.reactions.aqueous_equilibrium[1].products[0].species_id), "B");
     EXPECT_EQ(mechanism.reactions.aqueous_equilibrium[1].products[0].coefficient, 1);
-    EXPECT_EQ(mechanism.reactions.aqueous_equilibrium[1].products[1].species_name, "C");
+    EXPECT_EQ(mechanism.species_symbols.Name(mechanism.reactions.aqueous_equilibrium[1].products[1].species_id), "C");
     EXPECT_EQ(mechanism.reactions.aqueous_equilibrium[1].products[1].coefficient, 1);
   }
 }
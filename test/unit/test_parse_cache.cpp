@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <open_atmos/mechanism_configuration/parser.hpp>
+#include <open_atmos/mechanism_configuration/serialization.hpp>
+
+using namespace open_atmos::mechanism_configuration;
+using namespace open_atmos;
+
+namespace
+{
+  std::vector<std::filesystem::path> CacheEntries(const std::filesystem::path& directory)
+  {
+    std::vector<std::filesystem::path> entries;
+    for (const auto& entry : std::filesystem::directory_iterator(directory))
+    {
+      entries.push_back(entry.path());
+    }
+    return entries;
+  }
+
+  class ParseCacheTest : public ::testing::Test
+  {
+   protected:
+    void SetUp() override
+    {
+      directory = std::filesystem::temp_directory_path() / ("parse_cache_test_" + std::to_string(::testing::UnitTest::GetInstance()->random_seed()));
+      std::filesystem::remove_all(directory);
+    }
+
+    void TearDown() override
+    {
+      std::filesystem::remove_all(directory);
+    }
+
+    std::filesystem::path directory;
+  };
+}  // namespace
+
+TEST_F(ParseCacheTest, ReturnsTheStoredMechanism)
+{
+  for (const std::string extension : { ".json", ".yaml" })
+  {
+    SCOPED_TRACE(extension);
+    Parser uncached;
+    auto [expected_status, expected] = uncached.Parse(std::string("examples/full_configuration") + extension);
+    ASSERT_EQ(expected_status, ConfigParseStatus::Success);
+
+    Parser parser;
+    parser.EnableCache(directory);
+    auto [first_status, first] = parser.Parse(std::string("examples/full_configuration") + extension);
+    ASSERT_EQ(first_status, ConfigParseStatus::Success);
+    EXPECT_EQ(Serialize(first), Serialize(expected));
+
+    auto [second_status, second] = parser.Parse(std::string("examples/full_configuration") + extension);
+    ASSERT_EQ(second_status, ConfigParseStatus::Success);
+    EXPECT_EQ(Serialize(second), Serialize(expected));
+  }
+  // one entry for each file, and no temporary files left behind
+  auto entries = CacheEntries(directory);
+  ASSERT_EQ(entries.size(), 2);
+  EXPECT_EQ(entries[0].extension(), ".oamc");
+  EXPECT_EQ(entries[1].extension(), ".oamc");
+}
+
+TEST_F(ParseCacheTest, DoesNotStoreFailedParses)
+{
+  Parser parser;
+  parser.EnableCache(directory);
+  auto [status, mechanism] = parser.Parse(std::string("unit_configs/reactions/arrhenius/missing_phase.json"));
+  EXPECT_NE(status, ConfigParseStatus::Success);
+  EXPECT_FALSE(std::filesystem::exists(directory));
+}
+
+TEST_F(ParseCacheTest, ReplacesDamagedEntries)
+{
+  Parser parser;
+  parser.EnableCache(directory);
+  auto [status, expected] = parser.Parse(std::string("examples/full_configuration.json"));
+  ASSERT_EQ(status, ConfigParseStatus::Success);
+
+  auto entries = CacheEntries(directory);
+  ASSERT_EQ(entries.size(), 1);
+  {
+    std::ofstream file(entries[0], std::ios::binary | std::ios::trunc);
+    file << "not a mechanism";
+  }
+
+  auto [reparsed_status, reparsed] = parser.Parse(std::string("examples/full_configuration.json"));
+  ASSERT_EQ(reparsed_status, ConfigParseStatus::Success);
+  EXPECT_EQ(Serialize(reparsed), Serialize(expected));
+  EXPECT_GT(std::filesystem::file_size(entries[0]), 100);
+}
+
+TEST_F(ParseCacheTest, EvictsTheLeastRecentlyUsedEntries)
+{
+  Parser probe;
+  probe.EnableCache(directory);
+  probe.Parse(std::string("examples/full_configuration.json"));
+  auto entries = CacheEntries(directory);
+  ASSERT_EQ(entries.size(), 1);
+  std::uintmax_t entry_size = std::filesystem::file_size(entries[0]);
+  std::filesystem::last_write_time(entries[0], std::filesystem::file_time_type::clock::now() - std::chrono::hours(1));
+
+  // room for one entry only, so storing the YAML configuration removes the older JSON entry
+  Parser parser;
+  parser.EnableCache(directory, entry_size + entry_size / 2);
+  parser.Parse(std::string("examples/full_configuration.yaml"));
+  auto remaining = CacheEntries(directory);
+  ASSERT_EQ(remaining.size(), 1);
+  EXPECT_NE(remaining[0], entries[0]);
+}
+
+TEST_F(ParseCacheTest, RemovesAbandonedTemporaryFiles)
+{
+  // a Store that crashed between writing and renaming leaves its temporary file behind
+  std::filesystem::create_directories(directory);
+  const std::filesystem::path abandoned = directory / "0123456789abcdef-10.0000000000000000.0.tmp";
+  const std::filesystem::path in_progress = directory / "0123456789abcdef-10.0000000000000000.1.tmp";
+  for (const auto& path : { abandoned, in_progress })
+  {
+    std::ofstream file(path, std::ios::binary);
+    file << std::string(4096, 'x');
+  }
+  std::filesystem::last_write_time(abandoned, std::filesystem::file_time_type::clock::now() - std::chrono::hours(1));
+
+  Parser parser;
+  parser.EnableCache(directory);
+  auto [status, mechanism] = parser.Parse(std::string("examples/full_configuration.json"));
+  ASSERT_EQ(status, ConfigParseStatus::Success);
+  EXPECT_FALSE(std::filesystem::exists(abandoned));
+  // another writer may still rename a recent one into place
+  EXPECT_TRUE(std::filesystem::exists(in_progress));
+  EXPECT_EQ(CacheEntries(directory).size(), 2);
+}
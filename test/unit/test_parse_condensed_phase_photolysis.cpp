@@ -15,27 +15,27 @@ TEST(Parser, CanParseValidCondensedPhasePhotolysisReaction)
 
     EXPECT_EQ(mechanism.reactions.condensed_phase_photolysis.size(), 2);
 
-    EXPECT_EQ(mechanism.reactions.condensed_phase_photolysis[0].aerosol_phase, "aqueous aerosol");
-    EXPECT_EQ(mechanism.reactions.condensed_phase_photolysis[0].aerosol_phase_water, "H2O_aq");
+    EXPECT_EQ(mechanism.phase_symbols.Name(mechanism.reactions.condensed_phase_photolysis[0].aerosol_phase), "aqueous aerosol");
+    EXPECT_EQ(mechanism.species_symbols.Name(mechanism.reactions.condensed_phase_photolysis[0].aerosol_phase_water), "H2O_aq");
     EXPECT_EQ(mechanism.reactions.condensed_phase_photolysis[0].name, "my condensed phase photolysis");
     EXPECT_EQ(mechanism.reactions.condensed_phase_photolysis[0].scaling_factor_, 12.3);
     EXPECT_EQ(mechanism.reactions.condensed_phase_photolysis[0].reactants.size(), 1);
-    EXPECT_EQ(mechanism.reactions.condensed_phase_photolysis[0].reactants[0].species_name, "B");
+    EXPECT_EQ(mechanism.species_symbols.Name(mechanism.reactions.condensed_phase_photolysis[0].reactants[0].species_id), "B");
     EXPECT_EQ(mechanism.reactions.condensed_phase_photolysis[0].reactants[0].coefficient, 1);
     EXPECT_EQ(mechanism.reactions.condensed_phase_photolysis[0].products.size(), 1);
-    EXPECT_EQ(mechanism.reactions.condensed_phase_photolysis[0].products[0].species_name, "C");
+    EXPECT_EQ(mechanism.species_symbols.Name(mechanism.reactions.condensed_phase_photolysis[0].products[0].species_id), "C");
     EXPECT_EQ(mechanism.reactions.condensed_phase_photolysis[0].products[0].coefficient, 1);
     EXPECT_EQ(mechanism.reactions.condensed_phase_photolysis[0].unknown_properties.size(), 1);
     EXPECT_EQ(mechanism.reactions.condensed_phase_photolysis[0].unknown_properties["__comment"], "\"hi\"");
 
-    EXPECT_EQ(mechanism.reactions.condensed_phase_photolysis[1].aerosol_phase, "aqueous aerosol");
-    EXPECT_EQ(mechanism.reactions.condensed_phase_photolysis[1].aerosol_phase_water, "H2O_aq");
+    EXPECT_EQ(mechanism.phase_symbols.Name(mechanism.reactions.condensed_phase_photolysis[1].aerosol_phase), "aqueous aerosol");
+    EXPECT_EQ(mechanism.species_symbols.Name(mechanism.reactions.condensed_phase_photolysis[1].aerosol_phase_water), "H2O_aq");
     EXPECT_EQ(mechanism.reactions.condensed_phase_photolysis[1].scaling_factor_, 1);
     EXPECT_EQ(mechanism.reactions.condensed_phase_photolysis[1].reactants.size(), 1);
-    EXPECT_EQ(mechanism.reactions.condensed_phase_photolysis[1].reactants[0].species_name, "B");
+    EXPECT_EQ(mechanism.species_symbols.Name(mechanism.reactions.condensed_phase_photolysis[1].reactants[0].species_id), "B");
     EXPECT_EQ(mechanism.reactions.condensed_phase_photolysis[1].reactants[0].coefficient, 1.2);
     EXPECT_EQ(mechanism.reactions.condensed_phase_photolysis[1].products.size(), 1);
-    EXPECT_EQ(mechanism.reactions.condensed_phase_photolysis[1].products[0].species_name, "C");
+    EXPECT_EQ(mechanism.species_symbols.Name(mechanism.reactions.condensed_phase_photolysis[1].products[0].species_id), "C");
     EXPECT_EQ(mechanism.reactions.condensed_phase_photolysis[1].products[0].coefficient, 0.2);
   }
 }
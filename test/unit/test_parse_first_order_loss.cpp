@@ -15,19 +15,19 @@ TEST(Parser, CanParseValidFirstOrderLossReaction)
 
     EXPECT_EQ(mechanism.reactions.first_order_loss.size(), 2);
 
-    EXPECT_EQ(mechanism.reactions.first_order_loss[0].gas_phase, "gas");
+    EXPECT_EQ(mechanism.phase_symbols.Name(mechanism.reactions.first_order_loss[0].gas_phase), "gas");
     EXPECT_EQ(mechanism.reactions.first_order_loss[0].name, "my first order loss");
     EXPECT_EQ(mechanism.reactions.first_order_loss[0].scaling_factor, 12.3);
     EXPECT_EQ(mechanism.reactions.first_order_loss[0].reactants.size(), 1);
-    EXPECT_EQ(mechanism.reactions.first_order_loss[0].reactants[0].species_name, "C");
+    EXPECT_EQ(mechanism.species_symbols.Name(mechanism.reactions.first_order_loss[0].reactants[0].species_id), "C");
     EXPECT_EQ(mechanism.reactions.first_order_loss[0].reactants[0].coefficient, 1);
     EXPECT_EQ(mechanism.reactions.first_order_loss[0].unknown_properties.size(), 1);
     EXPECT_EQ(mechanism.reactions.first_order_loss[0].unknown_properties["__comment"], "\"Strawberries are the superior fruit\"");
 
-    EXPECT_EQ(mechanism.reactions.first_order_loss[1].gas_phase, "gas");
+    EXPECT_EQ(mechanism.phase_symbols.Name(mechanism.reactions.first_order_loss[1].gas_phase), "gas");
     EXPECT_EQ(mechanism.reactions.first_order_loss[1].scaling_factor, 1);
     EXPECT_EQ(mechanism.reactions.first_order_loss[1].reactants.size(), 1);
-    EXPECT_EQ(mechanism.reactions.first_order_loss[1].reactants[0].species_name, "C");
+    EXPECT_EQ(mechanism.species_symbols.Name(mechanism.reactions.first_order_loss[1].reactants[0].species_id), "C");
     EXPECT_EQ(mechanism.reactions.first_order_loss[1].reactants[0].coefficient, 1);
   }
 }
@@ -16,20 +16,20 @@ TEST(Parser, CanParseValidHenrysLawReaction)
     EXPECT_EQ(mechanism.reactions.henrys_law.size(), 2);
 
     EXPECT_EQ(mechanism.reactions.henrys_law[0].name, "my henry's law");
-    EXPECT_EQ(mechanism.reactions.henrys_law[0].gas_phase, "gas");
-    EXPECT_EQ(mechanism.reactions.henrys_law[0].gas_phase_species, "A");
-    EXPECT_EQ(mechanism.reactions.henrys_law[0].aerosol_phase, "aqueous aerosol");
-    EXPECT_EQ(mechanism.reactions.henrys_law[0].aerosol_phase_species, "B");
-    EXPECT_EQ(mechanism.reactions.henrys_law[0].aerosol_phase_water, "H2O_aq");
+    EXPECT_EQ(mechanism.phase_symbols.Name(mechanism.reactions.henrys_law[0].gas_phase), "gas");
+    EXPECT_EQ(mechanism.species_symbols.Name(mechanism.reactions.henrys_law[0].gas_phase_species), "A");
+    EXPECT_EQ(mechanism.phase_symbols.Name(mechanism.reactions.henrys_law[0].aerosol_phase), "aqueous aerosol");
+    EXPECT_EQ(mechanism.species_symbols.Name(mechanism.reactions.henrys_law[0].aerosol_phase_species), "B");
+    EXPECT_EQ(mechanism.species_symbols.Name(mechanism.reactions.henrys_law[0].aerosol_phase_water), "H2O_aq");
     EXPECT_EQ(mechanism.reactions.henrys_law[0].unknown_properties.size(), 1);
     EXPECT_EQ(mechanism.reactions.henrys_law[0].unknown_properties["__comment"], "\"hi\"");
 
     EXPECT_EQ(mechanism.reactions.henrys_law[1].name, "");
-    EXPECT_EQ(mechanism.reactions.henrys_law[1].gas_phase, "gas");
-    EXPECT_EQ(mechanism.reactions.henrys_law[1].gas_phase_species, "A");
-    EXPECT_EQ(mechanism.reactions.henrys_law[1].aerosol_phase, "aqueous aerosol");
-    EXPECT_EQ(mechanism.reactions.henrys_law[1].aerosol_phase_species, "B");
-    EXPECT_EQ(mechanism.reactions.henrys_law[1].aerosol_phase_water, "H2O_aq");
+    EXPECT_EQ(mechanism.phase_symbols.Name(mechanism.reactions.henrys_law[1].gas_phase), "gas");
+    EXPECT_EQ(mechanism.species_symbols.Name(mechanism.reactions.henrys_law[1].gas_phase_species), "A");
+    EXPECT_EQ(mechanism.phase_symbols.Name(mechanism.reactions.henrys_law[1].aerosol_phase), "aqueous aerosol");
+    EXPECT_EQ(mechanism.species_symbols.Name(mechanism.reactions.henrys_law[1].aerosol_phase_species), "B");
+    EXPECT_EQ(mechanism.species_symbols.Name(mechanism.reactions.henrys_law[1].aerosol_phase_water), "H2O_aq");
     EXPECT_EQ(mechanism.reactions.henrys_law[1].unknown_properties.size(), 0);
   }
 }
@@ -0,0 +1,148 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <open_atmos/mechanism_configuration/json_reader.hpp>
+#include <open_atmos/mechanism_configuration/parser.hpp>
+#include <sstream>
+
+using namespace open_atmos::mechanism_configuration;
+using namespace open_atmos;
+
+void ExpectSameSymbols(const types::SymbolTable& streamed, const types::SymbolTable& loaded)
+{
+  ASSERT_EQ(streamed.Size(), loaded.Size());
+  for (types::SymbolId id = 0; id < streamed.Size(); ++id)
+  {
+    EXPECT_EQ(streamed.Name(id), loaded.Name(id));
+  }
+}
+
+template<typename Reaction>
+void ExpectSameReactions(const std::vector<Reaction>& streamed, const std::vector<Reaction>& loaded)
+{
+  ASSERT_EQ(streamed.size(), loaded.size());
+  for (std::size_t i = 0; i < streamed.size(); ++i)
+  {
+    EXPECT_EQ(streamed[i].name, loaded[i].name);
+    EXPECT_EQ(streamed[i].unknown_properties, loaded[i].unknown_properties);
+  }
+}
+
+void ExpectSameMechanism(const types::Mechanism& streamed, const types::Mechanism& loaded)
+{
+  EXPECT_EQ(streamed.name, loaded.name);
+  ASSERT_EQ(streamed.species.size(), loaded.species.size());
+  for (std::size_t i = 0; i < streamed.species.size(); ++i)
+  {
+    EXPECT_EQ(streamed.species[i].name, loaded.species[i].name);
+    EXPECT_EQ(streamed.species[i].optional_numerical_properties, loaded.species[i].optional_numerical_properties);
+    EXPECT_EQ(streamed.species[i].unknown_properties, loaded.species[i].unknown_properties);
+  }
+  ASSERT_EQ(streamed.phases.size(), loaded.phases.size());
+  for (std::size_t i = 0; i < streamed.phases.size(); ++i)
+  {
+    EXPECT_EQ(streamed.phases[i].name, loaded.phases[i].name);
+    EXPECT_EQ(streamed.phases[i].species, loaded.phases[i].species);
+    EXPECT_EQ(streamed.phases[i].unknown_properties, loaded.phases[i].unknown_properties);
+  }
+  ExpectSameSymbols(streamed.species_symbols, loaded.species_symbols);
+  ExpectSameSymbols(streamed.phase_symbols, loaded.phase_symbols);
+  ExpectSameReactions(streamed.reactions.arrhenius, loaded.reactions.arrhenius);
+  ExpectSameReactions(streamed.reactions.branched, loaded.reactions.branched);
+  ExpectSameReactions(streamed.reactions.condensed_phase_arrhenius, loaded.reactions.condensed_phase_arrhenius);
+  ExpectSameReactions(streamed.reactions.condensed_phase_photolysis, loaded.reactions.condensed_phase_photolysis);
+  ExpectSameReactions(streamed.reactions.emission, loaded.reactions.emission);
+  ExpectSameReactions(streamed.reactions.first_order_loss, loaded.reactions.first_order_loss);
+  ExpectSameReactions(streamed.reactions.simpol_phase_transfer, loaded.reactions.simpol_phase_transfer);
+  ExpectSameReactions(streamed.reactions.aqueous_equilibrium, loaded.reactions.aqueous_equilibrium);
+  ExpectSameReactions(streamed.reactions.wet_deposition, loaded.reactions.wet_deposition);
+  ExpectSameReactions(streamed.reactions.henrys_law, loaded.reactions.henrys_law);
+  ExpectSameReactions(streamed.reactions.photolysis, loaded.reactions.photolysis);
+  ExpectSameReactions(streamed.reactions.surface, loaded.reactions.surface);
+  ExpectSameReactions(streamed.reactions.troe, loaded.reactions.troe);
+  ExpectSameReactions(streamed.reactions.tunneling, loaded.reactions.tunneling);
+}
+
+TEST(JsonStream, MatchesDocumentParserForAllConfigurations)
+{
+  Parser parser;
+  std::vector<std::filesystem::path> paths = { "examples/full_configuration.json" };
+  for (const auto& entry : std::filesystem::recursive_directory_iterator("unit_configs"))
+  {
+    if (entry.path().extension() == ".json")
+    {
+      paths.push_back(entry.path());
+    }
+  }
+
+  for (const auto& path : paths)
+  {
+    SCOPED_TRACE(path.string());
+    auto [streamed_status, streamed] = parser.Parse(path);
+    auto [loaded_status, loaded] = parser.Parse(YAML::LoadFile(path.string()));
+
+    EXPECT_EQ(streamed_status, loaded_status);
+    ExpectSameMechanism(streamed, loaded);
+  }
+}
+
+TEST(JsonStream, ParsesSectionsInAnyOrder)
+{
+  Parser parser;
+  auto [status, mechanism] = parser.Parse(std::string("unit_configs/json_stream/out_of_order.json"));
+
+  EXPECT_EQ(status, ConfigParseStatus::Success);
+  EXPECT_EQ(mechanism.name, "Out of order");
+  EXPECT_EQ(mechanism.species.size(), 2);
+  EXPECT_EQ(mechanism.species[0].unknown_properties["__note"], "{\"source\": \"test é\", \"values\": [\"1\", \"2.5\", \"true\", ~]}");
+  EXPECT_EQ(mechanism.species[1].optional_numerical_properties["molecular weight [kg mol-1]"], 0.025);
+  EXPECT_EQ(mechanism.phases.size(), 1);
+  EXPECT_EQ(mechanism.reactions.arrhenius.size(), 1);
+  EXPECT_EQ(mechanism.reactions.arrhenius[0].A, 32.1);
+  EXPECT_EQ(mechanism.reactions.arrhenius[0].C, -4.5e3);
+  EXPECT_EQ(mechanism.reactions.arrhenius[0].products[0].coefficient, 1.2);
+  EXPECT_EQ(mechanism.reactions.arrhenius[0].unknown_properties["__solver_param"], "\"0.1\"");
+}
+
+TEST(JsonStream, FallsBackToYamlForNonStrictJson)
+{
+  Parser parser;
+  auto [status, mechanism] = parser.Parse(std::string("unit_configs/json_stream/not_strict.json"));
+
+  EXPECT_EQ(status, ConfigParseStatus::Success);
+  EXPECT_EQ(mechanism.species.size(), 2);
+  EXPECT_EQ(mechanism.reactions.photolysis.size(), 1);
+}
+
+TEST(JsonReader, BuildsNodesFromEvents)
+{
+  std::istringstream input(R"({"a": [1, -2.5e-3, "x\"\u00e9\ud83d\ude00"], "b": {"c": false, "d": null}, "e": {}})");
+  JsonReader reader(input);
+  JsonNodeBuilder builder;
+  reader.Read(builder);
+
+  ASSERT_TRUE(builder.Complete());
+  YAML::Node node = builder.Take();
+  EXPECT_FALSE(builder.Complete());
+  EXPECT_EQ(node["a"].size(), 3);
+  EXPECT_EQ(node["a"][0].as<int>(), 1);
+  EXPECT_EQ(node["a"][1].as<double>(), -2.5e-3);
+  EXPECT_EQ(node["a"][2].as<std::string>(), "x\"\xC3\xA9\xF0\x9F\x98\x80");
+  EXPECT_FALSE(node["b"]["c"].as<bool>());
+  EXPECT_TRUE(node["b"]["d"].IsNull());
+  EXPECT_TRUE(node["e"].IsMap());
+  EXPECT_EQ(node["e"].size(), 0);
+}
+
+TEST(JsonReader, RejectsMalformedInput)
+{
+  std::vector<std::string> documents = { "{\"a\": 1,}", "[1 2]", "{\"a\" 1}", "01", "\"unterminated", "{} []", "tru", "{\"a\": .5}" };
+  for (const auto& document : documents)
+  {
+    SCOPED_TRACE(document);
+    std::istringstream input(document);
+    JsonReader reader(input);
+    JsonNodeBuilder builder;
+    EXPECT_THROW(reader.Read(builder), YAML::ParserException);
+  }
+}
@@ -15,25 +15,25 @@ TEST(Parser, CanParseValidPhotolysisReaction)
 
     EXPECT_EQ(mechanism.reactions.photolysis.size(), 2);
 
-    EXPECT_EQ(mechanism.reactions.photolysis[0].gas_phase, "gas");
+    EXPECT_EQ(mechanism.phase_symbols.Name(mechanism.reactions.photolysis[0].gas_phase), "gas");
     EXPECT_EQ(mechanism.reactions.photolysis[0].name, "my photolysis");
     EXPECT_EQ(mechanism.reactions.photolysis[0].scaling_factor, 12.3);
     EXPECT_EQ(mechanism.reactions.photolysis[0].reactants.size(), 1);
-    EXPECT_EQ(mechanism.reactions.photolysis[0].reactants[0].species_name, "B");
+    EXPECT_EQ(mechanism.species_symbols.Name(mechanism.reactions.photolysis[0].reactants[0].species_id), "B");
     EXPECT_EQ(mechanism.reactions.photolysis[0].reactants[0].coefficient, 1);
     EXPECT_EQ(mechanism.reactions.photolysis[0].products.size(), 1);
-    EXPECT_EQ(mechanism.reactions.photolysis[0].products[0].species_name, "C");
+    EXPECT_EQ(mechanism.species_symbols.Name(mechanism.reactions.photolysis[0].products[0].species_id), "C");
     EXPECT_EQ(mechanism.reactions.photolysis[0].products[0].coefficient, 1);
     EXPECT_EQ(mechanism.reactions.photolysis[0].unknown_properties.size(), 1);
     EXPECT_EQ(mechanism.reactions.photolysis[0].unknown_properties["__comment"], "\"hi\"");
 
-    EXPECT_EQ(mechanism.reactions.photolysis[1].gas_phase, "gas");
+    EXPECT_EQ(mechanism.phase_symbols.Name(mechanism.reactions.photolysis[1].gas_phase), "gas");
     EXPECT_EQ(mechanism.reactions.photolysis[1].scaling_factor, 1);
     EXPECT_EQ(mechanism.reactions.photolysis[1].reactants.size(), 1);
-    EXPECT_EQ(mechanism.reactions.photolysis[1].reactants[0].species_name, "B");
+    EXPECT_EQ(mechanism.species_symbols.Name(mechanism.reactions.photolysis[1].reactants[0].species_id), "B");
     EXPECT_EQ(mechanism.reactions.photolysis[1].reactants[0].coefficient, 1.2);
     EXPECT_EQ(mechanism.reactions.photolysis[1].products.size(), 1);
-    EXPECT_EQ(mechanism.reactions.photolysis[1].products[0].species_name, "C");
+    EXPECT_EQ(mechanism.species_symbols.Name(mechanism.reactions.photolysis[1].products[0].species_id), "C");
     EXPECT_EQ(mechanism.reactions.photolysis[1].products[0].coefficient, 0.2);
   }
 }
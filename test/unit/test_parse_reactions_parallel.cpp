@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <open_atmos/mechanism_configuration/parser.hpp>
+#include <open_atmos/mechanism_configuration/serialization.hpp>
+#include <sstream>
+#include <string>
+
+using namespace open_atmos::mechanism_configuration;
+using namespace open_atmos;
+
+namespace
+{
+  /// @brief A JSON mechanism with enough reactions to be split across threads. The reaction at position bad_reaction
+  ///        refers to an unknown species and the one at unknown_type has an unsupported type.
+  std::string BuildMechanism(std::size_t number_of_reactions, std::size_t bad_reaction = -1, std::size_t unknown_type = -1)
+  {
+    const std::size_t number_of_species = 50;
+    std::ostringstream json;
+    json << R"({"version": "1.0.0", "name": "parallel", "species": [)";
+    for (std::size_t i = 0; i < number_of_species; ++i)
+    {
+      json << (i ? ", " : "") << R"({"name": "S)" << i << R"("})";
+    }
+    json << R"(], "phases": [{"name": "gas", "species": [)";
+    for (std::size_t i = 0; i < number_of_species; ++i)
+    {
+      json << (i ? ", " : "") << R"("S)" << i << R"(")";
+    }
+    json << R"(]}], "reactions": [)";
+    for (std::size_t i = 0; i < number_of_reactions; ++i)
+    {
+      std::string type = i == unknown_type ? "NOT_A_TYPE" : (i % 3 == 0 ? "TROE" : "ARRHENIUS");
+      std::string reactant = i == bad_reaction ? "UNKNOWN" : "S" + std::to_string(i % number_of_species);
+      json << (i ? ", " : "") << R"({"type": ")" << type << R"(", "gas phase": "gas", "name": "R)" << i << R"(", )"
+           << (type == "TROE" ? R"("k0_A": )" : R"("A": )") << i + 1 << R"(, "reactants": [{"species name": ")" << reactant
+           << R"("}], "products": [{"species name": "S)" << (i * 7) % number_of_species << R"(", "coefficient": 0.5}]})";
+    }
+    json << "]}";
+    return json.str();
+  }
+
+  std::pair<ConfigParseStatus, types::Mechanism> ParseJson(const std::string& json, std::size_t number_of_threads)
+  {
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "parse_reactions_parallel.json";
+    {
+      std::ofstream file(path);
+      file << json;
+    }
+    Parser parser;
+    parser.SetNumberOfThreads(number_of_threads);
+    auto result = parser.Parse(path);
+    std::filesystem::remove(path);
+    return result;
+  }
+
+  std::pair<ConfigParseStatus, types::Mechanism> ParseYaml(const std::string& json, std::size_t number_of_threads)
+  {
+    Parser parser;
+    parser.SetNumberOfThreads(number_of_threads);
+    return parser.Parse(YAML::Load(json));
+  }
+}  // namespace
+
+TEST(ParseReactionsParallel, MatchesTheSerialParse)
+{
+  const std::string json = BuildMechanism(1000);
+  for (auto parse : { ParseJson, ParseYaml })
+  {
+    auto [serial_status, serial] = parse(json, 1);
+    ASSERT_EQ(serial_status, ConfigParseStatus::Success);
+    EXPECT_EQ(serial.reactions.arrhenius.size() + serial.reactions.troe.size(), 1000);
+
+    for (std::size_t threads : { 2, 3, 8 })
+    {
+      auto [status, mechanism] = parse(json, threads);
+      ASSERT_EQ(status, ConfigParseStatus::Success);
+      EXPECT_EQ(Serialize(mechanism), Serialize(serial));
+    }
+  }
+}
+
+TEST(ParseReactionsParallel, StopsWhereTheSerialParseStops)
+{
+  // the failure is in the second half, so threads that started after it must not contribute reactions
+  const std::string json = BuildMechanism(1000, 600);
+  for (auto parse : { ParseJson, ParseYaml })
+  {
+    auto [serial_status, serial] = parse(json, 1);
+    EXPECT_EQ(serial_status, ConfigParseStatus::ReactionRequiresUnknownSpecies);
+
+    auto [status, mechanism] = parse(json, 4);
+    EXPECT_EQ(status, serial_status);
+    EXPECT_EQ(Serialize(mechanism), Serialize(serial));
+  }
+}
+
+TEST(ParseReactionsParallel, ReportsTheFirstProblemInDocumentOrder)
+{
+  // a failure before an unknown type stops the parse before the unknown type is reached
+  const std::string failure_first = BuildMechanism(1000, 100, 900);
+  EXPECT_EQ(ParseYaml(failure_first, 1).first, ConfigParseStatus::ReactionRequiresUnknownSpecies);
+  EXPECT_EQ(ParseYaml(failure_first, 4).first, ConfigParseStatus::ReactionRequiresUnknownSpecies);
+
+  const std::string unknown_type_first = BuildMechanism(1000, 900, 100);
+  EXPECT_EQ(ParseYaml(unknown_type_first, 1).first, ConfigParseStatus::ObjectTypeNotFound);
+  EXPECT_EQ(ParseYaml(unknown_type_first, 4).first, ConfigParseStatus::ObjectTypeNotFound);
+}
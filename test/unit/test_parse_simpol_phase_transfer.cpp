@@ -16,10 +16,10 @@ TEST(Parser, CanParseValidSimpolPhaseTransferReaction)
     EXPECT_EQ(mechanism.reactions.simpol_phase_transfer.size(), 2);
 
     EXPECT_EQ(mechanism.reactions.simpol_phase_transfer[0].name, "my simpol");
-    EXPECT_EQ(mechanism.reactions.simpol_phase_transfer[0].gas_phase, "gas");
-    EXPECT_EQ(mechanism.reactions.simpol_phase_transfer[0].gas_phase_species.species_name, "A");
-    EXPECT_EQ(mechanism.reactions.simpol_phase_transfer[0].aerosol_phase, "aerosol");
-    EXPECT_EQ(mechanism.reactions.simpol_phase_transfer[0].aerosol_phase_species.species_name, "B");
+    EXPECT_EQ(mechanism.phase_symbols.Name(mechanism.reactions.simpol_phase_transfer[0].gas_phase), "gas");
+    EXPECT_EQ(mechanism.species_symbols.Name(mechanism.reactions.simpol_phase_transfer[0].gas_phase_species.species_id), "A");
+    EXPECT_EQ(mechanism.phase_symbols.Name(mechanism.reactions.simpol_phase_transfer[0].aerosol_phase), "aerosol");
+    EXPECT_EQ(mechanism.species_symbols.Name(mechanism.reactions.simpol_phase_transfer[0].aerosol_phase_species.species_id), "B");
     EXPECT_EQ(mechanism.reactions.simpol_phase_transfer[0].B[0], -1.97e3);
     EXPECT_EQ(mechanism.reactions.simpol_phase_transfer[0].B[1], 2.91e0);
     EXPECT_EQ(mechanism.reactions.simpol_phase_transfer[0].B[2], 1.96e-3);
@@ -28,10 +28,10 @@ TEST(Parser, CanParseValidSimpolPhaseTransferReaction)
     EXPECT_EQ(mechanism.reactions.simpol_phase_transfer[0].unknown_properties["__comment"], "\"cereal is also soup\"");
 
     EXPECT_EQ(mechanism.reactions.simpol_phase_transfer[1].name, "");
-    EXPECT_EQ(mechanism.reactions.simpol_phase_transfer[1].gas_phase, "gas");
-    EXPECT_EQ(mechanism.reactions.simpol_phase_transfer[1].gas_phase_species.species_name, "A");
-    EXPECT_EQ(mechanism.reactions.simpol_phase_transfer[1].aerosol_phase, "aerosol");
-    EXPECT_EQ(mechanism.reactions.simpol_phase_transfer[1].aerosol_phase_species.species_name, "B");
+    EXPECT_EQ(mechanism.phase_symbols.Name(mechanism.reactions.simpol_phase_transfer[1].gas_phase), "gas");
+    EXPECT_EQ(mechanism.species_symbols.Name(mechanism.reactions.simpol_phase_transfer[1].gas_phase_species.species_id), "A");
+    EXPECT_EQ(mechanism.phase_symbols.Name(mechanism.reactions.simpol_phase_transfer[1].aerosol_phase), "aerosol");
+    EXPECT_EQ(mechanism.species_symbols.Name(mechanism.reactions.simpol_phase_transfer[1].aerosol_phase_species.species_id), "B");
     EXPECT_EQ(mechanism.reactions.simpol_phase_transfer[1].B[0], -1.97e3);
     EXPECT_EQ(mechanism.reactions.simpol_phase_transfer[1].B[1], 2.91e0);
     EXPECT_EQ(mechanism.reactions.simpol_phase_transfer[1].B[2], 1.96e-3);
@@ -73,4 +73,27 @@ TEST(Parser, DetectsInvalidKeys)
 
     EXPECT_EQ(status, ConfigParseStatus::InvalidKey);
   }
-}
\ No newline at end of file
+}
+
+TEST(Parser, FindsEveryDuplicateName)
+{
+  auto named = [](const std::vector<std::string>& names)
+  {
+    std::vector<open_atmos::types::Species> species(names.size());
+    for (std::size_t i = 0; i < names.size(); ++i)
+      species[i].name = names[i];
+    return species;
+  };
+  std::vector<open_atmos::types::Species> species = named({ "A", "B", "A", "C", "B", "A", "D" });
+
+  auto duplicates = FindDuplicateObjectsByName(species);
+
+  ASSERT_EQ(duplicates.size(), 2);
+  EXPECT_EQ(duplicates[0].name, "A");
+  EXPECT_EQ(duplicates[0].positions, (std::vector<std::size_t>{ 0, 2, 5 }));
+  EXPECT_EQ(duplicates[1].name, "B");
+  EXPECT_EQ(duplicates[1].positions, (std::vector<std::size_t>{ 1, 4 }));
+
+  std::vector<open_atmos::types::Species> unique_species = named({ "A", "B", "C" });
+  EXPECT_TRUE(FindDuplicateObjectsByName(unique_species).empty());
+}
@@ -15,31 +15,31 @@ TEST(Parser, CanParseValidSurfaceReaction)
 
     EXPECT_EQ(mechanism.reactions.surface.size(), 2);
 
-    EXPECT_EQ(mechanism.reactions.surface[0].gas_phase, "gas");
+    EXPECT_EQ(mechanism.phase_symbols.Name(mechanism.reactions.surface[0].gas_phase), "gas");
     EXPECT_EQ(mechanism.reactions.surface[0].name, "my surface");
-    EXPECT_EQ(mechanism.reactions.surface[0].aerosol_phase, "surface reacting phase");
+    EXPECT_EQ(mechanism.phase_symbols.Name(mechanism.reactions.surface[0].aerosol_phase), "surface reacting phase");
     EXPECT_EQ(mechanism.reactions.surface[0].reaction_probability, 2.0e-2);
-    EXPECT_EQ(mechanism.reactions.surface[0].gas_phase_species.species_name, "A");
+    EXPECT_EQ(mechanism.species_symbols.Name(mechanism.reactions.surface[0].gas_phase_species.species_id), "A");
     EXPECT_EQ(mechanism.reactions.surface[0].gas_phase_species.coefficient, 1);
     EXPECT_EQ(mechanism.reactions.surface[0].gas_phase_products.size(), 2);
-    EXPECT_EQ(mechanism.reactions.surface[0].gas_phase_products[0].species_name, "B");
+    EXPECT_EQ(mechanism.species_symbols.Name(mechanism.reactions.surface[0].gas_phase_products[0].species_id), "B");
     EXPECT_EQ(mechanism.reactions.surface[0].gas_phase_products[0].coefficient, 1);
-    EXPECT_EQ(mechanism.reactions.surface[0].gas_phase_products[1].species_name, "C");
+    EXPECT_EQ(mechanism.species_symbols.Name(mechanism.reactions.surface[0].gas_phase_products[1].species_id), "C");
     EXPECT_EQ(mechanism.reactions.surface[0].gas_phase_products[1].coefficient, 1);
     EXPECT_EQ(mechanism.reactions.surface[0].unknown_properties.size(), 1);
     EXPECT_EQ(mechanism.reactions.surface[0].unknown_properties["__comment"], "\"key lime pie is superior to all other pies\"");
 
-    EXPECT_EQ(mechanism.reactions.surface[1].gas_phase, "gas");
-    EXPECT_EQ(mechanism.reactions.surface[1].aerosol_phase, "surface reacting phase");
+    EXPECT_EQ(mechanism.phase_symbols.Name(mechanism.reactions.surface[1].gas_phase), "gas");
+    EXPECT_EQ(mechanism.phase_symbols.Name(mechanism.reactions.surface[1].aerosol_phase), "surface reacting phase");
     EXPECT_EQ(mechanism.reactions.surface[1].reaction_probability, 1.0);
-    EXPECT_EQ(mechanism.reactions.surface[1].gas_phase_species.species_name, "A");
+    EXPECT_EQ(mechanism.species_symbols.Name(mechanism.reactions.surface[1].gas_phase_species.species_id), "A");
     EXPECT_EQ(mechanism.reactions.surface[1].gas_phase_species.coefficient, 1);
     EXPECT_EQ(mechanism.reactions.surface[1].gas_phase_products.size(), 2);
-    EXPECT_EQ(mechanism.reactions.surface[1].gas_phase_products[0].species_name, "B");
+    EXPECT_EQ(mechanism.species_symbols.Name(mechanism.reactions.surface[1].gas_phase_products[0].species_id), "B");
     EXPECT_EQ(mechanism.reactions.surface[1].gas_phase_products[0].coefficient, 1);
     EXPECT_EQ(mechanism.reactions.surface[1].gas_phase_products[0].unknown_properties.size(), 1);
     EXPECT_EQ(mechanism.reactions.surface[1].gas_phase_products[0].unknown_properties["__optional thing"], "\"hello\"");
-    EXPECT_EQ(mechanism.reactions.surface[1].gas_phase_products[1].species_name, "C");
+    EXPECT_EQ(mechanism.species_symbols.Name(mechanism.reactions.surface[1].gas_phase_products[1].species_id), "C");
     EXPECT_EQ(mechanism.reactions.surface[1].gas_phase_products[1].coefficient, 1);
   }
 }
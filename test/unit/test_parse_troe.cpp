@@ -15,7 +15,7 @@ TEST(Parser, CanParseValidTroeReaction)
 
     EXPECT_EQ(mechanism.reactions.troe.size(), 2);
 
-    EXPECT_EQ(mechanism.reactions.troe[0].gas_phase, "gas");
+    EXPECT_EQ(mechanism.phase_symbols.Name(mechanism.reactions.troe[0].gas_phase), "gas");
     EXPECT_EQ(mechanism.reactions.troe[0].k0_A, 1.0);
     EXPECT_EQ(mechanism.reactions.troe[0].k0_B, 0.0);
     EXPECT_EQ(mechanism.reactions.troe[0].k0_C, 0.0);
@@ -25,10 +25,10 @@ TEST(Parser, CanParseValidTroeReaction)
     EXPECT_EQ(mechanism.reactions.troe[0].Fc, 0.6);
     EXPECT_EQ(mechanism.reactions.troe[0].N, 1.0);
     EXPECT_EQ(mechanism.reactions.troe[0].reactants.size(), 1);
-    EXPECT_EQ(mechanism.reactions.troe[0].reactants[0].species_name, "A");
+    EXPECT_EQ(mechanism.species_symbols.Name(mechanism.reactions.troe[0].reactants[0].species_id), "A");
     EXPECT_EQ(mechanism.reactions.troe[0].reactants[0].coefficient, 1);
     EXPECT_EQ(mechanism.reactions.troe[0].products.size(), 1);
-    EXPECT_EQ(mechanism.reactions.troe[0].products[0].species_name, "C");
+    EXPECT_EQ(mechanism.species_symbols.Name(mechanism.reactions.troe[0].products[0].species_id), "C");
     EXPECT_EQ(mechanism.reactions.troe[0].products[0].coefficient, 1);
     EXPECT_EQ(mechanism.reactions.troe[0].unknown_properties.size(), 1);
     if (extension == ".json")
@@ -41,7 +41,7 @@ TEST(Parser, CanParseValidTroeReaction)
     }
 
     EXPECT_EQ(mechanism.reactions.troe[1].name, "my troe");
-    EXPECT_EQ(mechanism.reactions.troe[1].gas_phase, "gas");
+    EXPECT_EQ(mechanism.phase_symbols.Name(mechanism.reactions.troe[1].gas_phase), "gas");
     EXPECT_EQ(mechanism.reactions.troe[1].k0_A, 32.1);
     EXPECT_EQ(mechanism.reactions.troe[1].k0_B, -2.3);
     EXPECT_EQ(mechanism.reactions.troe[1].k0_C, 102.3);
@@ -51,14 +51,14 @@ TEST(Parser, CanParseValidTroeReaction)
     EXPECT_EQ(mechanism.reactions.troe[1].Fc, 1.3);
     EXPECT_EQ(mechanism.reactions.troe[1].N, 32.1);
     EXPECT_EQ(mechanism.reactions.troe[1].reactants.size(), 1);
-    EXPECT_EQ(mechanism.reactions.troe[1].reactants[0].species_name, "C");
+    EXPECT_EQ(mechanism.species_symbols.Name(mechanism.reactions.troe[1].reactants[0].species_id), "C");
     EXPECT_EQ(mechanism.reactions.troe[1].reactants[0].coefficient, 1);
     EXPECT_EQ(mechanism.reactions.troe[1].products.size(), 2);
-    EXPECT_EQ(mechanism.reactions.troe[1].products[0].species_name, "A");
+    EXPECT_EQ(mechanism.species_symbols.Name(mechanism.reactions.troe[1].products[0].species_id), "A");
     EXPECT_EQ(mechanism.reactions.troe[1].products[0].coefficient, 0.2);
     EXPECT_EQ(mechanism.reactions.troe[1].products[0].unknown_properties.size(), 1);
     EXPECT_EQ(mechanism.reactions.troe[1].products[0].unknown_properties["__optional thing"], "\"hello\"");
-    EXPECT_EQ(mechanism.reactions.troe[1].products[1].species_name, "B");
+    EXPECT_EQ(mechanism.species_symbols.Name(mechanism.reactions.troe[1].products[1].species_id), "B");
     EXPECT_EQ(mechanism.reactions.troe[1].products[1].coefficient, 1.2);
     EXPECT_EQ(mechanism.reactions.troe[1].products[1].unknown_properties.size(), 0);
   }
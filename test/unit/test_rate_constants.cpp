@@ -0,0 +1,552 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <open_atmos/constants.hpp>
+#include <open_atmos/mechanism_configuration/compiled_mechanism.hpp>
+#include <open_atmos/mechanism_configuration/conversions.hpp>
+#include <open_atmos/mechanism_configuration/rate_constants.hpp>
+#include <open_atmos/mechanism_configuration/validation.hpp>
+#include <tuple>
+#include <vector>
+
+using namespace open_atmos::mechanism_configuration;
+using namespace open_atmos;
+
+namespace
+{
+  // more cells than fit in one block, so the last block is partial
+  constexpr std::size_t number_of_cells = 2 * rate_constants::cell_block_size + 13;
+
+  std::vector<double> Temperatures()
+  {
+    std::vector<double> temperature;
+    for (std::size_t c = 0; c < number_of_cells; ++c)
+    {
+      temperature.push_back(200.0 + 0.9 * c);
+    }
+    return temperature;
+  }
+
+  std::vector<double> Pressures()
+  {
+    std::vector<double> pressure;
+    for (std::size_t c = 0; c < number_of_cells; ++c)
+    {
+      pressure.push_back(1.0e4 + 700.0 * c);
+    }
+    return pressure;
+  }
+
+  /// @brief The Branched structure term, with [M] in molecules cm-3
+  double WennbergA(double T, double M, int n)
+  {
+    double k0_M = 2.0e-22 * std::exp(n) * M;
+    double kinf = 0.43 * std::pow(T / 298.0, -8.0);
+    return k0_M / (1.0 + k0_M / kinf) * std::pow(0.41, 1.0 / (1.0 + std::pow(std::log10(k0_M / kinf), 2)));
+  }
+
+  /// @brief Species concentrations laid out species by species, with every species at 1e-3 mol m-3 except the aerosol
+  ///        water, which varies from cell to cell
+  std::vector<double> Concentrations(std::size_t number_of_species, std::size_t water)
+  {
+    std::vector<double> concentrations(number_of_species * number_of_cells, 1.0e-3);
+    for (std::size_t c = 0; c < number_of_cells; ++c)
+    {
+      concentrations[water * number_of_cells + c] = 1.0e-4 * (1.0 + c);
+    }
+    return concentrations;
+  }
+
+  void ExpectRelativelyNear(double actual, double expected)
+  {
+    EXPECT_NEAR(actual, expected, 1e-12 * std::abs(expected));
+  }
+}  // namespace
+
+TEST(RateConstants, EvaluatesArrhenius)
+{
+  types::Mechanism mechanism;
+  types::Arrhenius arrhenius;
+  for (auto [A, B, C, D, E] : { std::array<double, 5>{ 1.0e-12, 0.0, 0.0, 300.0, 0.0 },
+                                std::array<double, 5>{ 3.3e-11, -1.5, -250.0, 300.0, 0.0 },
+                                std::array<double, 5>{ 2.0e-14, 2.3, 410.0, 273.15, 1.0e-6 } })
+  {
+    arrhenius.A = A;
+    arrhenius.B = B;
+    arrhenius.C = C;
+    arrhenius.D = D;
+    arrhenius.E = E;
+    mechanism.reactions.arrhenius.push_back(arrhenius);
+  }
+  types::CondensedPhaseArrhenius condensed;
+  condensed.A = 4.2e3;
+  condensed.B = 0.5;
+  condensed.C = -1200.0;
+  condensed.D = 298.0;
+  condensed.E = 2.0e-5;
+  mechanism.reactions.condensed_phase_arrhenius.push_back(condensed);
+  CompiledMechanism compiled = Compile(mechanism);
+
+  std::vector<double> temperature = Temperatures();
+  std::vector<double> pressure = Pressures();
+  for (const compiled::ArrheniusParameters* parameters : { &compiled.arrhenius, &compiled.condensed_phase_arrhenius })
+  {
+    rate_constants::Arrhenius reactions = rate_constants::PrepareArrhenius(*parameters);
+    ASSERT_EQ(reactions.Size(), parameters->A.size());
+    std::vector<double> k;
+    rate_constants::Evaluate(reactions, { temperature.data(), number_of_cells }, { pressure.data(), number_of_cells }, k);
+    ASSERT_EQ(k.size(), reactions.Size() * number_of_cells);
+    for (std::size_t i = 0; i < reactions.Size(); ++i)
+    {
+      for (std::size_t c = 0; c < number_of_cells; ++c)
+      {
+        double T = temperature[c];
+        double expected = parameters->A[i] * std::exp(parameters->C[i] / T) * std::pow(T / parameters->D[i], parameters->B[i]) *
+                          (1.0 + parameters->E[i] * pressure[c]);
+        ExpectRelativelyNear(k[i * number_of_cells + c], expected);
+      }
+    }
+  }
+}
+
+TEST(RateConstants, HandlesEmptyBatches)
+{
+  rate_constants::Arrhenius reactions = rate_constants::PrepareArrhenius(Compile(types::Mechanism{}).arrhenius);
+  std::vector<double> temperature = Temperatures();
+  std::vector<double> k(5, 1.0);
+  rate_constants::Evaluate(reactions, { temperature.data(), number_of_cells }, { temperature.data(), number_of_cells }, k);
+  EXPECT_TRUE(k.empty());
+
+  types::Mechanism mechanism;
+  mechanism.reactions.arrhenius.emplace_back();
+  rate_constants::Evaluate(rate_constants::PrepareArrhenius(Compile(mechanism).arrhenius), {}, {}, k);
+  EXPECT_TRUE(k.empty());
+}
+
+TEST(RateConstants, EvaluatesTroe)
+{
+  types::Mechanism mechanism;
+  types::Troe troe;
+  mechanism.reactions.troe.push_back(troe);
+  troe.k0_A = 6.9e-31;
+  troe.k0_B = -1.0;
+  troe.k0_C = 0.0;
+  troe.kinf_A = 2.6e-11;
+  troe.kinf_B = 0.0;
+  troe.kinf_C = 0.0;
+  mechanism.reactions.troe.push_back(troe);
+  troe.k0_A = 1.8e-30;
+  troe.k0_B = -3.0;
+  troe.k0_C = 25.0;
+  troe.kinf_A = 2.8e-11;
+  troe.kinf_B = 0.5;
+  troe.kinf_C = -30.0;
+  troe.Fc = 0.35;
+  troe.N = 1.33;
+  mechanism.reactions.troe.push_back(troe);
+  const compiled::TroeParameters parameters = Compile(mechanism).troe;
+
+  std::vector<double> temperature = Temperatures();
+  std::vector<double> air_density;
+  for (std::size_t c = 0; c < number_of_cells; ++c)
+  {
+    air_density.push_back(40.0 * (0.1 + 0.01 * c));  // mol m-3
+  }
+  rate_constants::Troe reactions = rate_constants::PrepareTroe(parameters);
+  ASSERT_EQ(reactions.Size(), 3);
+  std::vector<double> k;
+  rate_constants::Evaluate(reactions, { temperature.data(), number_of_cells }, { air_density.data(), number_of_cells }, k);
+  ASSERT_EQ(k.size(), 3 * number_of_cells);
+  for (std::size_t i = 0; i < reactions.Size(); ++i)
+  {
+    for (std::size_t c = 0; c < number_of_cells; ++c)
+    {
+      double T = temperature[c];
+      double M = air_density[c] * MolesM3ToMoleculesCm3;
+      double k0 = parameters.k0_A[i] * std::exp(parameters.k0_C[i] / T) * std::pow(T / 300.0, parameters.k0_B[i]);
+      double kinf = parameters.kinf_A[i] * std::exp(parameters.kinf_C[i] / T) * std::pow(T / 300.0, parameters.kinf_B[i]);
+      double expected = k0 * M / (1.0 + k0 * M / kinf) *
+                        std::pow(parameters.Fc[i], 1.0 / (1.0 + std::pow(std::log10(k0 * M / kinf), 2) / parameters.N[i]));
+      ExpectRelativelyNear(k[i * number_of_cells + c], expected);
+    }
+  }
+}
+
+TEST(RateConstants, EvaluatesBothBranchesOfBranched)
+{
+  types::Mechanism mechanism;
+  for (auto [X, Y, a0, n] : { std::tuple{ 2.7e-12, -360.0, 0.15, 4 }, std::tuple{ 1.0e-11, 0.0, 0.01, 9 } })
+  {
+    types::Branched branched{};
+    branched.X = X;
+    branched.Y = Y;
+    branched.a0 = a0;
+    branched.n = n;
+    mechanism.reactions.branched.push_back(branched);
+  }
+  const compiled::BranchedParameters parameters = Compile(mechanism).branched;
+
+  std::vector<double> temperature = Temperatures();
+  std::vector<double> air_density;
+  for (std::size_t c = 0; c < number_of_cells; ++c)
+  {
+    air_density.push_back(5.0 + 0.3 * c);  // mol m-3
+  }
+  rate_constants::Branched reactions = rate_constants::PrepareBranched(parameters);
+  ASSERT_EQ(reactions.Size(), 2);
+  std::vector<double> nitrate;
+  std::vector<double> alkoxy;
+  rate_constants::Evaluate(reactions, { temperature.data(), number_of_cells }, { air_density.data(), number_of_cells }, nitrate, alkoxy);
+  ASSERT_EQ(nitrate.size(), 2 * number_of_cells);
+  ASSERT_EQ(alkoxy.size(), 2 * number_of_cells);
+  for (std::size_t i = 0; i < reactions.Size(); ++i)
+  {
+    double Z = WennbergA(293.0, 2.45e19, parameters.n[i]) * (1.0 - parameters.a0[i]) / parameters.a0[i];
+    for (std::size_t c = 0; c < number_of_cells; ++c)
+    {
+      double T = temperature[c];
+      double A = WennbergA(T, air_density[c] * MolesM3ToMoleculesCm3, parameters.n[i]);
+      double k = parameters.X[i] * std::exp(-parameters.Y[i] / T);
+      ExpectRelativelyNear(nitrate[i * number_of_cells + c], k * A / (A + Z));
+      ExpectRelativelyNear(alkoxy[i * number_of_cells + c], k * Z / (Z + A));
+    }
+  }
+}
+
+TEST(RateConstants, EvaluatesTunneling)
+{
+  types::Mechanism mechanism;
+  for (auto [A, B, C] : { std::tuple{ 1.0, 0.0, 0.0 }, std::tuple{ 2.9e-12, 345.0, 0.0 }, std::tuple{ 3.1e7, 8014.0, 1.0e8 } })
+  {
+    types::Tunneling tunneling;
+    tunneling.A = A;
+    tunneling.B = B;
+    tunneling.C = C;
+    mechanism.reactions.tunneling.push_back(tunneling);
+  }
+  const compiled::TunnelingParameters parameters = Compile(mechanism).tunneling;
+
+  std::vector<double> temperature = Temperatures();
+  rate_constants::Tunneling reactions = rate_constants::PrepareTunneling(parameters);
+  ASSERT_EQ(reactions.Size(), 3);
+  std::vector<double> k;
+  rate_constants::Evaluate(reactions, { temperature.data(), number_of_cells }, k);
+  ASSERT_EQ(k.size(), 3 * number_of_cells);
+  for (std::size_t i = 0; i < reactions.Size(); ++i)
+  {
+    for (std::size_t c = 0; c < number_of_cells; ++c)
+    {
+      double T = temperature[c];
+      double expected = parameters.A[i] * std::exp(-parameters.B[i] / T) * std::exp(parameters.C[i] / std::pow(T, 3));
+      ExpectRelativelyNear(k[i * number_of_cells + c], expected);
+    }
+  }
+}
+
+TEST(RateConstants, EvaluatesSurface)
+{
+  types::Mechanism mechanism;
+  mechanism.species.push_back({ "N2O5", {}, {} });
+  mechanism.species.push_back({ "HNO3", {}, {} });
+  mechanism.species.push_back({ "HO2", {}, {} });
+  mechanism.species[0].optional_numerical_properties = { { validation::keys.diffusion_coefficient, 1.0e-5 },
+                                                         { validation::keys.molecular_weight, 0.108 } };
+  mechanism.species[2].optional_numerical_properties = { { validation::keys.diffusion_coefficient, 2.5e-5 },
+                                                         { validation::keys.molecular_weight, 0.033 } };
+  for (auto [species, probability] : { std::pair{ 0, 0.02 }, std::pair{ 2, 0.2 } })
+  {
+    types::Surface surface;
+    surface.gas_phase_species.species_id = species;
+    surface.reaction_probability = probability;
+    surface.gas_phase_products = { { 1, 2.0, {} } };
+    mechanism.reactions.surface.push_back(surface);
+  }
+
+  auto [status, reactions] = rate_constants::PrepareSurface(mechanism, Compile(mechanism));
+  ASSERT_EQ(status, ConfigParseStatus::Success);
+  ASSERT_EQ(reactions.Size(), 2);
+
+  std::vector<double> temperature = Temperatures();
+  std::vector<double> radius;
+  std::vector<double> number_concentration;
+  for (std::size_t c = 0; c < number_of_cells; ++c)
+  {
+    radius.push_back(1.0e-8 * (1.0 + c));
+    number_concentration.push_back(1.0e9 + 1.0e7 * c);
+  }
+  std::vector<double> k;
+  rate_constants::Evaluate(
+      reactions,
+      { temperature.data(), number_of_cells },
+      { radius.data(), number_of_cells },
+      { number_concentration.data(), number_of_cells },
+      k);
+  ASSERT_EQ(k.size(), 2 * number_of_cells);
+  for (std::size_t i = 0; i < reactions.Size(); ++i)
+  {
+    const auto& properties = mechanism.species[mechanism.reactions.surface[i].gas_phase_species.species_id].optional_numerical_properties;
+    double D = properties.at(validation::keys.diffusion_coefficient);
+    double MW = properties.at(validation::keys.molecular_weight);
+    double gamma = mechanism.reactions.surface[i].reaction_probability;
+    for (std::size_t c = 0; c < number_of_cells; ++c)
+    {
+      double pi = std::acos(-1.0);
+      double v = std::sqrt(8.0 * constants::R * temperature[c] / (pi * MW));
+      double r = radius[c];
+      double expected = 4.0 * number_concentration[c] * pi * r * r / (r / D + 4.0 / (v * gamma));
+      ExpectRelativelyNear(k[i * number_of_cells + c], expected);
+    }
+  }
+
+  // the gas species of a Surface reaction needs both properties
+  mechanism.species[2].optional_numerical_properties.erase(validation::keys.molecular_weight);
+  EXPECT_EQ(rate_constants::PrepareSurface(mechanism, Compile(mechanism)).first, ConfigParseStatus::MissingSpeciesProperty);
+}
+
+TEST(RateConstants, EvaluatesSimpolPartitioningOverBins)
+{
+  types::Mechanism mechanism;
+  mechanism.species.push_back({ "ethanol", {}, {} });
+  mechanism.species.push_back({ "aqueous ethanol", {}, {} });
+  mechanism.species.push_back({ "pinonic acid", {}, {} });
+  mechanism.species.push_back({ "organic pinonic acid", {}, {} });
+  mechanism.species[0].optional_numerical_properties = { { validation::keys.diffusion_coefficient, 1.2e-5 },
+                                                         { validation::keys.molecular_weight, 0.046 } };
+  mechanism.species[2].optional_numerical_properties = { { validation::keys.diffusion_coefficient, 6.0e-6 },
+                                                         { validation::keys.molecular_weight, 0.184 } };
+  for (auto [gas, aerosol, B] : { std::tuple{ 0, 1, std::array<double, 4>{ -1.97e3, 2.91, 1.96e-3, -4.96e-1 } },
+                                  std::tuple{ 2, 3, std::array<double, 4>{ -3.2e3, 4.1, 2.5e-3, -1.1 } } })
+  {
+    types::SimpolPhaseTransfer simpol;
+    simpol.gas_phase_species.species_id = gas;
+    simpol.aerosol_phase_species.species_id = aerosol;
+    simpol.B = B;
+    mechanism.reactions.simpol_phase_transfer.push_back(simpol);
+  }
+
+  auto [status, reactions] = rate_constants::PrepareSimpol(mechanism, Compile(mechanism));
+  ASSERT_EQ(status, ConfigParseStatus::Success);
+  ASSERT_EQ(reactions.Size(), 2);
+
+  const std::size_t number_of_bins = 3;
+  std::vector<double> temperature = Temperatures();
+  std::vector<double> radius;
+  std::vector<double> number_concentration;
+  for (std::size_t b = 0; b < number_of_bins; ++b)
+  {
+    for (std::size_t c = 0; c < number_of_cells; ++c)
+    {
+      radius.push_back(1.0e-8 * std::pow(10.0, b) * (1.0 + 0.01 * c));
+      number_concentration.push_back(1.0e10 / std::pow(10.0, b) + 1.0e6 * c);
+    }
+  }
+  std::vector<double> saturation;
+  std::vector<double> k;
+  rate_constants::Evaluate(
+      reactions,
+      { temperature.data(), number_of_cells },
+      { radius.data(), radius.size() },
+      { number_concentration.data(), number_concentration.size() },
+      saturation,
+      k);
+  ASSERT_EQ(saturation.size(), 2 * number_of_cells);
+  ASSERT_EQ(k.size(), 2 * number_of_bins * number_of_cells);
+  const double pi = std::acos(-1.0);
+  for (std::size_t i = 0; i < reactions.Size(); ++i)
+  {
+    const types::SimpolPhaseTransfer& simpol = mechanism.reactions.simpol_phase_transfer[i];
+    const auto& properties = mechanism.species[simpol.gas_phase_species.species_id].optional_numerical_properties;
+    double D = properties.at(validation::keys.diffusion_coefficient);
+    double MW = properties.at(validation::keys.molecular_weight);
+    for (std::size_t c = 0; c < number_of_cells; ++c)
+    {
+      double T = temperature[c];
+      double p = std::pow(10.0, simpol.B[0] / T + simpol.B[1] + simpol.B[2] * T + simpol.B[3] * std::log(T)) * 101325.0;
+      ExpectRelativelyNear(saturation[i * number_of_cells + c], p / (constants::R * T));
+
+      double v = std::sqrt(8.0 * constants::R * T / (pi * MW));
+      for (std::size_t b = 0; b < number_of_bins; ++b)
+      {
+        double r = radius[b * number_of_cells + c];
+        double expected = 4.0 * pi * number_concentration[b * number_of_cells + c] * r * r / (r / D + 4.0 / v);
+        ExpectRelativelyNear(k[(i * number_of_bins + b) * number_of_cells + c], expected);
+      }
+    }
+  }
+
+  mechanism.species[0].optional_numerical_properties.clear();
+  EXPECT_EQ(rate_constants::PrepareSimpol(mechanism, Compile(mechanism)).first, ConfigParseStatus::MissingSpeciesProperty);
+}
+
+TEST(RateConstants, EvaluatesHenrysLawInBothDirections)
+{
+  enum : types::SymbolId
+  {
+    GasH2O2,
+    AqueousH2O2,
+    Water,
+    NumberOfSpecies
+  };
+  types::Mechanism mechanism;
+  mechanism.species.push_back({ "H2O2", {}, {} });
+  mechanism.species.push_back({ "aqueous H2O2", {}, {} });
+  mechanism.species.push_back({ "H2O", {}, {} });
+  mechanism.species[GasH2O2].optional_numerical_properties = { { validation::keys.henrys_law_constant_298, 1.011e3 },
+                                                               { validation::keys.henrys_law_constant_exponential_factor, 6340.0 },
+                                                               { validation::keys.diffusion_coefficient, 1.46e-5 },
+                                                               { validation::keys.molecular_weight, 0.0340147 } };
+  mechanism.species[Water].optional_numerical_properties = { { validation::keys.molecular_weight, 0.018 },
+                                                             { validation::keys.density, 1000.0 } };
+  types::HenrysLaw henrys_law;
+  henrys_law.gas_phase_species = GasH2O2;
+  henrys_law.aerosol_phase_species = AqueousH2O2;
+  henrys_law.aerosol_phase_water = Water;
+  mechanism.reactions.henrys_law.push_back(henrys_law);
+
+  auto [status, reactions] = rate_constants::PrepareHenrysLaw(mechanism, Compile(mechanism));
+  ASSERT_EQ(status, ConfigParseStatus::Success);
+  ASSERT_EQ(reactions.Size(), 1);
+
+  std::vector<double> temperature = Temperatures();
+  std::vector<double> radius(number_of_cells, 5.0e-6);
+  std::vector<double> number_concentration(number_of_cells, 1.0e8);
+  std::vector<double> concentrations = Concentrations(NumberOfSpecies, Water);
+  std::vector<double> forward;
+  std::vector<double> reverse;
+  rate_constants::Evaluate(
+      reactions,
+      { temperature.data(), number_of_cells },
+      { radius.data(), number_of_cells },
+      { number_concentration.data(), number_of_cells },
+      { concentrations.data(), concentrations.size() },
+      forward,
+      reverse);
+  ASSERT_EQ(forward.size(), number_of_cells);
+  ASSERT_EQ(reverse.size(), number_of_cells);
+  const double pi = std::acos(-1.0);
+  for (std::size_t c = 0; c < number_of_cells; ++c)
+  {
+    double T = temperature[c];
+    double r = radius[c];
+    double v = std::sqrt(8.0 * constants::R * T / (pi * 0.0340147));
+    double expected_forward = 4.0 * pi * number_concentration[c] * r * r / (r / 1.46e-5 + 4.0 / v);
+    ExpectRelativelyNear(forward[c], expected_forward);
+
+    // at equilibrium the dissolved concentration per volume of water is HLC times the partial pressure
+    double HLC = 1.011e3 * std::exp(6340.0 * (1.0 / T - 1.0 / 298.0));
+    double water_volume = concentrations[Water * number_of_cells + c] * 0.018 / 1000.0;
+    double gas = 1.0e-9;
+    double dissolved = forward[c] * gas / reverse[c];
+    ExpectRelativelyNear(dissolved / water_volume, HLC * gas * constants::R * T);
+  }
+
+  // cells without water or without particles exchange nothing
+  std::fill(concentrations.begin() + Water * number_of_cells, concentrations.end(), 0.0);
+  number_concentration[1] = 0.0;
+  radius[2] = 0.0;
+  rate_constants::Evaluate(
+      reactions,
+      { temperature.data(), number_of_cells },
+      { radius.data(), number_of_cells },
+      { number_concentration.data(), number_of_cells },
+      { concentrations.data(), concentrations.size() },
+      forward,
+      reverse);
+  for (std::size_t c = 0; c < number_of_cells; ++c)
+  {
+    EXPECT_EQ(forward[c], 0.0);
+    EXPECT_EQ(reverse[c], 0.0);
+  }
+  concentrations[Water * number_of_cells + 1] = 1.0e-3;
+  concentrations[Water * number_of_cells + 2] = 1.0e-3;
+  concentrations[Water * number_of_cells + 3] = 1.0e-3;
+  rate_constants::Evaluate(
+      reactions,
+      { temperature.data(), number_of_cells },
+      { radius.data(), number_of_cells },
+      { number_concentration.data(), number_of_cells },
+      { concentrations.data(), concentrations.size() },
+      forward,
+      reverse);
+  EXPECT_EQ(forward[1], 0.0);
+  EXPECT_EQ(reverse[1], 0.0);
+  EXPECT_EQ(forward[2], 0.0);
+  EXPECT_EQ(reverse[2], 0.0);
+  EXPECT_GT(forward[3], 0.0);
+  EXPECT_GT(reverse[3], 0.0);
+
+  mechanism.species[Water].optional_numerical_properties.erase(validation::keys.density);
+  EXPECT_EQ(rate_constants::PrepareHenrysLaw(mechanism, Compile(mechanism)).first, ConfigParseStatus::MissingSpeciesProperty);
+}
+
+TEST(RateConstants, EvaluatesAqueousEquilibrium)
+{
+  enum : types::SymbolId
+  {
+    HCO3,
+    H,
+    CO2,
+    Water,
+    NumberOfSpecies
+  };
+  types::Mechanism mechanism;
+  for (const char* name : { "HCO3-", "H+", "CO2", "H2O" })
+  {
+    mechanism.species.push_back({ name, {}, {} });
+  }
+  mechanism.species[Water].optional_numerical_properties = { { validation::keys.molecular_weight, 0.018 },
+                                                             { validation::keys.density, 1000.0 } };
+  // CO2 <-> H+ + HCO3-, and a second order forward reaction, HCO3- + H+ <-> CO2
+  types::AqueousEquilibrium equilibrium;
+  equilibrium.aerosol_phase_water = Water;
+  equilibrium.A = 1.14e-2;
+  equilibrium.C = 2300.0;
+  equilibrium.k_reverse = 0.32;
+  equilibrium.reactants = { { CO2, 1.0, {} } };
+  equilibrium.products = { { H, 1.0, {} }, { HCO3, 1.0, {} } };
+  mechanism.reactions.aqueous_equilibrium.push_back(equilibrium);
+  equilibrium.A = 87.7;
+  equilibrium.C = -1500.0;
+  equilibrium.k_reverse = 4.5e-3;
+  std::swap(equilibrium.reactants, equilibrium.products);
+  mechanism.reactions.aqueous_equilibrium.push_back(equilibrium);
+
+  auto [status, reactions] = rate_constants::PrepareAqueousEquilibrium(mechanism, Compile(mechanism));
+  ASSERT_EQ(status, ConfigParseStatus::Success);
+  ASSERT_EQ(reactions.Size(), 2);
+
+  std::vector<double> temperature = Temperatures();
+  std::vector<double> concentrations = Concentrations(NumberOfSpecies, Water);
+  std::vector<double> forward;
+  std::vector<double> reverse;
+  rate_constants::Evaluate(
+      reactions, { temperature.data(), number_of_cells }, { concentrations.data(), concentrations.size() }, forward, reverse);
+  ASSERT_EQ(forward.size(), 2 * number_of_cells);
+  ASSERT_EQ(reverse.size(), 2 * number_of_cells);
+  for (std::size_t i = 0; i < reactions.Size(); ++i)
+  {
+    const types::AqueousEquilibrium& reaction = mechanism.reactions.aqueous_equilibrium[i];
+    double reactant_order = static_cast<double>(reaction.reactants.size());
+    double product_order = static_cast<double>(reaction.products.size());
+    for (std::size_t c = 0; c < number_of_cells; ++c)
+    {
+      double T = temperature[c];
+      double water_volume = concentrations[Water * number_of_cells + c] * 0.018 / 1000.0;
+      double K = reaction.A * std::exp(reaction.C * (1.0 / T - 1.0 / 298.0));
+      ExpectRelativelyNear(forward[i * number_of_cells + c], K * reaction.k_reverse * std::pow(water_volume, 1.0 - reactant_order));
+      ExpectRelativelyNear(reverse[i * number_of_cells + c], reaction.k_reverse * std::pow(water_volume, 1.0 - product_order));
+    }
+  }
+
+  // without water, nothing reacts in either direction, whatever the order
+  std::fill(concentrations.begin() + Water * number_of_cells, concentrations.end(), 0.0);
+  rate_constants::Evaluate(
+      reactions, { temperature.data(), number_of_cells }, { concentrations.data(), concentrations.size() }, forward, reverse);
+  for (std::size_t i = 0; i < forward.size(); ++i)
+  {
+    EXPECT_EQ(forward[i], 0.0);
+    EXPECT_EQ(reverse[i], 0.0);
+  }
+}
@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+
+#include <open_atmos/mechanism_configuration/parser.hpp>
+#include <open_atmos/mechanism_configuration/reaction_parser_registry.hpp>
+#include <open_atmos/mechanism_configuration/validation.hpp>
+
+using namespace open_atmos::mechanism_configuration;
+using namespace open_atmos;
+
+namespace
+{
+  /// @brief An in-house reaction type that is stored as a first order loss with a fixed scaling factor
+  class ScaledLossParser : public IReactionParser
+  {
+   public:
+    ConfigParseStatus parse(const YAML::Node& object, const MechanismIndex& index, types::Reactions& reactions) override
+    {
+      types::FirstOrderLoss loss;
+      loss.scaling_factor = 2.0;
+      loss.gas_phase = index.FindPhase(object["gas phase"].as<std::string>());
+      loss.reactants.push_back({ index.FindSpecies(object["species"].as<std::string>()), 1.0, {} });
+      reactions.first_order_loss.push_back(loss);
+      return ConfigParseStatus::Success;
+    }
+  };
+}  // namespace
+
+TEST(ReactionParserRegistry, FindsEveryBuiltInType)
+{
+  const ReactionParserRegistry& registry = ReactionParserRegistry::Instance();
+  EXPECT_GE(registry.Size(), 14);
+  for (const std::string& type : { validation::keys.Arrhenius_key,
+                                   validation::keys.HenrysLaw_key,
+                                   validation::keys.WetDeposition_key,
+                                   validation::keys.AqueousPhaseEquilibrium_key,
+                                   validation::keys.SimpolPhaseTransfer_key,
+                                   validation::keys.FirstOrderLoss_key,
+                                   validation::keys.Emission_key,
+                                   validation::keys.CondensedPhasePhotolysis_key,
+                                   validation::keys.Photolysis_key,
+                                   validation::keys.Surface_key,
+                                   validation::keys.Tunneling_key,
+                                   validation::keys.Branched_key,
+                                   validation::keys.Troe_key,
+                                   validation::keys.CondensedPhaseArrhenius_key })
+  {
+    EXPECT_NE(registry.Find(type), nullptr) << type;
+  }
+  EXPECT_EQ(registry.Find(""), nullptr);
+  EXPECT_EQ(registry.Find("arrhenius"), nullptr);
+  EXPECT_EQ(registry.Find("ARRHENIUS "), nullptr);
+}
+
+TEST(ReactionParserRegistry, KeepsEveryTypeDistinctAsItGrows)
+{
+  ReactionParserRegistry registry;
+  std::size_t built_in = registry.Size();
+  for (int i = 0; i < 300; ++i)
+  {
+    registry.Register("TYPE_" + std::to_string(i), std::make_unique<ScaledLossParser>());
+  }
+  EXPECT_EQ(registry.Size(), built_in + 300);
+  for (int i = 0; i < 300; ++i)
+  {
+    EXPECT_NE(registry.Find("TYPE_" + std::to_string(i)), nullptr);
+  }
+  EXPECT_EQ(registry.Find("TYPE_300"), nullptr);
+  EXPECT_NE(registry.Find(validation::keys.Troe_key), nullptr);
+
+  // registering a type again replaces its parser
+  IReactionParser* first = registry.Find("TYPE_0");
+  registry.Register("TYPE_0", std::make_unique<ScaledLossParser>());
+  EXPECT_EQ(registry.Size(), built_in + 300);
+  EXPECT_NE(registry.Find("TYPE_0"), first);
+}
+
+TEST(ReactionParserRegistry, ParsesRegisteredTypes)
+{
+  const std::string configuration = R"({
+    "version": "1.0.0",
+    "name": "registered",
+    "species": [{"name": "A"}],
+    "phases": [{"name": "gas", "species": ["A"]}],
+    "reactions": [{"type": "SCALED_LOSS", "gas phase": "gas", "species": "A"}]
+  })";
+
+  Parser parser;
+  EXPECT_EQ(parser.Parse(YAML::Load(configuration)).first, ConfigParseStatus::ObjectTypeNotFound);
+
+  ReactionParserRegistry::Instance().Register("SCALED_LOSS", std::make_unique<ScaledLossParser>());
+  auto [status, mechanism] = parser.Parse(YAML::Load(configuration));
+  ASSERT_EQ(status, ConfigParseStatus::Success);
+  ASSERT_EQ(mechanism.reactions.first_order_loss.size(), 1);
+  EXPECT_EQ(mechanism.reactions.first_order_loss[0].scaling_factor, 2.0);
+  EXPECT_EQ(mechanism.species_symbols.Name(mechanism.reactions.first_order_loss[0].reactants[0].species_id), "A");
+}
@@ -0,0 +1,282 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <open_atmos/mechanism_configuration/compiled_mechanism.hpp>
+#include <open_atmos/mechanism_configuration/jacobian.hpp>
+#include <open_atmos/mechanism_configuration/parser.hpp>
+#include <open_atmos/mechanism_configuration/reordering.hpp>
+#include <open_atmos/mechanism_configuration/stoichiometry.hpp>
+#include <utility>
+#include <vector>
+
+using namespace open_atmos::mechanism_configuration;
+using namespace open_atmos;
+
+namespace
+{
+  SparsityPattern Pattern(std::size_t size, std::vector<std::pair<std::uint32_t, std::uint32_t>> entries)
+  {
+    for (std::uint32_t i = 0; i < size; ++i)
+    {
+      entries.emplace_back(i, i);
+    }
+    std::sort(entries.begin(), entries.end());
+    entries.erase(std::unique(entries.begin(), entries.end()), entries.end());
+
+    SparsityPattern pattern;
+    pattern.number_of_rows = size;
+    pattern.number_of_columns = size;
+    std::size_t next = 0;
+    for (std::size_t row = 0; row < size; ++row)
+    {
+      for (; next < entries.size() && entries[next].first == row; ++next)
+      {
+        pattern.indices.push_back(entries[next].second);
+      }
+      pattern.offsets.push_back(static_cast<std::uint32_t>(pattern.indices.size()));
+    }
+    return pattern;
+  }
+
+  std::size_t Bandwidth(const SparsityPattern& pattern)
+  {
+    std::size_t bandwidth = 0;
+    for (std::size_t row = 0; row < pattern.number_of_rows; ++row)
+    {
+      for (std::uint32_t column : pattern.Columns(row))
+      {
+        bandwidth = std::max<std::size_t>(bandwidth, std::abs(static_cast<long>(column) - static_cast<long>(row)));
+      }
+    }
+    return bandwidth;
+  }
+
+  /// @brief The number of entries that become non-zero during a dense symbolic elimination of the pattern
+  std::size_t Fill(const SparsityPattern& pattern)
+  {
+    const std::size_t size = pattern.number_of_rows;
+    std::vector<std::vector<bool>> nonzero(size, std::vector<bool>(size, false));
+    for (std::size_t row = 0; row < size; ++row)
+    {
+      for (std::uint32_t column : pattern.Columns(row))
+      {
+        nonzero[row][column] = nonzero[column][row] = true;
+      }
+    }
+    std::size_t fill = 0;
+    for (std::size_t pivot = 0; pivot < size; ++pivot)
+    {
+      for (std::size_t row = pivot + 1; row < size; ++row)
+      {
+        for (std::size_t column = pivot + 1; column < size && nonzero[row][pivot]; ++column)
+        {
+          if (nonzero[pivot][column] && !nonzero[row][column])
+          {
+            nonzero[row][column] = true;
+            ++fill;
+          }
+        }
+      }
+    }
+    return fill;
+  }
+
+  void ExpectPermutation(std::vector<std::uint32_t> order, std::size_t size)
+  {
+    ASSERT_EQ(order.size(), size);
+    std::sort(order.begin(), order.end());
+    for (std::size_t i = 0; i < size; ++i)
+    {
+      EXPECT_EQ(order[i], i);
+    }
+  }
+
+  types::ReactionComponent Component(types::SymbolId species, double coefficient = 1.0)
+  {
+    types::ReactionComponent component;
+    component.species_id = species;
+    component.coefficient = coefficient;
+    return component;
+  }
+
+  types::Mechanism BuildMechanism()
+  {
+    types::Mechanism mechanism;
+    for (const char* name : { "A", "B", "C", "D", "E", "F", "W" })
+    {
+      mechanism.species.push_back({ name, {}, {} });
+      mechanism.species_symbols.Intern(name);
+    }
+
+    // A + B -> C
+    types::Arrhenius arrhenius;
+    arrhenius.reactants = { Component(0), Component(1) };
+    arrhenius.products = { Component(2) };
+    mechanism.reactions.arrhenius.push_back(arrhenius);
+
+    // C -> D or E + 0.5 F
+    types::Branched branched{};
+    branched.reactants = { Component(2) };
+    branched.nitrate_products = { Component(3) };
+    branched.alkoxy_products = { Component(4), Component(5, 0.5) };
+    mechanism.reactions.branched.push_back(branched);
+
+    // A (gas) <-> F (aqueous), normalized by the aqueous water W
+    types::HenrysLaw henrys_law;
+    henrys_law.gas_phase_species = 0;
+    henrys_law.aerosol_phase_species = 5;
+    henrys_law.aerosol_phase_water = 6;
+    mechanism.reactions.henrys_law.push_back(henrys_law);
+
+    // E (gas) -> B
+    types::Surface surface;
+    surface.gas_phase_species = Component(4);
+    surface.gas_phase_products = { Component(1) };
+    mechanism.reactions.surface.push_back(surface);
+    return mechanism;
+  }
+}  // namespace
+
+TEST(Reordering, ReverseCuthillMcKeeNarrowsTheBand)
+{
+  // a tridiagonal pattern with its rows and columns scrambled
+  const std::size_t size = 31;
+  std::vector<std::pair<std::uint32_t, std::uint32_t>> entries;
+  auto scrambled = [&](std::size_t i) { return static_cast<std::uint32_t>((i * 7) % size); };
+  for (std::size_t i = 0; i + 1 < size; ++i)
+  {
+    entries.emplace_back(scrambled(i), scrambled(i + 1));
+  }
+  SparsityPattern pattern = Pattern(size, entries);
+  EXPECT_GT(Bandwidth(pattern), 1);
+
+  std::vector<std::uint32_t> order = ComputeOrdering(pattern, SpeciesOrdering::ReverseCuthillMcKee);
+  ExpectPermutation(order, size);
+  EXPECT_EQ(Bandwidth(PermuteSymmetric(pattern, order)), 1);
+}
+
+TEST(Reordering, MinimumDegreeAvoidsFill)
+{
+  // an arrow pattern whose hub comes first fills in completely when eliminated in its current order
+  const std::size_t size = 12;
+  std::vector<std::pair<std::uint32_t, std::uint32_t>> entries;
+  for (std::uint32_t i = 1; i < size; ++i)
+  {
+    entries.emplace_back(0, i);
+    entries.emplace_back(i, 0);
+  }
+  SparsityPattern pattern = Pattern(size, entries);
+  EXPECT_EQ(Fill(pattern), (size - 1) * (size - 2));
+
+  std::vector<std::uint32_t> order = ComputeOrdering(pattern, SpeciesOrdering::MinimumDegree);
+  ExpectPermutation(order, size);
+  EXPECT_NE(order.front(), 0);
+  EXPECT_EQ(Fill(PermuteSymmetric(pattern, order)), 0);
+}
+
+TEST(Reordering, MinimumDegreeDoesNotAddFillToAGrid)
+{
+  // a 6 x 6 grid numbered row by row
+  const std::size_t side = 6;
+  std::vector<std::pair<std::uint32_t, std::uint32_t>> entries;
+  for (std::uint32_t i = 0; i < side * side; ++i)
+  {
+    if ((i + 1) % side != 0)
+    {
+      entries.emplace_back(i, i + 1);
+    }
+    if (i + side < side * side)
+    {
+      entries.emplace_back(i + side, i);
+    }
+  }
+  SparsityPattern pattern = Pattern(side * side, entries);
+  for (SpeciesOrdering method : { SpeciesOrdering::ReverseCuthillMcKee, SpeciesOrdering::MinimumDegree })
+  {
+    std::vector<std::uint32_t> order = ComputeOrdering(pattern, method);
+    ExpectPermutation(order, side * side);
+    EXPECT_LE(Fill(PermuteSymmetric(pattern, order)), Fill(pattern));
+    EXPECT_EQ(order, ComputeOrdering(pattern, method));
+  }
+}
+
+TEST(Reordering, HandlesDisconnectedAndEmptyPatterns)
+{
+  SparsityPattern pattern = Pattern(5, { { 0, 3 }, { 1, 4 } });
+  for (SpeciesOrdering method : { SpeciesOrdering::ReverseCuthillMcKee, SpeciesOrdering::MinimumDegree })
+  {
+    ExpectPermutation(ComputeOrdering(pattern, method), 5);
+    EXPECT_TRUE(ComputeOrdering(Pattern(0, {}), method).empty());
+  }
+}
+
+TEST(Reordering, RenumbersEveryStructureConsistently)
+{
+  types::Mechanism mechanism = BuildMechanism();
+  for (SpeciesOrdering method : { SpeciesOrdering::ReverseCuthillMcKee, SpeciesOrdering::MinimumDegree })
+  {
+    std::vector<std::uint32_t> order = ComputeSpeciesOrdering(mechanism, method);
+    ExpectPermutation(order, mechanism.species.size());
+
+    auto [status, renumbered] = RenumberSpecies(mechanism, order);
+    ASSERT_EQ(status, ConfigParseStatus::Success);
+    for (std::size_t i = 0; i < order.size(); ++i)
+    {
+      EXPECT_EQ(renumbered.species[i].name, mechanism.species[order[i]].name);
+      EXPECT_EQ(renumbered.species_symbols.Name(static_cast<types::SymbolId>(i)), mechanism.species[order[i]].name);
+    }
+
+    // the Jacobian of the renumbered mechanism is the permuted Jacobian
+    EXPECT_EQ(BuildJacobianPattern(renumbered).pattern, PermuteSymmetric(BuildJacobianPattern(mechanism).pattern, order));
+
+    // each species keeps its row of the stoichiometry matrix
+    StoichiometryMatrix original = BuildStoichiometry(mechanism);
+    StoichiometryMatrix reordered = BuildStoichiometry(renumbered);
+    ASSERT_EQ(reordered.by_species.pattern.number_of_columns, original.by_species.pattern.number_of_columns);
+    for (std::size_t row = 0; row < order.size(); ++row)
+    {
+      for (std::size_t column = 0; column < original.by_species.pattern.number_of_columns; ++column)
+      {
+        EXPECT_EQ(reordered.by_species.At(row, column), original.by_species.At(order[row], column));
+      }
+    }
+
+    // renumbering a compiled mechanism matches compiling the renumbered mechanism
+    CompiledMechanism compiled = Compile(mechanism);
+    EXPECT_EQ(RenumberSpecies(compiled, order), ConfigParseStatus::Success);
+    CompiledMechanism expected = Compile(renumbered);
+    EXPECT_EQ(compiled.reactants.species, expected.reactants.species);
+    EXPECT_EQ(compiled.products.species, expected.products.species);
+    EXPECT_EQ(compiled.alternative_products.species, expected.alternative_products.species);
+    EXPECT_EQ(compiled.aerosol_phase_water, expected.aerosol_phase_water);
+  }
+}
+
+TEST(Reordering, RejectsOrdersThatAreNotPermutationsOfTheSpecies)
+{
+  types::Mechanism mechanism = BuildMechanism();
+  const std::uint32_t size = static_cast<std::uint32_t>(mechanism.species.size());
+  std::vector<std::uint32_t> identity(size);
+  for (std::uint32_t i = 0; i < size; ++i)
+  {
+    identity[i] = i;
+  }
+  std::vector<std::uint32_t> too_short(identity.begin(), identity.end() - 1);
+  std::vector<std::uint32_t> too_long = identity;
+  too_long.push_back(size);
+  std::vector<std::uint32_t> out_of_range = identity;
+  out_of_range.back() = size;
+  std::vector<std::uint32_t> repeated = identity;
+  repeated.back() = 0;
+
+  const CompiledMechanism original = Compile(mechanism);
+  for (const auto& order : { too_short, too_long, out_of_range, repeated })
+  {
+    EXPECT_EQ(RenumberSpecies(mechanism, order).first, ConfigParseStatus::InvalidSpeciesOrder);
+    CompiledMechanism compiled = original;
+    EXPECT_EQ(RenumberSpecies(compiled, order), ConfigParseStatus::InvalidSpeciesOrder);
+    EXPECT_EQ(compiled.reactants.species, original.reactants.species);
+    EXPECT_EQ(compiled.aerosol_phase_water, original.aerosol_phase_water);
+  }
+}
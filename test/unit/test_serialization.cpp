@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+
+#include <open_atmos/mechanism_configuration/parser.hpp>
+#include <open_atmos/mechanism_configuration/serialization.hpp>
+
+using namespace open_atmos::mechanism_configuration;
+using namespace open_atmos;
+
+TEST(Serialization, RoundTripsTheFullConfiguration)
+{
+  Parser parser;
+  for (const std::string extension : { ".json", ".yaml" })
+  {
+    SCOPED_TRACE(extension);
+    auto [status, mechanism] = parser.Parse(std::string("examples/full_configuration") + extension);
+    ASSERT_EQ(status, ConfigParseStatus::Success);
+
+    std::vector<std::byte> bytes = Serialize(mechanism);
+    auto [decoded_status, decoded] = Deserialize(bytes);
+    ASSERT_EQ(decoded_status, ConfigParseStatus::Success);
+
+    // every member is encoded, so a lossless round trip reproduces the same bytes
+    EXPECT_EQ(Serialize(decoded), bytes);
+
+    EXPECT_EQ(decoded.name, mechanism.name);
+    ASSERT_EQ(decoded.species.size(), mechanism.species.size());
+    EXPECT_EQ(decoded.species[1].optional_numerical_properties, mechanism.species[1].optional_numerical_properties);
+    EXPECT_EQ(decoded.species[0].unknown_properties, mechanism.species[0].unknown_properties);
+    ASSERT_EQ(decoded.phases.size(), mechanism.phases.size());
+    EXPECT_EQ(decoded.phases[0].species, mechanism.phases[0].species);
+    ASSERT_EQ(decoded.reactions.arrhenius.size(), mechanism.reactions.arrhenius.size());
+    EXPECT_EQ(decoded.reactions.arrhenius[0].A, mechanism.reactions.arrhenius[0].A);
+    EXPECT_EQ(decoded.reactions.arrhenius[0].unknown_properties, mechanism.reactions.arrhenius[0].unknown_properties);
+    EXPECT_EQ(
+        decoded.species_symbols.Name(decoded.reactions.arrhenius[0].reactants[0].species_id),
+        mechanism.species_symbols.Name(mechanism.reactions.arrhenius[0].reactants[0].species_id));
+    EXPECT_EQ(decoded.reactions.simpol_phase_transfer[0].B, mechanism.reactions.simpol_phase_transfer[0].B);
+    EXPECT_EQ(decoded.reactions.branched[0].n, mechanism.reactions.branched[0].n);
+    EXPECT_EQ(decoded.reactions.henrys_law.size(), mechanism.reactions.henrys_law.size());
+    EXPECT_EQ(decoded.reactions.tunneling.size(), mechanism.reactions.tunneling.size());
+    EXPECT_EQ(decoded.phase_symbols.Size(), mechanism.phase_symbols.Size());
+  }
+}
+
+TEST(Serialization, RejectsDamagedBuffers)
+{
+  Parser parser;
+  auto [status, mechanism] = parser.Parse(std::string("examples/full_configuration.json"));
+  ASSERT_EQ(status, ConfigParseStatus::Success);
+  const std::vector<std::byte> bytes = Serialize(mechanism);
+
+  EXPECT_EQ(Deserialize(nullptr, 0).first, ConfigParseStatus::InvalidBinaryFormat);
+  EXPECT_EQ(Deserialize(bytes.data(), 10).first, ConfigParseStatus::InvalidBinaryFormat);
+  EXPECT_EQ(Deserialize(bytes.data(), bytes.size() - 1).first, ConfigParseStatus::InvalidBinaryFormat);
+
+  std::vector<std::byte> wrong_magic = bytes;
+  wrong_magic[0] = std::byte{ 'X' };
+  EXPECT_EQ(Deserialize(wrong_magic).first, ConfigParseStatus::InvalidBinaryFormat);
+
+  std::vector<std::byte> wrong_version = bytes;
+  wrong_version[4] = std::byte{ 99 };
+  EXPECT_EQ(Deserialize(wrong_version).first, ConfigParseStatus::UnsupportedBinaryVersion);
+
+  std::vector<std::byte> corrupted = bytes;
+  corrupted[bytes.size() / 2] ^= std::byte{ 0x40 };
+  EXPECT_EQ(Deserialize(corrupted).first, ConfigParseStatus::BinaryChecksumMismatch);
+}
+
+TEST(Serialization, RoundTripsAnEmptyMechanism)
+{
+  types::Mechanism mechanism;
+  auto [status, decoded] = Deserialize(Serialize(mechanism));
+  EXPECT_EQ(status, ConfigParseStatus::Success);
+  EXPECT_TRUE(decoded.species.empty());
+  EXPECT_EQ(decoded.species_symbols.Size(), 0);
+}
@@ -0,0 +1,58 @@
+#include <gtest/gtest.h>
+
+#include <open_atmos/mechanism_configuration/sparse_matrix.hpp>
+
+using namespace open_atmos::mechanism_configuration;
+
+namespace
+{
+  /// @brief [[1 0 2]
+  ///         [0 0 3]
+  ///         [4 5 0]
+  ///         [0 0 0]]
+  SparseMatrix Example()
+  {
+    SparseMatrix matrix;
+    matrix.pattern.number_of_rows = 4;
+    matrix.pattern.number_of_columns = 3;
+    matrix.pattern.offsets = { 0, 2, 3, 5, 5 };
+    matrix.pattern.indices = { 0, 2, 2, 0, 1 };
+    matrix.values = { 1, 2, 3, 4, 5 };
+    return matrix;
+  }
+}  // namespace
+
+TEST(SparseMatrix, FindsEntries)
+{
+  SparseMatrix matrix = Example();
+  EXPECT_EQ(matrix.pattern.Size(), 5);
+  EXPECT_EQ(matrix.pattern.Find(0, 2), 1);
+  EXPECT_EQ(matrix.pattern.Find(2, 1), 4);
+  EXPECT_EQ(matrix.pattern.Find(1, 0), SparsityPattern::npos);
+  EXPECT_EQ(matrix.pattern.Find(3, 0), SparsityPattern::npos);
+  EXPECT_EQ(matrix.At(1, 2), 3);
+  EXPECT_EQ(matrix.At(1, 1), 0);
+  ASSERT_EQ(matrix.pattern.Columns(2).size(), 2);
+  EXPECT_EQ(matrix.Values(2)[1], 5);
+}
+
+TEST(SparseMatrix, Transposes)
+{
+  SparseMatrix matrix = Example();
+  SparseMatrix transposed = matrix.Transpose();
+  EXPECT_EQ(transposed.pattern.number_of_rows, 3);
+  EXPECT_EQ(transposed.pattern.number_of_columns, 4);
+  EXPECT_EQ(transposed.pattern.offsets, (std::vector<std::uint32_t>{ 0, 2, 3, 5 }));
+  EXPECT_EQ(transposed.pattern.indices, (std::vector<std::uint32_t>{ 0, 2, 2, 0, 1 }));
+  EXPECT_EQ(transposed.values, (std::vector<double>{ 1, 4, 5, 2, 3 }));
+  for (std::size_t row = 0; row < 4; ++row)
+  {
+    for (std::size_t column = 0; column < 3; ++column)
+    {
+      EXPECT_EQ(transposed.At(column, row), matrix.At(row, column));
+    }
+  }
+  EXPECT_EQ(transposed.Transpose().values, matrix.values);
+  EXPECT_EQ(matrix.pattern.Transpose(), transposed.pattern);
+  EXPECT_NE(matrix.pattern, transposed.pattern);
+}
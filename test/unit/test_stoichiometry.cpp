@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+
+#include <open_atmos/mechanism_configuration/parser.hpp>
+#include <open_atmos/mechanism_configuration/stoichiometry.hpp>
+
+using namespace open_atmos::mechanism_configuration;
+using namespace open_atmos;
+
+namespace
+{
+  enum Species : types::SymbolId
+  {
+    A,
+    B,
+    C,
+    N,
+    O,
+    P,
+    NumberOfSpecies
+  };
+
+  types::ReactionComponent Component(types::SymbolId species, double coefficient = 1.0)
+  {
+    types::ReactionComponent component;
+    component.species_id = species;
+    component.coefficient = coefficient;
+    return component;
+  }
+
+  types::Mechanism BuildMechanism()
+  {
+    types::Mechanism mechanism;
+    for (const char* name : { "A", "B", "C", "N", "O", "P" })
+    {
+      mechanism.species.push_back({ name, {}, {} });
+      mechanism.species_symbols.Intern(name);
+    }
+
+    // A + A + C -> C + 2 B, where C is a catalyst
+    types::Arrhenius arrhenius;
+    arrhenius.reactants = { Component(A), Component(A), Component(C) };
+    arrhenius.products = { Component(C), Component(B, 2.0) };
+    mechanism.reactions.arrhenius.push_back(arrhenius);
+
+    // A -> N (nitrate) or O + 0.5 P (alkoxy)
+    types::Branched branched{};
+    branched.reactants = { Component(A) };
+    branched.nitrate_products = { Component(N) };
+    branched.alkoxy_products = { Component(O), Component(P, 0.5) };
+    mechanism.reactions.branched.push_back(branched);
+
+    // -> P
+    types::Emission emission;
+    emission.products = { Component(P) };
+    mechanism.reactions.emission.push_back(emission);
+
+    // B (gas) <-> C (aerosol)
+    types::HenrysLaw henrys_law;
+    henrys_law.gas_phase_species = B;
+    henrys_law.aerosol_phase_species = C;
+    mechanism.reactions.henrys_law.push_back(henrys_law);
+
+    // B -> A + B (surface, B regenerated)
+    types::Surface surface;
+    surface.gas_phase_species = Component(B);
+    surface.gas_phase_products = { Component(A), Component(B) };
+    mechanism.reactions.surface.push_back(surface);
+    return mechanism;
+  }
+}  // namespace
+
+TEST(Stoichiometry, BuildsNetColumns)
+{
+  StoichiometryMatrix stoichiometry = BuildStoichiometry(BuildMechanism());
+  const SparseMatrix& columns = stoichiometry.by_column;
+
+  // the branched reaction has two columns
+  ASSERT_EQ(columns.pattern.number_of_rows, 6);
+  EXPECT_EQ(columns.pattern.number_of_columns, NumberOfSpecies);
+  EXPECT_EQ(stoichiometry.column_reactions, (std::vector<std::uint32_t>{ 0, 1, 1, 2, 3, 4 }));
+  EXPECT_EQ(stoichiometry.reaction_columns, (std::vector<std::uint32_t>{ 0, 1, 3, 4, 5, 6 }));
+
+  // arrhenius: repeated A combined, catalyst C left out
+  EXPECT_EQ(columns.pattern.Columns(0).size(), 2);
+  EXPECT_EQ(columns.At(0, A), -2.0);
+  EXPECT_EQ(columns.At(0, B), 2.0);
+  EXPECT_EQ(columns.pattern.Find(0, C), SparsityPattern::npos);
+
+  // nitrate then alkoxy branch
+  EXPECT_EQ(columns.At(1, A), -1.0);
+  EXPECT_EQ(columns.At(1, N), 1.0);
+  EXPECT_EQ(columns.At(1, O), 0.0);
+  EXPECT_EQ(columns.At(2, A), -1.0);
+  EXPECT_EQ(columns.At(2, O), 1.0);
+  EXPECT_EQ(columns.At(2, P), 0.5);
+  EXPECT_EQ(columns.At(2, N), 0.0);
+
+  EXPECT_EQ(columns.pattern.Columns(3).size(), 1);
+  EXPECT_EQ(columns.At(3, P), 1.0);
+
+  // henry's law in the forward direction
+  EXPECT_EQ(columns.At(4, B), -1.0);
+  EXPECT_EQ(columns.At(4, C), 1.0);
+
+  // surface: B is consumed and regenerated
+  EXPECT_EQ(columns.pattern.Columns(5).size(), 1);
+  EXPECT_EQ(columns.At(5, A), 1.0);
+}
+
+TEST(Stoichiometry, ProvidesBothOrientations)
+{
+  StoichiometryMatrix stoichiometry = BuildStoichiometry(BuildMechanism());
+  EXPECT_EQ(stoichiometry.by_species.pattern.number_of_rows, NumberOfSpecies);
+  EXPECT_EQ(stoichiometry.by_species.pattern.number_of_columns, 6);
+  for (std::size_t species = 0; species < NumberOfSpecies; ++species)
+  {
+    for (std::size_t column = 0; column < 6; ++column)
+    {
+      EXPECT_EQ(stoichiometry.by_species.At(species, column), stoichiometry.by_column.At(column, species));
+    }
+  }
+  // A is changed by the arrhenius reaction, both branches and the surface reaction
+  EXPECT_EQ(stoichiometry.by_species.pattern.Columns(A).size(), 4);
+}
+
+TEST(Stoichiometry, CoversEveryReactionOfAParsedMechanism)
+{
+  Parser parser;
+  auto [status, mechanism] = parser.Parse(std::string("examples/full_configuration.json"));
+  ASSERT_EQ(status, ConfigParseStatus::Success);
+  CompiledMechanism compiled = Compile(mechanism);
+  StoichiometryMatrix stoichiometry = BuildStoichiometry(compiled);
+  EXPECT_EQ(stoichiometry.reaction_columns.size(), compiled.number_of_reactions + 1);
+  EXPECT_EQ(stoichiometry.by_column.pattern.number_of_rows, compiled.number_of_reactions + mechanism.reactions.branched.size());
+  EXPECT_EQ(stoichiometry.by_species.pattern.number_of_rows, mechanism.species.size());
+  EXPECT_EQ(stoichiometry.by_species.pattern.Size(), stoichiometry.by_column.pattern.Size());
+}
@@ -0,0 +1,44 @@
+#include <gtest/gtest.h>
+
+#include <open_atmos/symbol_table.hpp>
+#include <stdexcept>
+
+using namespace open_atmos;
+
+TEST(SymbolTable, InternsEachNameOnce)
+{
+  types::SymbolTable table;
+  EXPECT_EQ(table.Intern("A"), 0);
+  EXPECT_EQ(table.Intern("a much longer species name that does not fit in a small string"), 1);
+  EXPECT_EQ(table.Intern("A"), 0);
+  EXPECT_EQ(table.Size(), 2);
+
+  EXPECT_EQ(table.Find("A"), 0);
+  EXPECT_EQ(table.Find("B"), types::unknown_symbol);
+  EXPECT_EQ(table.Name(1), "a much longer species name that does not fit in a small string");
+  EXPECT_THROW(table.Name(2), std::out_of_range);
+  EXPECT_THROW(table.Name(types::unknown_symbol), std::out_of_range);
+}
+
+TEST(SymbolTable, KeepsNamesReachableAfterGrowingAndCopying)
+{
+  types::SymbolTable table;
+  for (int i = 0; i < 1000; ++i)
+  {
+    table.Intern("S" + std::to_string(i));
+  }
+
+  types::SymbolTable copy = table;
+  types::SymbolTable moved = std::move(table);
+  for (int i = 0; i < 1000; ++i)
+  {
+    std::string name = "S" + std::to_string(i);
+    EXPECT_EQ(copy.Find(name), static_cast<types::SymbolId>(i));
+    EXPECT_EQ(moved.Find(name), static_cast<types::SymbolId>(i));
+    EXPECT_EQ(moved.Name(i), name);
+  }
+
+  copy = moved;
+  EXPECT_EQ(copy.Size(), 1000);
+  EXPECT_EQ(copy.Find("S999"), 999);
+}
@@ -0,0 +1,214 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <open_atmos/mechanism_configuration/jacobian.hpp>
+#include <open_atmos/mechanism_configuration/parser.hpp>
+#include <open_atmos/mechanism_configuration/symbolic_lu.hpp>
+#include <utility>
+#include <vector>
+
+using namespace open_atmos::mechanism_configuration;
+using namespace open_atmos;
+
+namespace
+{
+  SparsityPattern Pattern(std::size_t size, std::vector<std::pair<std::uint32_t, std::uint32_t>> entries)
+  {
+    for (std::uint32_t i = 0; i < size; ++i)
+    {
+      entries.emplace_back(i, i);
+    }
+    std::sort(entries.begin(), entries.end());
+    entries.erase(std::unique(entries.begin(), entries.end()), entries.end());
+
+    SparsityPattern pattern;
+    pattern.number_of_rows = size;
+    pattern.number_of_columns = size;
+    std::size_t next = 0;
+    for (std::size_t row = 0; row < size; ++row)
+    {
+      for (; next < entries.size() && entries[next].first == row; ++next)
+      {
+        pattern.indices.push_back(entries[next].second);
+      }
+      pattern.offsets.push_back(static_cast<std::uint32_t>(pattern.indices.size()));
+    }
+    return pattern;
+  }
+
+  /// @brief A sparse unsymmetric pattern with values that make the matrix diagonally dominant
+  std::pair<SparsityPattern, std::vector<double>> RandomMatrix(std::size_t size, std::size_t entries_per_row)
+  {
+    std::uint64_t state = 12345;
+    auto next = [&]()
+    {
+      state = state * 6364136223846793005ull + 1442695040888963407ull;
+      return static_cast<std::uint32_t>(state >> 33);
+    };
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> entries;
+    for (std::uint32_t row = 0; row < size; ++row)
+    {
+      for (std::size_t i = 0; i < entries_per_row; ++i)
+      {
+        entries.emplace_back(row, next() % size);
+      }
+    }
+    SparsityPattern pattern = Pattern(size, entries);
+    std::vector<double> values;
+    for (std::size_t row = 0; row < size; ++row)
+    {
+      for (std::uint32_t column : pattern.Columns(row))
+      {
+        values.push_back(column == row ? 2.0 * entries_per_row + 1.0 : (next() % 1000) / 1000.0 - 0.5);
+      }
+    }
+    return { pattern, values };
+  }
+
+  /// @brief Dense Doolittle LU without pivoting, stored in place
+  std::vector<std::vector<double>> DenseLU(const SparsityPattern& pattern, const std::vector<double>& values)
+  {
+    const std::size_t size = pattern.number_of_rows;
+    std::vector<std::vector<double>> matrix(size, std::vector<double>(size, 0.0));
+    for (std::size_t row = 0; row < size; ++row)
+    {
+      for (std::uint32_t position = pattern.offsets[row]; position < pattern.offsets[row + 1]; ++position)
+      {
+        matrix[row][pattern.indices[position]] = values[position];
+      }
+    }
+    for (std::size_t pivot = 0; pivot < size; ++pivot)
+    {
+      for (std::size_t row = pivot + 1; row < size; ++row)
+      {
+        matrix[row][pivot] /= matrix[pivot][pivot];
+        for (std::size_t column = pivot + 1; column < size; ++column)
+        {
+          matrix[row][column] -= matrix[row][pivot] * matrix[pivot][column];
+        }
+      }
+    }
+    return matrix;
+  }
+
+  types::ReactionComponent Component(types::SymbolId species, double coefficient = 1.0)
+  {
+    types::ReactionComponent component;
+    component.species_id = species;
+    component.coefficient = coefficient;
+    return component;
+  }
+}  // namespace
+
+TEST(SymbolicLU, KeepsATridiagonalPatternFree)
+{
+  std::vector<std::pair<std::uint32_t, std::uint32_t>> entries;
+  for (std::uint32_t i = 0; i + 1 < 10; ++i)
+  {
+    entries.emplace_back(i, i + 1);
+    entries.emplace_back(i + 1, i);
+  }
+  SparsityPattern pattern = Pattern(10, entries);
+  SymbolicLU lu = BuildSymbolicLU(pattern);
+  EXPECT_EQ(lu.pattern, pattern);
+  EXPECT_EQ(lu.Fill(), 0);
+  EXPECT_EQ(lu.lower.size(), 9);
+  EXPECT_EQ(lu.update_targets.size(), 9);
+  for (std::size_t row = 0; row < 10; ++row)
+  {
+    EXPECT_EQ(lu.pattern.indices[lu.diagonal[row]], row);
+  }
+}
+
+TEST(SymbolicLU, FindsTheFillOfAnArrow)
+{
+  // a hub that comes first fills in the whole matrix; last, it fills in nothing
+  const std::uint32_t size = 8;
+  std::vector<std::pair<std::uint32_t, std::uint32_t>> hub_first;
+  std::vector<std::pair<std::uint32_t, std::uint32_t>> hub_last;
+  for (std::uint32_t i = 1; i < size; ++i)
+  {
+    hub_first.insert(hub_first.end(), { { 0, i }, { i, 0 } });
+    hub_last.insert(hub_last.end(), { { size - 1, i - 1 }, { i - 1, size - 1 } });
+  }
+  SymbolicLU filled = BuildSymbolicLU(Pattern(size, hub_first));
+  EXPECT_EQ(filled.Fill(), (size - 1) * (size - 2));
+  EXPECT_EQ(filled.pattern.Size(), size * size);
+  EXPECT_EQ(BuildSymbolicLU(Pattern(size, hub_last)).Fill(), 0);
+}
+
+TEST(SymbolicLU, MatchesADenseFactorization)
+{
+  auto [pattern, values] = RandomMatrix(60, 3);
+  SymbolicLU lu = BuildSymbolicLU(pattern);
+  std::vector<double> factorized = ScatterToLU(lu, values);
+  Factorize(lu, factorized);
+
+  std::vector<std::vector<double>> dense = DenseLU(pattern, values);
+  for (std::size_t row = 0; row < pattern.number_of_rows; ++row)
+  {
+    for (std::size_t column = 0; column < pattern.number_of_columns; ++column)
+    {
+      std::size_t position = lu.pattern.Find(row, column);
+      if (position == SparsityPattern::npos)
+      {
+        // everything outside the symbolic pattern stays zero
+        EXPECT_EQ(dense[row][column], 0.0) << row << ", " << column;
+      }
+      else
+      {
+        EXPECT_NEAR(factorized[position], dense[row][column], 1e-12) << row << ", " << column;
+      }
+    }
+  }
+
+  // solving recovers a known solution
+  std::vector<double> expected(pattern.number_of_rows);
+  for (std::size_t i = 0; i < expected.size(); ++i)
+  {
+    expected[i] = std::sin(static_cast<double>(i));
+  }
+  std::vector<double> b(pattern.number_of_rows, 0.0);
+  for (std::size_t row = 0; row < pattern.number_of_rows; ++row)
+  {
+    for (std::uint32_t position = pattern.offsets[row]; position < pattern.offsets[row + 1]; ++position)
+    {
+      b[row] += values[position] * expected[pattern.indices[position]];
+    }
+  }
+  Solve(lu, factorized, b);
+  for (std::size_t i = 0; i < expected.size(); ++i)
+  {
+    EXPECT_NEAR(b[i], expected[i], 1e-12);
+  }
+}
+
+TEST(SymbolicLU, FactorizesAMechanismJacobianInAFillReducingOrder)
+{
+  // S0 + Si -> P for every other species, so S0 couples to everything
+  types::Mechanism mechanism;
+  const std::size_t size = 10;
+  for (std::size_t i = 0; i <= size; ++i)
+  {
+    std::string name = i == size ? "P" : "S" + std::to_string(i);
+    mechanism.species.push_back({ name, {}, {} });
+    mechanism.species_symbols.Intern(name);
+  }
+  for (types::SymbolId i = 1; i < size; ++i)
+  {
+    types::Arrhenius arrhenius;
+    arrhenius.reactants = { Component(0), Component(i) };
+    arrhenius.products = { Component(size) };
+    mechanism.reactions.arrhenius.push_back(arrhenius);
+  }
+
+  SymbolicLU natural = BuildSymbolicLU(BuildJacobianPattern(mechanism).pattern);
+  EXPECT_GT(natural.Fill(), 0);
+
+  MechanismLU reordered = BuildSymbolicLU(mechanism);
+  EXPECT_EQ(reordered.lu.Fill(), 0);
+  ASSERT_EQ(reordered.species_order.size(), size + 1);
+  EXPECT_NE(reordered.species_order.front(), 0);
+  EXPECT_EQ(reordered.lu.matrix_positions.size(), natural.matrix_positions.size());
+}